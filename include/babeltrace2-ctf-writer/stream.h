@@ -64,6 +64,36 @@ extern void bt_ctf_stream_append_discarded_events(struct bt_ctf_stream *stream,
 extern int bt_ctf_stream_append_event(struct bt_ctf_stream *stream,
 		struct bt_ctf_event *event);
 
+/*
+ * bt_ctf_stream_enable_streaming: serialize events as they are appended.
+ *
+ * Once streaming is enabled, bt_ctf_stream_append_event serializes the event
+ * into the stream's current packet immediately instead of keeping a
+ * reference to it until the next call to bt_ctf_stream_flush, so that the
+ * memory used by the stream does not grow with the number of events of its
+ * current packet. The packet context's default attributes are computed as
+ * events are appended; the packet header and the other packet context
+ * fields must be set before appending the first event of a packet.
+ *
+ * If "max_packet_size" is not 0, the current packet is automatically flushed
+ * when appending an event would make it larger than "max_packet_size" bytes,
+ * the event being appended to a new packet. A packet containing a single
+ * event may be larger than "max_packet_size" bytes.
+ *
+ * Streaming may only be enabled while the stream's current packet contains
+ * no events, and requires a packet context having a "packet_size" field. It
+ * cannot be disabled, but this function may be called again to change the
+ * maximum packet size.
+ *
+ * @param stream Stream instance.
+ * @param max_packet_size Maximum packet size (bytes), or 0 to only close
+ *	packets with bt_ctf_stream_flush.
+ *
+ * Returns 0 on success, a negative value on error.
+ */
+extern int bt_ctf_stream_enable_streaming(struct bt_ctf_stream *stream,
+		uint64_t max_packet_size);
+
 /*
  * bt_ctf_stream_get_packet_header: get a stream's packet header.
  *
@@ -315,7 +315,7 @@ bt_graph_run() does \em not return until one of:
   bt_graph_run() returns #BT_GRAPH_RUN_STATUS_AGAIN.
 
   In that case, you can call bt_graph_run() again later, usually after
-  waiting for some time.
+  waiting for some time with bt_graph_wait_for_readiness().
 
   This feature exists to allow blocking operations within components
   to be postponed until they don't block. The graph user can perform
@@ -333,6 +333,20 @@ If you want to make a single sink component consume and process a few
 \bt_p_msg before controlling the thread again, use bt_graph_run_once()
 instead of bt_graph_run().
 
+<h2>\anchor api-graph-lc-profile Profile</h2>
+
+Before running a trace processing graph, you can enable its profiling
+with bt_graph_enable_profiling().
+
+When profiling is enabled, the graph counts, for each \bt_msg_iter and
+for each sink component, the method calls, the "try again" statuses,
+the returned messages by type, and the cumulative time spent in the
+methods.
+
+Get the current counters as a \bt_val with bt_graph_get_profile()
+between two bt_graph_run() or bt_graph_run_once() calls, or after the
+graph is done.
+
 <h1>Standard \bt_name component classes</h1>
 
 The \bt_name project ships with project \bt_p_plugin which provide
@@ -1282,7 +1296,7 @@ This function does \em not return until one of:
   this function returns #BT_GRAPH_RUN_STATUS_AGAIN.
 
   In that case, you can call this function again later, usually after
-  waiting for some time.
+  waiting for some time with bt_graph_wait_for_readiness().
 
   This feature exists to allow blocking operations within components
   to be postponed until they don't block. The graph user can perform
@@ -1445,6 +1459,87 @@ and what you can and cannot do with a configured graph.
 */
 extern bt_graph_run_once_status bt_graph_run_once(bt_graph *graph) __BT_NOEXCEPT;
 
+/*!
+@brief
+    Status codes for bt_graph_wait_for_readiness().
+*/
+typedef enum bt_graph_wait_for_readiness_status {
+	/*!
+	@brief
+	    Success.
+	*/
+	BT_GRAPH_WAIT_FOR_READINESS_STATUS_OK		= __BT_FUNC_STATUS_OK,
+
+	/*!
+	@brief
+	    Out of memory.
+	*/
+	BT_GRAPH_WAIT_FOR_READINESS_STATUS_MEMORY_ERROR	= __BT_FUNC_STATUS_MEMORY_ERROR,
+
+	/*!
+	@brief
+	    Other error.
+	*/
+	BT_GRAPH_WAIT_FOR_READINESS_STATUS_ERROR	= __BT_FUNC_STATUS_ERROR,
+} bt_graph_wait_for_readiness_status;
+
+/*!
+@brief
+    Waits, for at most \bt_p{max_duration_us} microseconds, until the trace
+    processing graph \bt_p{graph} is likely ready to make progress.
+
+Call this function after bt_graph_run() or bt_graph_run_once() returns
+"try again" instead of sleeping for a fixed duration.
+
+This function returns as soon as one of the following occurs:
+
+- Any readiness file descriptor (see
+  bt_self_message_iterator_set_readiness_fd()) of a \bt_msg_iter which
+  returned "try again" since the last call to this function becomes
+  readable or hangs up.
+
+- \bt_p{max_duration_us} microseconds elapse.
+
+- The current thread receives a signal.
+
+If no message iterator of \bt_p{graph} with a readiness file descriptor
+returned "try again" since the last call to this function, then this
+function only sleeps for \bt_p{max_duration_us} microseconds (or until the
+current thread receives a signal).
+
+On return, \bt_p{graph} forgets the recorded readiness file
+descriptors.
+
+Check whether or not \bt_p{graph} is interrupted (see
+bt_graph_borrow_default_interrupter() and bt_graph_add_interrupter())
+after this function returns.
+
+@param[in] graph
+    Trace processing graph to wait for.
+@param[in] max_duration_us
+    Maximum duration (microseconds) to wait for.
+
+@retval #BT_GRAPH_WAIT_FOR_READINESS_STATUS_OK
+    Success (\bt_p{graph} is likely ready, the maximum duration elapsed,
+    or the current thread received a signal).
+@retval #BT_GRAPH_WAIT_FOR_READINESS_STATUS_MEMORY_ERROR
+    Out of memory.
+@retval #BT_GRAPH_WAIT_FOR_READINESS_STATUS_ERROR
+    Other error.
+
+@bt_pre_not_null{graph}
+@pre
+    \bt_p{graph} is not currently running.
+
+@sa bt_graph_run() &mdash;
+    Runs a trace processing graph.
+@sa bt_graph_run_once() &mdash;
+    Calls a single trace processing graph's sink component's consuming
+    method once.
+*/
+extern bt_graph_wait_for_readiness_status bt_graph_wait_for_readiness(
+		bt_graph *graph, uint64_t max_duration_us) __BT_NOEXCEPT;
+
 /*! @} */
 
 /*!
@@ -1901,6 +1996,234 @@ bt_graph_add_filter_component_output_port_added_listener(
 
 /*! @} */
 
+/*!
+@name Profiling
+@{
+*/
+
+/*!
+@brief
+    Status codes for bt_graph_enable_profiling().
+*/
+typedef enum bt_graph_enable_profiling_status {
+	/*!
+	@brief
+	    Success.
+	*/
+	BT_GRAPH_ENABLE_PROFILING_STATUS_OK		= __BT_FUNC_STATUS_OK,
+
+	/*!
+	@brief
+	    Out of memory.
+	*/
+	BT_GRAPH_ENABLE_PROFILING_STATUS_MEMORY_ERROR	= __BT_FUNC_STATUS_MEMORY_ERROR,
+} bt_graph_enable_profiling_status;
+
+/*!
+@brief
+    Enables the profiling of the trace processing graph \bt_p{graph}.
+
+Once profiling is enabled, \bt_p{graph} records, for each
+\bt_msg_iter:
+
+- The number of calls to its
+  \ref api-msg-iter-cls-meth-next "next method" and how many of them
+  returned
+  #BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_AGAIN.
+
+- The number of returned \bt_p_msg, by type.
+
+- The cumulative time spent in its next method, including
+  (<em>inclusive time</em>) and excluding (<em>self time</em>) the time
+  spent in the next methods of its upstream message iterators.
+
+- The number of bytes it decoded, as reported with
+  bt_self_message_iterator_add_decoded_bytes().
+
+\bt_p{graph} also records the number of calls, the "try again"
+statuses, and the inclusive and self times of the
+\ref api-comp-cls-dev-meth-consume "consuming method" of each
+\bt_sink_comp.
+
+Profiling has a small cost on each method call: don't enable it if you
+don't need the counters.
+
+This function does nothing if the profiling of \bt_p{graph} is
+already enabled.
+
+@param[in] graph
+    Trace processing graph of which to enable the profiling.
+
+@retval #BT_GRAPH_ENABLE_PROFILING_STATUS_OK
+    Success.
+@retval #BT_GRAPH_ENABLE_PROFILING_STATUS_MEMORY_ERROR
+    Out of memory.
+
+@bt_pre_not_null{graph}
+@bt_pre_graph_not_configured{graph}
+
+@sa bt_graph_profiling_is_enabled() &mdash;
+    Returns whether or not the profiling of a trace processing graph
+    is enabled.
+@sa bt_graph_get_profile() &mdash;
+    Returns the profile of a trace processing graph.
+*/
+extern bt_graph_enable_profiling_status bt_graph_enable_profiling(
+		bt_graph *graph) __BT_NOEXCEPT;
+
+/*!
+@brief
+    Returns whether or not the profiling of the trace processing graph
+    \bt_p{graph} is enabled.
+
+@param[in] graph
+    Trace processing graph of which to get whether or not the profiling
+    is enabled.
+
+@returns
+    #BT_TRUE if the profiling of \bt_p{graph} is enabled.
+
+@bt_pre_not_null{graph}
+
+@sa bt_graph_enable_profiling() &mdash;
+    Enables the profiling of a trace processing graph.
+*/
+extern bt_bool bt_graph_profiling_is_enabled(const bt_graph *graph)
+		__BT_NOEXCEPT;
+
+/*!
+@brief
+    Status codes for bt_graph_get_profile().
+*/
+typedef enum bt_graph_get_profile_status {
+	/*!
+	@brief
+	    Success.
+	*/
+	BT_GRAPH_GET_PROFILE_STATUS_OK			= __BT_FUNC_STATUS_OK,
+
+	/*!
+	@brief
+	    Out of memory.
+	*/
+	BT_GRAPH_GET_PROFILE_STATUS_MEMORY_ERROR	= __BT_FUNC_STATUS_MEMORY_ERROR,
+} bt_graph_get_profile_status;
+
+/*!
+@brief
+    Returns the current profile of the trace processing graph
+    \bt_p{graph}.
+
+On success, \bt_p{*profile} is a new map value with a single entry,
+\c components, an array value with one map value per component of
+\bt_p{graph}, in the order in which you added them. Each component
+map value has the following entries:
+
+<dl>
+  <dt>\c name</dt>
+  <dd>Name of the component (string value).</dd>
+
+  <dt>\c class-name</dt>
+  <dd>Name of the class of the component (string value).</dd>
+
+  <dt>\c type</dt>
+  <dd>
+    Type of the component: \c source, \c filter, or \c sink (string
+    value).
+  </dd>
+
+  <dt>\c calls</dt>
+  <dd>
+    Number of calls to the consuming method (sink component) or to the
+    next methods of all its message iterators (unsigned integer value).
+  </dd>
+
+  <dt>\c again-count</dt>
+  <dd>
+    Number of those calls which returned "try again"
+    (unsigned integer value).
+  </dd>
+
+  <dt>\c inclusive-time-ns</dt>
+  <dd>
+    Cumulative time spent in those calls, in nanoseconds
+    (unsigned integer value).
+  </dd>
+
+  <dt>\c self-time-ns</dt>
+  <dd>
+    Part of the inclusive time which wasn't spent in the next methods
+    of upstream message iterators, in nanoseconds
+    (unsigned integer value).
+  </dd>
+
+  <dt>\c message-count</dt>
+  <dd>
+    Source and filter components only: number of messages which its
+    message iterators returned (unsigned integer value).
+  </dd>
+
+  <dt>\c message-counts</dt>
+  <dd>
+    Source and filter components only: map value of which the keys are
+    \c stream-beginning, \c stream-end, \c event,
+    \c packet-beginning, \c packet-end, \c discarded-events,
+    \c discarded-packets, and \c message-iterator-inactivity, and the
+    values are the numbers of returned messages of the corresponding
+    types (unsigned integer values).
+  </dd>
+
+  <dt>\c mean-batch-size</dt>
+  <dd>
+    Source and filter components only: mean number of messages which
+    a successful next method call returned (real value).
+  </dd>
+
+  <dt>\c decoded-bytes</dt>
+  <dd>
+    Source and filter components only: number of bytes which its
+    message iterators decoded (unsigned integer value).
+  </dd>
+
+  <dt>\c message-iterators</dt>
+  <dd>
+    Source and filter components only: array value with one map value
+    per message iterator, in creation order, each one having the
+    counter entries above (\c calls to \c decoded-bytes) for this
+    message iterator only.
+  </dd>
+</dl>
+
+The counters of a message iterator remain part of the profile after
+the message iterator is destroyed.
+
+@param[in] graph
+    Trace processing graph of which to get the profile.
+@param[out] profile
+    <strong>On success</strong>, \bt_p{*profile} is a \em new
+    reference of the profile of \bt_p{graph}.
+
+@retval #BT_GRAPH_GET_PROFILE_STATUS_OK
+    Success.
+@retval #BT_GRAPH_GET_PROFILE_STATUS_MEMORY_ERROR
+    Out of memory.
+
+@bt_pre_not_null{graph}
+@pre
+    The profiling of \bt_p{graph} is enabled
+    (see bt_graph_enable_profiling()).
+@pre
+    \bt_p{graph} is not currently running.
+@bt_pre_not_null{profile}
+
+@sa bt_graph_enable_profiling() &mdash;
+    Enables the profiling of a trace processing graph.
+*/
+extern bt_graph_get_profile_status bt_graph_get_profile(
+		const bt_graph *graph, const bt_value **profile) __BT_NOEXCEPT;
+
+/*! @} */
+
 /*!
 @name Reference count
 @{
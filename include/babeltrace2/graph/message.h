@@ -287,6 +287,10 @@ To create an event message for a given stream, use:
     Those two creation functions accept a \bt_pkt parameter which is
     the packet logically containing the message's event. A packet is
     part of a stream.
+
+    To create many event messages for the same packet at once, use
+    bt_message_event_create_many_with_packet_and_default_clock_snapshot()
+    or bt_message_event_create_many_with_packet().
   </dd>
 
   <dt>
@@ -1757,6 +1761,177 @@ bt_message *bt_message_event_create_with_packet_and_default_clock_snapshot(
 		const bt_packet *packet, uint64_t clock_snapshot_value)
 		__BT_NOEXCEPT;
 
+/*!
+@brief
+    Status codes for bt_message_event_create_many_with_packet() and
+    bt_message_event_create_many_with_packet_and_default_clock_snapshot().
+*/
+typedef enum bt_message_event_create_many_status {
+	/*!
+	@brief
+	    Success.
+	*/
+	BT_MESSAGE_EVENT_CREATE_MANY_STATUS_OK			= __BT_FUNC_STATUS_OK,
+
+	/*!
+	@brief
+	    Out of memory.
+	*/
+	BT_MESSAGE_EVENT_CREATE_MANY_STATUS_MEMORY_ERROR	= __BT_FUNC_STATUS_MEMORY_ERROR,
+} bt_message_event_create_many_status;
+
+/*!
+@brief
+    Creates \bt_p{count} \bt_p_ev_msg, the message at index \em i having
+    an instance of the \bt_ev_cls <code>event_classes[i]</code>, for
+    the \bt_pkt \bt_p{packet} from the \bt_msg_iter
+    \bt_p{self_message_iterator}, and sets the elements of
+    \bt_p{messages} to them.
+
+This function is equivalent to calling
+bt_message_event_create_with_packet() \bt_p{count} times, but it only
+checks the properties of \bt_p{packet} and of its \bt_stream once: use
+it when you have many event messages to create for the same packet,
+for example to fill the message array of the
+\link api-msg-iter-cls-meth-next "next" method\endlink of your message
+iterator in one call.
+
+On failure, this function doesn't create any message: the first
+\bt_p{count} elements of \bt_p{messages} are \c NULL or unchanged.
+
+@param[in] self_message_iterator
+    Self message iterator from which to create the event messages.
+@param[in] event_classes
+    Classes of the \bt_p_ev of the messages to create
+    (\bt_p{count} elements).
+@param[in] packet
+    Packet conceptually containing the events of the messages to
+    create.
+@param[in] count
+    Number of event messages to create.
+@param[out] messages
+    @parblock
+    <strong>On success</strong>, the first \bt_p{count} elements of
+    this array are new event message references.
+
+    This array must have at least \bt_p{count} elements.
+    @endparblock
+
+@retval #BT_MESSAGE_EVENT_CREATE_MANY_STATUS_OK
+    Success.
+@retval #BT_MESSAGE_EVENT_CREATE_MANY_STATUS_MEMORY_ERROR
+    Out of memory.
+
+@bt_pre_not_null{self_message_iterator}
+@bt_pre_not_null{event_classes}
+@pre
+    Each element of \bt_p{event_classes} is not \c NULL and its
+    \bt_stream_cls is also the stream class of \bt_p{packet}.
+@bt_pre_not_null{packet}
+@pre
+    <code>bt_stream_class_supports_packets(bt_stream_borrow_class_const(bt_packet_borrow_stream_const(packet)))</code>
+    returns #BT_TRUE.
+@pre
+    <code>bt_stream_class_borrow_default_clock_class_const(bt_stream_borrow_class_const(bt_packet_borrow_stream_const(packet)))</code>
+    returns \c NULL.
+@pre
+    The \ref api-tir-pkt-prop-ctx "context field" of \bt_p{packet}, if
+    any, and all its contained \bt_p_field, recursively, are set.
+@bt_pre_not_null{messages}
+
+@post
+    <strong>On success</strong>, all the elements of
+    \bt_p{event_classes} are frozen.
+@bt_post_success_frozen{packet}
+
+@sa bt_message_event_create_with_packet() &mdash;
+    Creates a single event message for a given packet.
+*/
+extern bt_message_event_create_many_status
+bt_message_event_create_many_with_packet(
+		bt_self_message_iterator *self_message_iterator,
+		const bt_event_class * const *event_classes,
+		const bt_packet *packet, uint64_t count,
+		bt_message_array_const messages) __BT_NOEXCEPT;
+
+/*!
+@brief
+    Creates \bt_p{count} \bt_p_ev_msg, the message at index \em i having
+    an instance of the \bt_ev_cls <code>event_classes[i]</code> and a
+    default \bt_cs with the value <code>clock_snapshot_values[i]</code>,
+    for the \bt_pkt \bt_p{packet} from the \bt_msg_iter
+    \bt_p{self_message_iterator}, and sets the elements of
+    \bt_p{messages} to them.
+
+This function is equivalent to calling
+bt_message_event_create_with_packet_and_default_clock_snapshot()
+\bt_p{count} times, but it only checks the properties of
+\bt_p{packet} and of its \bt_stream once.
+
+On failure, this function doesn't create any message: the first
+\bt_p{count} elements of \bt_p{messages} are \c NULL or unchanged.
+
+@param[in] self_message_iterator
+    Self message iterator from which to create the event messages.
+@param[in] event_classes
+    Classes of the \bt_p_ev of the messages to create
+    (\bt_p{count} elements).
+@param[in] packet
+    Packet conceptually containing the events of the messages to
+    create.
+@param[in] clock_snapshot_values
+    Values (clock cycles) of the default clock snapshots of the
+    messages to create (\bt_p{count} elements).
+@param[in] count
+    Number of event messages to create.
+@param[out] messages
+    @parblock
+    <strong>On success</strong>, the first \bt_p{count} elements of
+    this array are new event message references.
+
+    This array must have at least \bt_p{count} elements.
+    @endparblock
+
+@retval #BT_MESSAGE_EVENT_CREATE_MANY_STATUS_OK
+    Success.
+@retval #BT_MESSAGE_EVENT_CREATE_MANY_STATUS_MEMORY_ERROR
+    Out of memory.
+
+@bt_pre_not_null{self_message_iterator}
+@bt_pre_not_null{event_classes}
+@pre
+    Each element of \bt_p{event_classes} is not \c NULL and its
+    \bt_stream_cls is also the stream class of \bt_p{packet}.
+@bt_pre_not_null{packet}
+@pre
+    <code>bt_stream_class_supports_packets(bt_stream_borrow_class_const(bt_packet_borrow_stream_const(packet)))</code>
+    returns #BT_TRUE.
+@pre
+    <code>bt_stream_class_borrow_default_clock_class_const(bt_stream_borrow_class_const(bt_packet_borrow_stream_const(packet)))</code>
+    does \em not return \c NULL.
+@pre
+    The \ref api-tir-pkt-prop-ctx "context field" of \bt_p{packet}, if
+    any, and all its contained \bt_p_field, recursively, are set.
+@bt_pre_not_null{clock_snapshot_values}
+@bt_pre_not_null{messages}
+
+@post
+    <strong>On success</strong>, all the elements of
+    \bt_p{event_classes} are frozen.
+@bt_post_success_frozen{packet}
+
+@sa bt_message_event_create_with_packet_and_default_clock_snapshot() &mdash;
+    Creates a single event message with a default clock snapshot for a
+    given packet.
+*/
+extern bt_message_event_create_many_status
+bt_message_event_create_many_with_packet_and_default_clock_snapshot(
+		bt_self_message_iterator *self_message_iterator,
+		const bt_event_class * const *event_classes,
+		const bt_packet *packet,
+		const uint64_t *clock_snapshot_values, uint64_t count,
+		bt_message_array_const messages) __BT_NOEXCEPT;
+
 /*!
 @brief
     Borrows the \bt_ev of the \bt_ev_msg \bt_p{message}.
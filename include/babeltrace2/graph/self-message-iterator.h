@@ -42,6 +42,14 @@ bt_self_message_iterator_get_data().
 Check whether or not a message iterator is interrupted with
 bt_self_message_iterator_is_interrupted().
 
+Check whether or not the library is making a message iterator
+automatically seek a specific time with
+bt_self_message_iterator_is_auto_seeking().
+
+Set the file descriptor which becomes readable when a message iterator
+is ready to make progress with
+bt_self_message_iterator_set_readiness_fd().
+
 Set whether or not a message iterator can seek forward with
 bt_self_message_iterator_configuration_set_can_seek_forward().
 */
@@ -192,6 +200,146 @@ extern bt_bool bt_self_message_iterator_is_interrupted(
 
 /*! @} */
 
+/*!
+@name Automatic seeking
+@{
+*/
+
+/*!
+@brief
+    Returns whether or not the library is currently making the
+    \bt_msg_iter \bt_p{self_message_iterator} automatically seek a
+    specific time and, if so, sets \bt_p{*ns_from_origin} to this time.
+
+When \bt_p{self_message_iterator} has no
+\ref api-msg-iter-cls-meth-seek-ns "seek ns from origin" method, or
+when said method can't seek a given time, but
+\bt_p{self_message_iterator} can seek its beginning and can seek forward
+(see bt_message_iterator_can_seek_forward()),
+bt_message_iterator_seek_ns_from_origin() makes it seek its beginning
+and then calls its \link api-msg-iter-cls-meth-next "next"
+method\endlink repeatedly, discarding any \bt_msg having a
+\bt_cs which occurs before the sought time, until it gets a message
+occurring at or after this time.
+
+Call this function from the \link api-msg-iter-cls-meth-next "next"
+method\endlink of \bt_p{self_message_iterator} to know whether or not
+this is happening: if it is, then the library discards any \bt_ev_msg
+of which the default clock snapshot occurs before
+\bt_p{*ns_from_origin}, so that \bt_p{self_message_iterator} may skip
+creating such messages altogether (for example, the event messages of
+a whole \bt_pkt which ends before \bt_p{*ns_from_origin}).
+
+This is only an optimization opportunity: \bt_p{self_message_iterator}
+must still honour the
+\ref api-msg-seq "message sequence rules", and whether or not it
+creates the skipped event messages must not change the messages which
+the library eventually returns.
+
+@param[in] self_message_iterator
+    Message iterator instance.
+@param[out] ns_from_origin
+    If this function returns #BT_TRUE, <strong>then</strong>
+    \bt_p{*ns_from_origin} is the time, in nanoseconds from origin,
+    which the library is making \bt_p{self_message_iterator}
+    automatically seek.
+
+@returns
+    #BT_TRUE if the library is currently making
+    \bt_p{self_message_iterator} automatically seek a specific time.
+
+@bt_pre_not_null{self_message_iterator}
+@bt_pre_not_null{ns_from_origin}
+
+@sa bt_message_iterator_seek_ns_from_origin() &mdash;
+    Makes a message iterator seek a message occurring at or after a
+    given time.
+*/
+extern bt_bool bt_self_message_iterator_is_auto_seeking(
+		const bt_self_message_iterator *self_message_iterator,
+		int64_t *ns_from_origin) __BT_NOEXCEPT;
+
+/*! @} */
+
+/*!
+@name Readiness
+@{
+*/
+
+/*!
+@brief
+    Sets the readiness file descriptor of the \bt_msg_iter
+    \bt_p{self_message_iterator} to \bt_p{fd}.
+
+When the \ref api-msg-iter-cls-meth-next "next method" of
+\bt_p{self_message_iterator} returns
+#BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_AGAIN and \bt_p{fd} is
+not -1, the trace processing graph records \bt_p{fd} so that
+bt_graph_wait_for_readiness() can wait until \bt_p{fd} becomes
+readable (or hangs up) instead of sleeping for a fixed duration.
+
+In other words, \bt_p{fd} becoming readable is a hint that calling the
+next method of \bt_p{self_message_iterator} again could make progress.
+A message iterator without a readiness file descriptor (the default)
+is simply retried after the waiting duration of
+bt_graph_wait_for_readiness() elapses.
+
+The message iterator keeps the ownership of \bt_p{fd}: make sure to
+reset it to -1 before closing it.
+
+@param[in] self_message_iterator
+    Message iterator instance.
+@param[in] fd
+    New readiness file descriptor of \bt_p{self_message_iterator}, or
+    -1 to remove it.
+
+@bt_pre_not_null{self_message_iterator}
+@pre
+    \bt_p{fd} is greater than or equal to -1.
+
+@sa bt_graph_wait_for_readiness() &mdash;
+    Waits until a trace processing graph is ready to make progress.
+*/
+extern void bt_self_message_iterator_set_readiness_fd(
+		bt_self_message_iterator *self_message_iterator, int fd)
+		__BT_NOEXCEPT;
+
+/*! @} */
+
+/*!
+@name Profiling
+@{
+*/
+
+/*!
+@brief
+    Adds \bt_p{count} to the number of bytes which the \bt_msg_iter
+    \bt_p{self_message_iterator} decoded from its data source.
+
+When the profiling of the trace processing graph is enabled (see
+bt_graph_enable_profiling()), the graph reports this number as the
+\c decoded-bytes entry of the message iterator profile (see
+bt_graph_get_profile()).
+
+This function does nothing when profiling is disabled, so that you
+can always call it.
+
+@param[in] self_message_iterator
+    Message iterator instance.
+@param[in] count
+    Number of bytes to add.
+
+@bt_pre_not_null{self_message_iterator}
+
+@sa bt_graph_get_profile() &mdash;
+    Returns the profile of a trace processing graph.
+*/
+extern void bt_self_message_iterator_add_decoded_bytes(
+		bt_self_message_iterator *self_message_iterator,
+		uint64_t count) __BT_NOEXCEPT;
+
+/*! @} */
+
 /*!
 @name Configuration
 @{
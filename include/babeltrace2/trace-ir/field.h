@@ -316,6 +316,10 @@ bt_field_string_append() and bt_field_string_append_with_length().
 
 Clear a string field with bt_field_string_clear().
 
+Make a string field borrow its value, instead of copying it, with
+bt_field_string_set_borrowed_value(): see
+\ref api-tir-field-borrowed-data "Borrowed data".
+
 <h1>\anchor api-tir-field-blob BLOB fields</h1>
 
 <strong><em>BLOB fields</em></strong> are \bt_blob_fc instances.
@@ -358,6 +362,43 @@ Get a BLOB field's length with bt_field_blob_get_length().
 Get the data of a BLOB field with bt_field_blob_get_data()
 or bt_field_blob_get_data_const().
 
+Make a BLOB field borrow its data, instead of copying it, with
+bt_field_blob_set_borrowed_data(): see
+\ref api-tir-field-borrowed-data "Borrowed data".
+
+<h1>\anchor api-tir-field-borrowed-data Borrowed data</h1>
+
+A \bt_string_field or a \bt_blob_field may <em>borrow</em> its value
+or data from a buffer which its user owns, instead of containing a copy
+of it. This is useful for a \bt_src_comp which already has the
+bytes of large strings or BLOBs in memory (for example, in a
+memory-mapped file) to avoid copying them.
+
+When you make a field borrow some data, you also pass a release
+function and its user data. The field calls the release function
+exactly once, when it doesn't need the borrowed data anymore, that is,
+when:
+
+- You set the value or the data of the field again, including through
+  another call to bt_field_string_set_borrowed_value() or
+  bt_field_blob_set_borrowed_data().
+
+- You get the writable data of the BLOB field with
+  bt_field_blob_get_data(), or you append to or clear the string field.
+  In that case, the field first copies the borrowed data to its own
+  storage (copy on write).
+
+- The library recycles the \bt_ev or \bt_pkt which contains the
+  field, for example when the last reference to its \bt_msg is put.
+
+- The field is destroyed.
+
+Until the field calls the release function, the borrowed data must
+remain valid and must not change. The field calls the release function
+on the thread which modifies, recycles, or destroys it. A typical
+release function decrements the reference count of the buffer which
+contains the borrowed data.
+
 <h1>\anchor api-tir-field-array Array fields</h1>
 
 <strong><em>Array fields</em></strong> are \bt_array_fc instances.
@@ -1180,6 +1221,71 @@ extern bt_field_string_append_status bt_field_string_append_with_length(
 */
 extern void bt_field_string_clear(bt_field *field) __BT_NOEXCEPT;
 
+/*!
+@brief
+    User function which releases the data which a \bt_string_field or
+    a \bt_blob_field borrowed.
+
+See \ref api-tir-field-borrowed-data "Borrowed data" to learn more.
+
+@param[in] user_data
+    User data, as passed as the \bt_p{user_data} parameter of
+    bt_field_string_set_borrowed_value() or
+    bt_field_blob_set_borrowed_data().
+
+@bt_post_no_error
+
+@sa bt_field_string_set_borrowed_value() &mdash;
+    Makes a string field borrow its value.
+@sa bt_field_blob_set_borrowed_data() &mdash;
+    Makes a BLOB field borrow its data.
+*/
+typedef void (*bt_field_borrowed_data_release_func)(void *user_data);
+
+/*!
+@brief
+    Sets the value of the \bt_string_field \bt_p{field} to
+    the first \bt_p{length} bytes of \bt_p{value}, \em without copying
+    them.
+
+\bt_p{field} borrows \bt_p{value} until it calls
+\bt_p{release_func} with \bt_p{user_data}: see
+\ref api-tir-field-borrowed-data "Borrowed data".
+
+The byte at <code>value[length]</code> must be a null character so
+that bt_field_string_get_value() may return \bt_p{value} directly.
+
+@param[in] field
+    String field of which to set the value to \bt_p{value}.
+@param[in] value
+    New value of \bt_p{field} (borrowed).
+@param[in] length
+    Number of bytes of \bt_p{value}, excluding the terminating null
+    character.
+@param[in] release_func
+    User function which \bt_p{field} calls when it doesn't need
+    \bt_p{value} anymore.
+@param[in] user_data
+    User data to pass to \bt_p{release_func}.
+
+@bt_pre_not_null{field}
+@bt_pre_is_string_field{field}
+@bt_pre_hot{field}
+@bt_pre_not_null{value}
+@pre
+    The first \bt_p{length} bytes of \bt_p{value} contain no null
+    character and <code>value[length]</code> is a null character.
+@pre
+    \bt_p{release_func} is not \c NULL.
+
+@sa bt_field_string_set_value() &mdash;
+    Sets the value of a string field to a copy of a string.
+*/
+extern void bt_field_string_set_borrowed_value(bt_field *field,
+		const char *value, uint64_t length,
+		bt_field_borrowed_data_release_func release_func,
+		void *user_data) __BT_NOEXCEPT;
+
 /*! @} */
 
 /*!
@@ -1296,6 +1402,49 @@ typedef enum bt_field_blob_dynamic_set_length_status {
 extern bt_field_blob_dynamic_set_length_status bt_field_blob_dynamic_set_length(
 		bt_field *field, uint64_t length);
 
+/*!
+@brief
+    Makes the \bt_blob_field \bt_p{field} borrow its data from
+    \bt_p{data}, \em without copying it.
+
+\bt_p{field} borrows \bt_p{data} until it calls
+\bt_p{release_func} with \bt_p{user_data}: see
+\ref api-tir-field-borrowed-data "Borrowed data".
+
+This function doesn't change the length of \bt_p{field}: \bt_p{data}
+must contain at least bt_field_blob_get_length() bytes.
+
+@attention
+    If \bt_p{field} is a dynamic BLOB field, then it must have a length
+    (call bt_field_blob_dynamic_set_length()) before you call this
+    function.
+
+@param[in] field
+    BLOB field of which to set the data to \bt_p{data}.
+@param[in] data
+    New data of \bt_p{field} (borrowed).
+@param[in] release_func
+    User function which \bt_p{field} calls when it doesn't need
+    \bt_p{data} anymore.
+@param[in] user_data
+    User data to pass to \bt_p{release_func}.
+
+@bt_pre_not_null{field}
+@bt_pre_is_blob_field{field}
+@bt_pre_hot{field}
+@bt_pre_field_with_mip{field, 1}
+@bt_pre_not_null{data}
+@pre
+    \bt_p{release_func} is not \c NULL.
+
+@sa bt_field_blob_get_data() &mdash;
+    Returns the writable data of a BLOB field.
+*/
+extern void bt_field_blob_set_borrowed_data(bt_field *field,
+		const uint8_t *data,
+		bt_field_borrowed_data_release_func release_func,
+		void *user_data) __BT_NOEXCEPT;
+
 /*! @} */
 
 /*!
@@ -196,7 +196,7 @@ from bt2.field_class import (
 from bt2.interrupter import Interrupter
 from bt2.clock_snapshot import _ClockSnapshotConst, _UnknownClockSnapshot
 from bt2.query_executor import QueryExecutor
-from bt2.message_iterator import _UserMessageIterator
+from bt2.message_iterator import _MessageBatchConst, _UserMessageIterator
 from bt2.integer_range_set import (
     SignedIntegerRange,
     UnsignedIntegerRange,
@@ -208,6 +208,7 @@ from bt2.integer_range_set import (
     _UnsignedIntegerRangeSetConst,
 )
 from bt2.component_descriptor import ComponentDescriptor
+from bt2.event_columns import EventColumnReader
 from bt2.trace_collection_message_iterator import (
     ComponentSpec,
     AutoSourceComponentSpec,
@@ -229,6 +230,7 @@ if (sys.version_info.major, sys.version_info.minor) != (3, 4):
     _del_global_name("error")
     _del_global_name("event")
     _del_global_name("event_class")
+    _del_global_name("event_columns")
     _del_global_name("field")
     _del_global_name("field_class")
     _del_global_name("field_path")
@@ -466,6 +466,16 @@ def _trim_docstring(docstring):
 # (again, do NOT use __del__()), which don't accept any parameters
 # other than `self`.
 #
+# Instead of __next__(), it can implement the _user_next_batch() method
+# to return more than one message at once:
+#
+#     def _user_next_batch(self, capacity):
+#         ...
+#
+# This method must return an iterable of at least one and at most
+# `capacity` messages, or raise `bt2.Stop` or `bt2.TryAgain` like
+# __next__() does.
+#
 # When the user-defined class is destroyed, this metaclass's __del__()
 # method is called: the native BT component class pointer is put (not
 # needed anymore, at least not by any Python code since all references
@@ -0,0 +1,138 @@
+# SPDX-License-Identifier: MIT
+#
+# Copyright (c) 2024 EfficiOS, Inc.
+
+from bt2 import utils as bt2_utils
+from bt2 import native_bt
+
+typing = bt2_utils._typing_mod
+
+_SCOPES = frozenset(["payload", "specific-context", "common-context", "packet-context"])
+_SPECIAL_COLUMNS = frozenset(["timestamp", "event-class-id"])
+_FORMATS = frozenset(["q", "Q", "d"])
+
+
+# Reads event messages into preallocated, contiguous column buffers.
+#
+# Each column is either:
+#
+# `"timestamp"`:
+#     Default clock snapshot of the event message, in nanoseconds from
+#     origin (signed), or 0 without a default clock.
+#
+# `"event-class-id"`:
+#     Numeric ID of the event class.
+#
+# A tuple `(SCOPE, NAME, ...)`:
+#     Boolean, integer, or real field found by following the structure
+#     member names `NAME, ...` from the scope field `SCOPE` (one of
+#     `"payload"`, `"specific-context"`, `"common-context"`, or
+#     `"packet-context"`).
+#
+#     The value is 0 when the event class doesn't have such a field.
+#
+# The buffer of each column is a `bytearray` of `capacity` 8-byte items,
+# exposed as a `memoryview` with the corresponding format (`q`: signed
+# 64-bit integer, `Q`: unsigned 64-bit integer, `d`: double; default:
+# `q`), so that you can wrap it without copying (for example, with
+# `numpy.frombuffer()`).
+class EventColumnReader:
+    def __init__(
+        self,
+        columns: typing.Iterable[typing.Union[str, typing.Sequence[str]]],
+        capacity: int,
+        event_class_names: typing.Optional[typing.Iterable[str]] = None,
+        formats: typing.Optional[typing.Iterable[str]] = None,
+    ):
+        bt2_utils._check_uint64(capacity)
+
+        if capacity == 0:
+            raise ValueError("capacity must be greater than 0")
+
+        native_columns = []
+
+        for column in columns:
+            if type(column) is str:
+                if column not in _SPECIAL_COLUMNS:
+                    raise ValueError("unknown special column: `{}`".format(column))
+
+                native_columns.append((column,))
+                continue
+
+            column = tuple(column)
+
+            if len(column) < 2:
+                raise ValueError(
+                    "field column needs a scope and at least one member name"
+                )
+
+            for name in column:
+                bt2_utils._check_str(name)
+
+            if column[0] not in _SCOPES:
+                raise ValueError("unknown field scope: `{}`".format(column[0]))
+
+            native_columns.append(column)
+
+        if len(native_columns) == 0:
+            raise ValueError("no columns")
+
+        if formats is None:
+            formats = ["q"] * len(native_columns)
+        else:
+            formats = list(formats)
+
+            if len(formats) != len(native_columns):
+                raise ValueError("format count doesn't match column count")
+
+            for fmt in formats:
+                if fmt not in _FORMATS:
+                    raise ValueError("unknown column format: `{}`".format(fmt))
+
+        if event_class_names is not None:
+            event_class_names = list(event_class_names)
+
+            for name in event_class_names:
+                bt2_utils._check_str(name)
+
+        self._capsule = native_bt.bt2_event_column_reader_create(
+            native_columns, event_class_names
+        )
+        self._columns = [
+            memoryview(bytearray(capacity * 8)).cast(fmt) for fmt in formats
+        ]
+        self._capacity = capacity
+        self._count = 0
+
+    @property
+    def capacity(self) -> int:
+        return self._capacity
+
+    # Number of rows of the last read.
+    @property
+    def count(self) -> int:
+        return self._count
+
+    # Column buffers (full capacity).
+    @property
+    def buffers(self) -> typing.List[memoryview]:
+        return self._columns
+
+    # Column `index` of the last read (`count` items, no copy).
+    def __getitem__(self, index: int) -> memoryview:
+        return self._columns[index][: self._count]
+
+    def __len__(self) -> int:
+        return len(self._columns)
+
+    def _read(self, msg_iter_ptr, pending_msgs, pending_at, is_ended):
+        status, count, remaining_msgs = native_bt.bt2_message_iterator_fill_event_columns(
+            msg_iter_ptr,
+            self._capsule,
+            pending_msgs,
+            pending_at,
+            int(is_ended),
+            self._columns,
+        )
+        self._count = count
+        return status, remaining_msgs
@@ -18,6 +18,11 @@ def _create_from_ptr(ptr):
     return _MESSAGE_TYPE_TO_CLS[msg_type]._create_from_ptr(ptr)
 
 
+def _create_from_ptr_and_get_ref(ptr):
+    msg_type = native_bt.message_get_type(ptr)
+    return _MESSAGE_TYPE_TO_CLS[msg_type]._create_from_ptr_and_get_ref(ptr)
+
+
 class _MessageConst(bt2_object._SharedObject):
     @staticmethod
     def _get_ref(ptr):
@@ -320,3 +325,19 @@ _MESSAGE_TYPE_TO_CLS = {
     native_bt.MESSAGE_TYPE_DISCARDED_EVENTS: _DiscardedEventsMessageConst,
     native_bt.MESSAGE_TYPE_DISCARDED_PACKETS: _DiscardedPacketsMessageConst,
 }
+
+
+# Base of a message class of which the objects don't own any reference
+# to their native message.
+#
+# _MessageBatchConst.iter_borrowed() reuses a single object of such a
+# class per message type, changing its native pointer for each message.
+class _BorrowedMessageConst:
+    def __del__(self):
+        pass
+
+
+_MESSAGE_TYPE_TO_BORROWED_CLS = {
+    msg_type: type(cls.__name__, (_BorrowedMessageConst, cls), {})
+    for msg_type, cls in _MESSAGE_TYPE_TO_CLS.items()
+}
@@ -14,6 +14,7 @@ from bt2 import message as bt2_message
 from bt2 import native_bt
 from bt2 import clock_class as bt2_clock_class
 from bt2 import event_class as bt2_event_class
+from bt2 import event_columns as bt2_event_columns
 
 typing = bt2_utils._typing_mod
 
@@ -26,6 +27,70 @@ class _MessageIterator(collections.abc.Iterator):
         raise NotImplementedError
 
 
+# Read-only sequence of the messages of a batch, as returned by
+# _UserComponentInputPortMessageIterator.next_batch().
+#
+# A batch owns one reference to each of its native messages. It only
+# creates the object of a message when accessing it by index, and then
+# always returns this same object for this index.
+class _MessageBatchConst(collections.abc.Sequence):
+    def __init__(self, msg_ptrs):
+        # Native messages (owned references)
+        self._msg_ptrs = msg_ptrs
+
+        # Message objects, created lazily
+        self._msgs = [None] * len(msg_ptrs)
+
+    def __del__(self):
+        for msg_ptr in getattr(self, "_msg_ptrs", ()):
+            native_bt.message_put_ref(msg_ptr)
+
+    def __len__(self) -> int:
+        return len(self._msg_ptrs)
+
+    def __getitem__(self, index):
+        if isinstance(index, slice):
+            return [self[i] for i in range(*index.indices(len(self)))]
+
+        # This raises `IndexError` if `index` is out of range
+        msg = self._msgs[index]
+
+        if msg is None:
+            msg = bt2_message._create_from_ptr_and_get_ref(self._msg_ptrs[index])
+            self._msgs[index] = msg
+
+        return msg
+
+    # Iterates the messages of this batch without creating one object
+    # per message: this generator reuses a single object per message
+    # type, which doesn't own any reference to its native message.
+    #
+    # Therefore, a yielded message object is only valid until the next
+    # iteration: don't keep it. Objects which you borrow from it (its
+    # event or stream, for example) remain valid.
+    def iter_borrowed(self) -> typing.Iterator[bt2_message._MessageConst]:
+        borrowed_msgs = {}
+
+        try:
+            for msg_ptr in self._msg_ptrs:
+                msg_type = native_bt.message_get_type(msg_ptr)
+                msg = borrowed_msgs.get(msg_type)
+
+                if msg is None:
+                    msg = bt2_message._MESSAGE_TYPE_TO_BORROWED_CLS[
+                        msg_type
+                    ]._create_from_ptr(msg_ptr)
+                    borrowed_msgs[msg_type] = msg
+                else:
+                    msg._ptr_internal = msg_ptr
+
+                yield msg
+        finally:
+            # Make any kept object unusable rather than dangling
+            for msg in borrowed_msgs.values():
+                msg._ptr_internal = None
+
+
 class _UserComponentInputPortMessageIterator(
     bt2_object._SharedObject, _MessageIterator
 ):
@@ -40,24 +105,88 @@ class _UserComponentInputPortMessageIterator(
     def __init__(self, ptr):
         self._current_msgs = []
         self._at = 0
+        self._is_ended = False
         super().__init__(ptr)
 
-    def __next__(self) -> bt2_message._MessageConst:
+    # Makes sure that `self._current_msgs` contains at least one
+    # message from `self._at`, getting the next native batch if needed.
+    def _ensure_current_msgs(self):
         if len(self._current_msgs) == self._at:
+            if self._is_ended:
+                raise bt2_utils.Stop
+
             status, msgs = native_bt.bt2_self_component_port_input_get_msg_range(
                 self._ptr
             )
+
+            if status == native_bt.__BT_FUNC_STATUS_END:
+                self._is_ended = True
+
             bt2_utils._handle_func_status(
                 status, "unexpected error: cannot advance the message iterator"
             )
             self._current_msgs = msgs
             self._at = 0
 
+    def __next__(self) -> bt2_message._MessageConst:
+        self._ensure_current_msgs()
         msg_ptr = self._current_msgs[self._at]
         self._at += 1
 
         return bt2_message._create_from_ptr(msg_ptr)
 
+    # Returns all the next available messages (at least one) as a
+    # `_MessageBatchConst` object, without creating any message object.
+    #
+    # Raises `bt2.Stop` when there are no more messages and
+    # `bt2.TryAgain` when no message is available yet.
+    def next_batch(self) -> _MessageBatchConst:
+        self._ensure_current_msgs()
+
+        if self._at == 0:
+            msg_ptrs = self._current_msgs
+        else:
+            msg_ptrs = self._current_msgs[self._at :]
+
+        # The batch now owns the references of those messages
+        self._current_msgs = []
+        self._at = 0
+        return _MessageBatchConst(msg_ptrs)
+
+    # Reads the next event messages into the column buffers of `reader`
+    # without creating any message object, returning the number of
+    # written rows (at least one).
+    #
+    # Raises `bt2.Stop` when there are no more messages and
+    # `bt2.TryAgain` when no row is available yet.
+    def read_event_columns(self, reader: bt2_event_columns.EventColumnReader) -> int:
+        bt2_utils._check_type(reader, bt2_event_columns.EventColumnReader)
+
+        if len(self._current_msgs) == self._at and self._is_ended:
+            raise bt2_utils.Stop
+
+        pending_msgs = self._current_msgs
+        pending_at = self._at
+
+        # On failure, the native part may already have put the
+        # references of the pending messages: forget them.
+        self._current_msgs = []
+        self._at = 0
+        status, self._current_msgs = reader._read(
+            self._ptr, pending_msgs, pending_at, self._is_ended
+        )
+
+        if status == native_bt.__BT_FUNC_STATUS_END:
+            self._is_ended = True
+
+            if reader.count > 0:
+                return reader.count
+
+        bt2_utils._handle_func_status(
+            status, "unexpected error: cannot advance the message iterator"
+        )
+        return reader.count
+
     def can_seek_beginning(self) -> bool:
         (status, res) = native_bt.message_iterator_can_seek_beginning(self._ptr)
         bt2_utils._handle_func_status(
@@ -70,6 +199,7 @@ class _UserComponentInputPortMessageIterator(
         # Forget about buffered messages, they won't be valid after seeking.
         self._current_msgs.clear()
         self._at = 0
+        self._is_ended = False
 
         status = native_bt.message_iterator_seek_beginning(self._ptr)
         bt2_utils._handle_func_status(status, "cannot seek message iterator beginning")
@@ -91,6 +221,7 @@ class _UserComponentInputPortMessageIterator(
         # Forget about buffered messages, they won't be valid after seeking.
         self._current_msgs.clear()
         self._at = 0
+        self._is_ended = False
 
         status = native_bt.message_iterator_seek_ns_from_origin(
             self._ptr, ns_from_origin
@@ -144,6 +275,10 @@ class _UserMessageIterator(_MessageIterator):
             self_output_port_ptr, native_bt.PORT_TYPE_OUTPUT
         )
         config = _MessageIteratorConfiguration(config_ptr)
+
+        # Bound _user_next_batch() method, if any: looked up once here
+        # instead of for each "next" call.
+        self._bt_user_next_batch = getattr(self, "_user_next_batch", None)
         self.__init__(config, self_output_port)
 
     def __init__(self, config, self_output_port):
@@ -175,8 +310,11 @@ class _UserMessageIterator(_MessageIterator):
     def __next__(self) -> bt2_message._MessageConst:
         raise bt2_utils.Stop
 
-    def _bt_next_from_native(self):
+    def _bt_next_from_native(self, capacity):
         # this can raise anything: it's caught by the native part
+        if self._bt_user_next_batch is not None:
+            return self._bt_next_batch_from_native(capacity)
+
         try:
             msg = next(self)
         except StopIteration:
@@ -192,6 +330,38 @@ class _UserMessageIterator(_MessageIterator):
         msg._get_ref(msg._ptr)
         return int(msg._ptr)
 
+    def _bt_next_batch_from_native(self, capacity):
+        # The user's _user_next_batch() method returns an iterable of
+        # at least one and at most `capacity` messages.
+        try:
+            msgs = tuple(self._bt_user_next_batch(capacity))
+        except StopIteration:
+            raise bt2_utils.Stop
+        except Exception:
+            raise
+
+        if len(msgs) == 0 or len(msgs) > capacity:
+            raise ValueError(
+                "_user_next_batch() returned {} messages: expecting between 1 and {}".format(
+                    len(msgs), capacity
+                )
+            )
+
+        # Check all the types before acquiring any reference so that
+        # we don't leak references if one message is invalid.
+        for msg in msgs:
+            bt2_utils._check_type(msg, bt2_message._MessageConst)
+
+        # Same as in _bt_next_from_native(): the message array takes
+        # those references.
+        ptrs = []
+
+        for msg in msgs:
+            msg._get_ref(msg._ptr)
+            ptrs.append(int(msg._ptr))
+
+        return ptrs
+
     def _bt_can_seek_beginning_from_native(self):
         # Here, we mimic the behavior of the C API:
         #
@@ -220,6 +220,7 @@ void bt_bt2_exit_handler(void);
 %include "native_bt_error.i"
 %include "native_bt_event.i"
 %include "native_bt_event_class.i"
+%include "native_bt_event_columns.i"
 %include "native_bt_field.i"
 %include "native_bt_field_class.i"
 %include "native_bt_field_path.i"
@@ -1161,20 +1161,42 @@ component_class_message_iterator_next(bt_self_message_iterator *message_iterator
     PyObject *py_method_result = NULL;
 
     BT_ASSERT_DBG(py_message_iter);
-    py_method_result = PyObject_CallMethod(py_message_iter, "_bt_next_from_native", NULL);
+    py_method_result = PyObject_CallMethod(py_message_iter, "_bt_next_from_native", "K",
+                                           static_cast<unsigned long long>(capacity));
     if (!py_method_result) {
         status = static_cast<bt_message_iterator_class_next_method_status>(
             py_exc_to_status_message_iterator_clear(message_iterator));
         goto end;
     }
 
-    /*
-     * The returned object, on success, is an integer object
-     * (PyLong) containing the address of a native message
-     * object (which is now ours).
-     */
-    msgs[0] = static_cast<const bt_message *>(PyLong_AsVoidPtr(py_method_result));
-    *count = 1;
+    if (PyLong_Check(py_method_result)) {
+        /*
+         * The returned object, on success, is an integer object
+         * (PyLong) containing the address of a native message
+         * object (which is now ours).
+         */
+        msgs[0] = static_cast<const bt_message *>(PyLong_AsVoidPtr(py_method_result));
+        *count = 1;
+    } else {
+        /*
+         * The user message iterator implements _user_next_batch():
+         * the returned object, on success, is a list of at least one
+         * and at most `capacity` integer objects, each one containing
+         * the address of a native message object (which is now ours).
+         */
+        BT_ASSERT_DBG(PyList_Check(py_method_result));
+
+        const auto len = PyList_GET_SIZE(py_method_result);
+
+        BT_ASSERT_DBG(len > 0 && static_cast<uint64_t>(len) <= capacity);
+
+        for (Py_ssize_t i = 0; i < len; ++i) {
+            msgs[i] = static_cast<const bt_message *>(
+                PyLong_AsVoidPtr(PyList_GET_ITEM(py_method_result, i)));
+        }
+
+        *count = static_cast<uint64_t>(len);
+    }
 
     /* Overflow errors should never happen. */
     BT_ASSERT_DBG(!PyErr_Occurred());
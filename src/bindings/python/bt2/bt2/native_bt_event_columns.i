@@ -0,0 +1,17 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS, Inc.
+ */
+
+/* Helper functions for Python */
+%{
+#include "native_bt_event_columns.i.hpp"
+%}
+
+PyObject *bt_bt2_event_column_reader_create(PyObject *py_columns,
+		PyObject *py_event_class_names);
+PyObject *bt_bt2_message_iterator_fill_event_columns(
+		bt_message_iterator *iter, PyObject *py_reader,
+		PyObject *py_pending_msgs, uint64_t pending_at,
+		int is_ended, PyObject *py_buffers);
@@ -0,0 +1,657 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS, Inc.
+ */
+
+#ifndef BABELTRACE_BINDINGS_PYTHON_BT2_BT2_NATIVE_BT_EVENT_COLUMNS_I_HPP
+#define BABELTRACE_BINDINGS_PYTHON_BT2_BT2_NATIVE_BT_EVENT_COLUMNS_I_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/*
+ * Native part of `bt2.EventColumnReader`.
+ *
+ * An event column reader drains event messages from a message iterator
+ * and writes, for each event message of a selected event class, one
+ * value per column into caller-provided, contiguous, writable buffers
+ * (Python buffer protocol), without creating any Python object per
+ * message.
+ */
+
+#define BT_BT2_EVENT_COLUMN_READER_CAPSULE_NAME "bt2.EventColumnReader"
+
+namespace {
+
+enum class EventColumnKind
+{
+    TIMESTAMP,
+    EVENT_CLASS_ID,
+    PAYLOAD,
+    SPECIFIC_CONTEXT,
+    COMMON_CONTEXT,
+    PACKET_CONTEXT,
+};
+
+/* Kind of a resolved leaf field */
+enum class EventColumnLeafKind
+{
+    NONE,
+    BOOL,
+    UNSIGNED_INTEGER,
+    SIGNED_INTEGER,
+    SINGLE_PRECISION_REAL,
+    DOUBLE_PRECISION_REAL,
+};
+
+struct EventColumnSpec
+{
+    EventColumnKind kind;
+
+    /* Structure member names from the scope field (field columns only) */
+    std::vector<std::string> memberNames;
+};
+
+/* Column resolved for a specific event class */
+struct EventColumnResolved
+{
+    EventColumnLeafKind leafKind = EventColumnLeafKind::NONE;
+
+    /* Structure member indexes from the scope field */
+    std::vector<uint64_t> memberIndexes;
+};
+
+/* Cached state for a specific event class */
+struct EventColumnEventClassEntry
+{
+    bool selected = false;
+    std::vector<EventColumnResolved> columns;
+};
+
+struct EventColumnReader
+{
+    ~EventColumnReader()
+    {
+        for (auto& ecAndEntry : eventClasses) {
+            bt_event_class_put_ref(ecAndEntry.first);
+        }
+    }
+
+    std::vector<EventColumnSpec> columns;
+    bool allEventClasses = true;
+    std::unordered_set<std::string> eventClassNames;
+
+    /* Event classes are strong references (put in the destructor) */
+    std::unordered_map<const bt_event_class *, EventColumnEventClassEntry> eventClasses;
+};
+
+/* Writable buffer of a single column */
+struct EventColumnBuffer
+{
+    Py_buffer view;
+    char format;
+};
+
+} /* namespace */
+
+static void event_column_reader_capsule_destroy(PyObject *py_capsule)
+{
+    delete static_cast<EventColumnReader *>(
+        PyCapsule_GetPointer(py_capsule, BT_BT2_EVENT_COLUMN_READER_CAPSULE_NAME));
+}
+
+static bool event_column_kind_from_py_str(PyObject *py_str, EventColumnKind& kind)
+{
+    const char *str = PyUnicode_AsUTF8(py_str);
+
+    if (!str) {
+        return false;
+    }
+
+    if (strcmp(str, "timestamp") == 0) {
+        kind = EventColumnKind::TIMESTAMP;
+    } else if (strcmp(str, "event-class-id") == 0) {
+        kind = EventColumnKind::EVENT_CLASS_ID;
+    } else if (strcmp(str, "payload") == 0) {
+        kind = EventColumnKind::PAYLOAD;
+    } else if (strcmp(str, "specific-context") == 0) {
+        kind = EventColumnKind::SPECIFIC_CONTEXT;
+    } else if (strcmp(str, "common-context") == 0) {
+        kind = EventColumnKind::COMMON_CONTEXT;
+    } else if (strcmp(str, "packet-context") == 0) {
+        kind = EventColumnKind::PACKET_CONTEXT;
+    } else {
+        PyErr_Format(PyExc_ValueError, "unknown event column scope: `%s`", str);
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * Creates an event column reader capsule.
+ *
+ * `py_columns` is a list of tuples of strings: the first string is the
+ * column kind or field scope, and the following ones are structure
+ * member names from the scope field.
+ *
+ * `py_event_class_names` is a list of event class names to select, or
+ * `None` to select all the event classes.
+ *
+ * The Python side validates the types of the parameters.
+ */
+static PyObject *bt_bt2_event_column_reader_create(PyObject *py_columns,
+                                                   PyObject *py_event_class_names)
+{
+    BT_ASSERT(PyList_Check(py_columns));
+
+    const auto reader = new EventColumnReader;
+
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(py_columns); ++i) {
+        PyObject *py_column = PyList_GET_ITEM(py_columns, i);
+        EventColumnSpec spec;
+
+        BT_ASSERT(PyTuple_Check(py_column) && PyTuple_GET_SIZE(py_column) >= 1);
+
+        if (!event_column_kind_from_py_str(PyTuple_GET_ITEM(py_column, 0), spec.kind)) {
+            goto error;
+        }
+
+        for (Py_ssize_t j = 1; j < PyTuple_GET_SIZE(py_column); ++j) {
+            const char *name = PyUnicode_AsUTF8(PyTuple_GET_ITEM(py_column, j));
+
+            if (!name) {
+                goto error;
+            }
+
+            spec.memberNames.emplace_back(name);
+        }
+
+        reader->columns.emplace_back(std::move(spec));
+    }
+
+    if (py_event_class_names != Py_None) {
+        BT_ASSERT(PyList_Check(py_event_class_names));
+        reader->allEventClasses = false;
+
+        for (Py_ssize_t i = 0; i < PyList_GET_SIZE(py_event_class_names); ++i) {
+            const char *name = PyUnicode_AsUTF8(PyList_GET_ITEM(py_event_class_names, i));
+
+            if (!name) {
+                goto error;
+            }
+
+            reader->eventClassNames.emplace(name);
+        }
+    }
+
+    {
+        PyObject *py_capsule = PyCapsule_New(reader, BT_BT2_EVENT_COLUMN_READER_CAPSULE_NAME,
+                                             event_column_reader_capsule_destroy);
+
+        if (!py_capsule) {
+            goto error;
+        }
+
+        return py_capsule;
+    }
+
+error:
+    delete reader;
+    return NULL;
+}
+
+static const bt_field_class *event_column_scope_field_class(const bt_event_class *ec,
+                                                            const EventColumnKind kind)
+{
+    switch (kind) {
+    case EventColumnKind::PAYLOAD:
+        return bt_event_class_borrow_payload_field_class_const(ec);
+    case EventColumnKind::SPECIFIC_CONTEXT:
+        return bt_event_class_borrow_specific_context_field_class_const(ec);
+    case EventColumnKind::COMMON_CONTEXT:
+        return bt_stream_class_borrow_event_common_context_field_class_const(
+            bt_event_class_borrow_stream_class_const(ec));
+    case EventColumnKind::PACKET_CONTEXT:
+        return bt_stream_class_borrow_packet_context_field_class_const(
+            bt_event_class_borrow_stream_class_const(ec));
+    default:
+        bt_common_abort();
+    }
+}
+
+static EventColumnLeafKind event_column_leaf_kind(const bt_field_class *fc)
+{
+    const auto type = bt_field_class_get_type(fc);
+
+    if (type == BT_FIELD_CLASS_TYPE_BOOL) {
+        return EventColumnLeafKind::BOOL;
+    } else if (bt_field_class_type_is(type, BT_FIELD_CLASS_TYPE_UNSIGNED_INTEGER)) {
+        return EventColumnLeafKind::UNSIGNED_INTEGER;
+    } else if (bt_field_class_type_is(type, BT_FIELD_CLASS_TYPE_SIGNED_INTEGER)) {
+        return EventColumnLeafKind::SIGNED_INTEGER;
+    } else if (type == BT_FIELD_CLASS_TYPE_SINGLE_PRECISION_REAL) {
+        return EventColumnLeafKind::SINGLE_PRECISION_REAL;
+    } else if (type == BT_FIELD_CLASS_TYPE_DOUBLE_PRECISION_REAL) {
+        return EventColumnLeafKind::DOUBLE_PRECISION_REAL;
+    }
+
+    return EventColumnLeafKind::NONE;
+}
+
+/*
+ * Resolves the field column `spec` for the event class `ec`.
+ *
+ * The resolved leaf kind is `EventColumnLeafKind::NONE` when the field
+ * doesn't exist or isn't a boolean, integer, or real field.
+ */
+static EventColumnResolved event_column_resolve(const bt_event_class *ec,
+                                                const EventColumnSpec& spec)
+{
+    EventColumnResolved resolved;
+    const bt_field_class *fc = event_column_scope_field_class(ec, spec.kind);
+
+    for (const auto& name : spec.memberNames) {
+        bool found = false;
+
+        if (!fc || bt_field_class_get_type(fc) != BT_FIELD_CLASS_TYPE_STRUCTURE) {
+            return EventColumnResolved {};
+        }
+
+        for (uint64_t i = 0; i < bt_field_class_structure_get_member_count(fc); ++i) {
+            const auto member = bt_field_class_structure_borrow_member_by_index_const(fc, i);
+
+            if (name == bt_field_class_structure_member_get_name(member)) {
+                resolved.memberIndexes.push_back(i);
+                fc = bt_field_class_structure_member_borrow_field_class_const(member);
+                found = true;
+                break;
+            }
+        }
+
+        if (!found) {
+            return EventColumnResolved {};
+        }
+    }
+
+    if (fc) {
+        resolved.leafKind = event_column_leaf_kind(fc);
+    }
+
+    return resolved;
+}
+
+static const EventColumnEventClassEntry& event_column_reader_entry(EventColumnReader& reader,
+                                                                   const bt_event_class *ec)
+{
+    const auto it = reader.eventClasses.find(ec);
+
+    if (it != reader.eventClasses.end()) {
+        return it->second;
+    }
+
+    EventColumnEventClassEntry entry;
+    const char *name = bt_event_class_get_name(ec);
+
+    entry.selected = reader.allEventClasses || (name && reader.eventClassNames.count(name));
+
+    if (entry.selected) {
+        for (const auto& spec : reader.columns) {
+            if (spec.kind == EventColumnKind::TIMESTAMP ||
+                spec.kind == EventColumnKind::EVENT_CLASS_ID) {
+                entry.columns.emplace_back();
+            } else {
+                entry.columns.emplace_back(event_column_resolve(ec, spec));
+            }
+        }
+    }
+
+    bt_event_class_get_ref(ec);
+    return reader.eventClasses.emplace(ec, std::move(entry)).first->second;
+}
+
+static const bt_field *event_column_scope_field(const bt_event *event,
+                                                const EventColumnKind kind)
+{
+    switch (kind) {
+    case EventColumnKind::PAYLOAD:
+        return bt_event_borrow_payload_field_const(event);
+    case EventColumnKind::SPECIFIC_CONTEXT:
+        return bt_event_borrow_specific_context_field_const(event);
+    case EventColumnKind::COMMON_CONTEXT:
+        return bt_event_borrow_common_context_field_const(event);
+    case EventColumnKind::PACKET_CONTEXT:
+    {
+        const bt_packet *packet = bt_event_borrow_packet_const(event);
+
+        return packet ? bt_packet_borrow_context_field_const(packet) : NULL;
+    }
+    default:
+        bt_common_abort();
+    }
+}
+
+static void event_column_write(const EventColumnBuffer& buf, const uint64_t row,
+                               const int64_t sval, const uint64_t uval, const double dval,
+                               const EventColumnLeafKind leafKind)
+{
+    char *addr = static_cast<char *>(buf.view.buf) + row * 8;
+    const bool isReal = leafKind == EventColumnLeafKind::SINGLE_PRECISION_REAL ||
+                        leafKind == EventColumnLeafKind::DOUBLE_PRECISION_REAL;
+    const bool isSigned = leafKind == EventColumnLeafKind::SIGNED_INTEGER;
+
+    switch (buf.format) {
+    case 'q':
+    {
+        const int64_t val = isReal ? static_cast<int64_t>(dval) : isSigned ? sval : uval;
+
+        memcpy(addr, &val, sizeof(val));
+        break;
+    }
+    case 'Q':
+    {
+        const uint64_t val = isReal ? static_cast<uint64_t>(dval) : isSigned ? sval : uval;
+
+        memcpy(addr, &val, sizeof(val));
+        break;
+    }
+    case 'd':
+    {
+        const double val = isReal   ? dval :
+                           isSigned ? static_cast<double>(sval) :
+                                      static_cast<double>(uval);
+
+        memcpy(addr, &val, sizeof(val));
+        break;
+    }
+    default:
+        bt_common_abort();
+    }
+}
+
+/*
+ * Writes the row `row` of the columns `bufs` for the event message
+ * `msg`, if its event class is selected.
+ *
+ * Returns whether or not a row was written.
+ */
+static bool event_column_reader_write_row(EventColumnReader& reader,
+                                          const std::vector<EventColumnBuffer>& bufs,
+                                          const bt_message *msg, const uint64_t row)
+{
+    const bt_event *event = bt_message_event_borrow_event_const(msg);
+    const bt_event_class *ec = bt_event_borrow_class_const(event);
+    const auto& entry = event_column_reader_entry(reader, ec);
+
+    if (!entry.selected) {
+        return false;
+    }
+
+    for (size_t i = 0; i < reader.columns.size(); ++i) {
+        const auto& spec = reader.columns[i];
+        int64_t sval = 0;
+        uint64_t uval = 0;
+        double dval = 0;
+        auto leafKind = EventColumnLeafKind::UNSIGNED_INTEGER;
+
+        if (spec.kind == EventColumnKind::TIMESTAMP) {
+            const bt_stream_class *sc =
+                bt_event_class_borrow_stream_class_const(ec);
+
+            leafKind = EventColumnLeafKind::SIGNED_INTEGER;
+
+            if (bt_stream_class_borrow_default_clock_class_const(sc)) {
+                const bt_clock_snapshot *cs =
+                    bt_message_event_borrow_default_clock_snapshot_const(msg);
+
+                if (bt_clock_snapshot_get_ns_from_origin(cs, &sval) !=
+                    BT_CLOCK_SNAPSHOT_GET_NS_FROM_ORIGIN_STATUS_OK) {
+                    sval = 0;
+                }
+            }
+        } else if (spec.kind == EventColumnKind::EVENT_CLASS_ID) {
+            uval = bt_event_class_get_id(ec);
+        } else {
+            const auto& resolved = entry.columns[i];
+            const bt_field *field = event_column_scope_field(event, spec.kind);
+
+            leafKind = resolved.leafKind;
+
+            if (leafKind != EventColumnLeafKind::NONE && field) {
+                for (const auto index : resolved.memberIndexes) {
+                    field = bt_field_structure_borrow_member_field_by_index_const(field, index);
+                }
+
+                switch (leafKind) {
+                case EventColumnLeafKind::BOOL:
+                    uval = bt_field_bool_get_value(field);
+                    break;
+                case EventColumnLeafKind::UNSIGNED_INTEGER:
+                    uval = bt_field_integer_unsigned_get_value(field);
+                    break;
+                case EventColumnLeafKind::SIGNED_INTEGER:
+                    sval = bt_field_integer_signed_get_value(field);
+                    break;
+                case EventColumnLeafKind::SINGLE_PRECISION_REAL:
+                    dval = bt_field_real_single_precision_get_value(field);
+                    break;
+                case EventColumnLeafKind::DOUBLE_PRECISION_REAL:
+                    dval = bt_field_real_double_precision_get_value(field);
+                    break;
+                default:
+                    bt_common_abort();
+                }
+            }
+        }
+
+        event_column_write(bufs[i], row, sval, uval, dval, leafKind);
+    }
+
+    return true;
+}
+
+static void event_column_buffers_release(std::vector<EventColumnBuffer>& bufs)
+{
+    for (auto& buf : bufs) {
+        PyBuffer_Release(&buf.view);
+    }
+
+    bufs.clear();
+}
+
+/*
+ * Acquires the writable buffers of the column buffer objects
+ * `py_buffers`, setting `capacity` to the smallest item count.
+ */
+static bool event_column_buffers_acquire(PyObject *py_buffers, const size_t column_count,
+                                         std::vector<EventColumnBuffer>& bufs, uint64_t& capacity)
+{
+    BT_ASSERT(PyList_Check(py_buffers));
+
+    if (static_cast<size_t>(PyList_GET_SIZE(py_buffers)) != column_count) {
+        PyErr_SetString(PyExc_ValueError, "column buffer count doesn't match column count");
+        return false;
+    }
+
+    capacity = UINT64_C(-1);
+
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(py_buffers); ++i) {
+        EventColumnBuffer buf;
+
+        if (PyObject_GetBuffer(PyList_GET_ITEM(py_buffers, i), &buf.view,
+                               PyBUF_WRITABLE | PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) != 0) {
+            event_column_buffers_release(bufs);
+            return false;
+        }
+
+        /* Skip any byte order/size/alignment prefix ('@' or '=') */
+        const char *format = buf.view.format ? buf.view.format : "B";
+
+        if (*format == '@' || *format == '=') {
+            ++format;
+        }
+
+        buf.format = format[0] == 'l' ? 'q' : format[0] == 'L' ? 'Q' : format[0];
+
+        if (buf.view.itemsize != 8 || format[1] != '\0' ||
+            (buf.format != 'q' && buf.format != 'Q' && buf.format != 'd')) {
+            PyBuffer_Release(&buf.view);
+            event_column_buffers_release(bufs);
+            PyErr_Format(PyExc_ValueError,
+                         "column buffer #%zd must have a `q`, `Q`, or `d` format", i);
+            return false;
+        }
+
+        capacity = std::min(capacity, static_cast<uint64_t>(buf.view.len / 8));
+        bufs.push_back(buf);
+    }
+
+    return true;
+}
+
+/*
+ * Fills the column buffers `py_buffers` (list of objects supporting the
+ * writable buffer protocol) from the event messages of the message
+ * iterator `iter` using the event column reader `py_reader`.
+ *
+ * Before getting new messages from `iter`, this function consumes the
+ * messages of `py_pending_msgs` (list of SWIG message pointers, each
+ * one being a message reference) from the index `pending_at`. If
+ * `is_ended` is true, then `iter` is already ended: this function only
+ * consumes the pending messages.
+ *
+ * Returns a tuple (status, row count, remaining messages) where the
+ * remaining messages (list of SWIG message pointers) are message
+ * references which this function got from `iter`, but didn't consume
+ * because the column buffers are full.
+ *
+ * The status is the status of the last bt_message_iterator_next()
+ * call, except that it's `__BT_FUNC_STATUS_OK` instead of
+ * `__BT_FUNC_STATUS_AGAIN` when this function writes at least one row.
+ * In particular, the status is `__BT_FUNC_STATUS_END` when `iter` is
+ * ended, even if this function writes rows.
+ *
+ * On failure, the messages of `py_pending_msgs` may already be put:
+ * the caller must forget them.
+ */
+static PyObject *bt_bt2_message_iterator_fill_event_columns(bt_message_iterator *iter,
+                                                            PyObject *py_reader,
+                                                            PyObject *py_pending_msgs,
+                                                            uint64_t pending_at,
+                                                            int is_ended, PyObject *py_buffers)
+{
+    const auto reader = static_cast<EventColumnReader *>(
+        PyCapsule_GetPointer(py_reader, BT_BT2_EVENT_COLUMN_READER_CAPSULE_NAME));
+    std::vector<EventColumnBuffer> bufs;
+    uint64_t capacity;
+    uint64_t row = 0;
+    int status = __BT_FUNC_STATUS_OK;
+    PyObject *py_remaining_msgs = NULL;
+    PyObject *py_ret;
+
+    if (!reader) {
+        return NULL;
+    }
+
+    BT_ASSERT(PyList_Check(py_pending_msgs));
+
+    if (!event_column_buffers_acquire(py_buffers, reader->columns.size(), bufs, capacity)) {
+        return NULL;
+    }
+
+    py_remaining_msgs = PyList_New(0);
+    if (!py_remaining_msgs) {
+        goto error;
+    }
+
+    /* Consume pending messages first */
+    for (Py_ssize_t i = static_cast<Py_ssize_t>(pending_at); i < PyList_GET_SIZE(py_pending_msgs);
+         ++i) {
+        PyObject *py_msg_ptr = PyList_GET_ITEM(py_pending_msgs, i);
+        void *msg_ptr;
+
+        if (row == capacity) {
+            if (PyList_Append(py_remaining_msgs, py_msg_ptr) != 0) {
+                goto error;
+            }
+
+            continue;
+        }
+
+        if (!SWIG_IsOK(SWIG_ConvertPtr(py_msg_ptr, &msg_ptr, SWIGTYPE_p_bt_message, 0))) {
+            PyErr_SetString(PyExc_TypeError, "pending message is not a message pointer");
+            goto error;
+        }
+
+        const auto msg = static_cast<const bt_message *>(msg_ptr);
+
+        if (bt_message_get_type(msg) == BT_MESSAGE_TYPE_EVENT &&
+            event_column_reader_write_row(*reader, bufs, msg, row)) {
+            ++row;
+        }
+
+        bt_message_put_ref(msg);
+    }
+
+    if (is_ended) {
+        status = __BT_FUNC_STATUS_END;
+    }
+
+    /* Then get new messages */
+    while (!is_ended && row < capacity) {
+        bt_message_array_const msgs;
+        uint64_t count = 0;
+        uint64_t i;
+
+        status = bt_message_iterator_next(iter, &msgs, &count);
+        if (status != __BT_FUNC_STATUS_OK) {
+            break;
+        }
+
+        for (i = 0; i < count && row < capacity; ++i) {
+            if (bt_message_get_type(msgs[i]) == BT_MESSAGE_TYPE_EVENT &&
+                event_column_reader_write_row(*reader, bufs, msgs[i], row)) {
+                ++row;
+            }
+
+            bt_message_put_ref(msgs[i]);
+        }
+
+        /* Keep the messages which don't fit for the next call */
+        for (; i < count; ++i) {
+            PyObject *py_msg_ptr =
+                SWIG_NewPointerObj(SWIG_as_voidptr(msgs[i]), SWIGTYPE_p_bt_message, 0);
+
+            if (!py_msg_ptr || PyList_Append(py_remaining_msgs, py_msg_ptr) != 0) {
+                /* Leaks the remaining message references: out of memory anyway */
+                Py_XDECREF(py_msg_ptr);
+                goto error;
+            }
+
+            Py_DECREF(py_msg_ptr);
+        }
+    }
+
+    if (row > 0 && status == __BT_FUNC_STATUS_AGAIN) {
+        status = __BT_FUNC_STATUS_OK;
+    }
+
+    event_column_buffers_release(bufs);
+
+    /* Py_BuildValue() steals `py_remaining_msgs`, even on failure */
+    py_ret = Py_BuildValue("(iKN)", status, static_cast<unsigned long long>(row),
+                           py_remaining_msgs);
+    return py_ret;
+
+error:
+    event_column_buffers_release(bufs);
+    Py_XDECREF(py_remaining_msgs);
+    return NULL;
+}
+
+#endif /* BABELTRACE_BINDINGS_PYTHON_BT2_BT2_NATIVE_BT_EVENT_COLUMNS_I_HPP */
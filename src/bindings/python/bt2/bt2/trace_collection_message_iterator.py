@@ -18,6 +18,7 @@ from bt2 import logging as bt2_logging
 from bt2 import message as bt2_message
 from bt2 import component as bt2_component
 from bt2 import native_bt
+from bt2 import event_columns as bt2_event_columns
 from bt2 import query_executor as bt2_query_executor
 from bt2 import message_iterator as bt2_message_iterator
 from bt2 import component_descriptor as bt2_component_descriptor
@@ -271,6 +272,16 @@ def _get_ns(obj):
     return int(s * 1e9)
 
 
+# `msg_list` is a list of three items shared with the trace collection
+# message iterator:
+#
+# 1. Where to put the next message (or the next message batch).
+#
+# 2. Event column reader to fill instead of getting the next message,
+#    or `None`.
+#
+# 3. Whether or not to get the next message batch instead of the next
+#    message.
 class _TraceCollectionMessageIteratorProxySink(bt2_component._UserSinkComponent):
     def __init__(self, config, params, msg_list):
         assert type(msg_list) is list
@@ -282,6 +293,16 @@ class _TraceCollectionMessageIteratorProxySink(bt2_component._UserSinkComponent)
 
     def _user_consume(self):
         assert self._msg_list[0] is None
+        event_column_reader = self._msg_list[1]
+
+        if event_column_reader is not None:
+            self._msg_iter.read_event_columns(event_column_reader)
+            return
+
+        if self._msg_list[2]:
+            self._msg_list[0] = self._msg_iter.next_batch()
+            return
+
         self._msg_list[0] = next(self._msg_iter)
 
 
@@ -299,7 +320,7 @@ class TraceCollectionMessageIterator(bt2_message_iterator._MessageIterator):
         self._stream_intersection_mode = stream_intersection_mode
         self._begin_ns = _get_ns(begin)
         self._end_ns = _get_ns(end)
-        self._msg_list = [None]
+        self._msg_list = [None, None, False]
 
         # If a single item is provided, convert to a list.
         if type(source_component_specs) in (
@@ -415,6 +436,43 @@ class TraceCollectionMessageIterator(bt2_message_iterator._MessageIterator):
         self._msg_list[0] = None
         return msg
 
+    # Reads the next event messages into the column buffers of `reader`
+    # instead of creating message objects, returning the number of
+    # written rows (at least one).
+    #
+    # You may mix calls to this method and to `next()`.
+    #
+    # Raises `bt2.Stop` when there are no more messages.
+    def read_event_columns(self, reader: bt2_event_columns.EventColumnReader) -> int:
+        bt2_utils._check_type(reader, bt2_event_columns.EventColumnReader)
+        self._msg_list[1] = reader
+
+        try:
+            self._graph.run_once()
+        finally:
+            self._msg_list[1] = None
+
+        return reader.count
+
+    # Returns all the next available messages (at least one) as a
+    # read-only sequence (`bt2._MessageBatchConst`) which only creates
+    # message objects on access.
+    #
+    # You may mix calls to this method and to `next()`.
+    def next_batch(self) -> bt2_message_iterator._MessageBatchConst:
+        assert self._msg_list[0] is None
+        self._msg_list[2] = True
+
+        try:
+            self._graph.run_once()
+        finally:
+            self._msg_list[2] = False
+
+        batch = self._msg_list[0]
+        assert batch is not None
+        self._msg_list[0] = None
+        return batch
+
     def _create_stream_intersection_trimmer(self, component, port):
         key = (component.addr, port.name)
         begin, end = self._stream_inter_port_to_range[key]
@@ -432,6 +432,10 @@ void bt_config_destroy(bt_object *obj)
 			g_ptr_array_free(cfg->cmd_data.run.connections,
 				TRUE);
 		}
+
+		if (cfg->cmd_data.run.profile_path) {
+			g_string_free(cfg->cmd_data.run.profile_path, TRUE);
+		}
 		break;
 	case BT_CONFIG_COMMAND_LIST_PLUGINS:
 		break;
@@ -861,6 +865,7 @@ enum {
 	OPT_OUTPUT_FORMAT,
 	OPT_PARAMS,
 	OPT_PLUGIN_PATH,
+	OPT_PROFILE,
 	OPT_RESET_BASE_PARAMS,
 	OPT_RETRY_DURATION,
 	OPT_RUN_ARGS,
@@ -1893,6 +1898,8 @@ void print_run_usage(FILE *fp)
 	fprintf(fp, "  -p, --params=PARAMS               Add initialization parameters PARAMS to the\n");
 	fprintf(fp, "                                    current component (see the expected format\n");
 	fprintf(fp, "                                    of PARAMS below)\n");
+	fprintf(fp, "      --profile=PATH                Profile the graph and write the profile\n");
+	fprintf(fp, "                                    to PATH as JSON at exit and on SIGUSR1\n");
 	fprintf(fp, "  -r, --reset-base-params           Reset the current base parameters to an\n");
 	fprintf(fp, "                                    empty map\n");
 	fprintf(fp, "      --retry-duration=DUR          When babeltrace2(1) needs to retry to run\n");
@@ -1970,6 +1977,7 @@ enum bt_config_cli_args_status bt_config_run_from_args(int argc, const char *arg
 		{ OPT_HELP, 'h', "help", false },
 		{ OPT_LOG_LEVEL, 'l', "log-level", true },
 		{ OPT_PARAMS, 'p', "params", true },
+		{ OPT_PROFILE, '\0', "profile", true },
 		{ OPT_RESET_BASE_PARAMS, 'r', "reset-base-params", false },
 		{ OPT_RETRY_DURATION, '\0', "retry-duration", true },
 		{ OPT_ALLOWED_MIP_VERSIONS, 'm', "allowed-mip-versions", true },
@@ -2186,6 +2194,18 @@ enum bt_config_cli_args_status bt_config_run_from_args(int argc, const char *arg
 				(uint64_t) retry_duration;
 			break;
 		}
+		case OPT_PROFILE:
+			if (cfg->cmd_data.run.profile_path) {
+				g_string_assign(cfg->cmd_data.run.profile_path,
+					arg);
+			} else {
+				cfg->cmd_data.run.profile_path = g_string_new(arg);
+				if (!cfg->cmd_data.run.profile_path) {
+					BT_CLI_LOGE_APPEND_CAUSE_OOM();
+					goto error;
+				}
+			}
+			break;
 		case OPT_ALLOWED_MIP_VERSIONS: {
 			gchar *end;
 			size_t arg_len = strlen(arg);
@@ -2322,6 +2342,8 @@ void print_convert_usage(FILE *fp)
 	fprintf(fp, "  -p, --params=PARAMS               Add initialization parameters PARAMS to the\n");
 	fprintf(fp, "                                    current component (see the expected format\n");
 	fprintf(fp, "                                    of PARAMS below)\n");
+	fprintf(fp, "      --profile=PATH                Profile the graph and write the profile\n");
+	fprintf(fp, "                                    to PATH as JSON at exit and on SIGUSR1\n");
 	fprintf(fp, "      --retry-duration=DUR          When babeltrace2(1) needs to retry to run\n");
 	fprintf(fp, "                                    the graph later, retry in DUR µs\n");
 	fprintf(fp, "                                    (default: 100000)\n");
@@ -2400,7 +2422,7 @@ void print_convert_usage(FILE *fp)
 	fprintf(fp, "                                    `lttng-live`:\n");
 	fprintf(fp, "                                      Create an implicit `source.ctf.lttng-live`\n");
 	fprintf(fp, "                                      component\n");
-	fprintf(fp, "  -o, --output-format=(text | ctf | dummy | ctf-metadata)\n");
+	fprintf(fp, "  -o, --output-format=(text | ctf | dummy | stats | ctf-metadata)\n");
 	fprintf(fp, "                                    `text`:\n");
 	fprintf(fp, "                                      Create an implicit `sink.text.pretty`\n");
 	fprintf(fp, "                                      component\n");
@@ -2410,6 +2432,11 @@ void print_convert_usage(FILE *fp)
 	fprintf(fp, "                                    `dummy`:\n");
 	fprintf(fp, "                                      Create an implicit `sink.utils.dummy`\n");
 	fprintf(fp, "                                      component\n");
+	fprintf(fp, "                                    `stats`:\n");
+	fprintf(fp, "                                      Create an implicit `sink.utils.counter`\n");
+	fprintf(fp, "                                      component in statistics mode and make\n");
+	fprintf(fp, "                                      `source.ctf.fs` components skip event\n");
+	fprintf(fp, "                                      record fields\n");
 	fprintf(fp, "                                    `ctf-metadata`:\n");
 	fprintf(fp, "                                      Query the `source.ctf.fs` component class\n");
 	fprintf(fp, "                                      for metadata text and quit\n");
@@ -2455,6 +2482,7 @@ const struct argpar_opt_descr convert_options[] = {
 	{ OPT_OUTPUT, 'w', "output", true },
 	{ OPT_OUTPUT_FORMAT, 'o', "output-format", true },
 	{ OPT_PARAMS, 'p', "params", true },
+	{ OPT_PROFILE, '\0', "profile", true },
 	{ OPT_RETRY_DURATION, '\0', "retry-duration", true },
 	{ OPT_RUN_ARGS, '\0', "run-args", false },
 	{ OPT_RUN_ARGS_0, '\0', "run-args-0", false },
@@ -3382,6 +3410,7 @@ enum bt_config_cli_args_status bt_config_convert_from_args(int argc,
 	struct implicit_component_args implicit_ctf_output_args = { 0 };
 	struct implicit_component_args implicit_lttng_live_args = { 0 };
 	struct implicit_component_args implicit_dummy_args = { 0 };
+	struct implicit_component_args implicit_stats_args = { 0 };
 	struct implicit_component_args implicit_text_args = { 0 };
 	struct implicit_component_args implicit_debug_info_args = { 0 };
 	struct implicit_component_args implicit_muxer_args = { 0 };
@@ -3441,6 +3470,11 @@ enum bt_config_cli_args_status bt_config_convert_from_args(int argc,
 		goto error;
 	}
 
+	if (init_implicit_component_args(&implicit_stats_args,
+			"sink.utils.counter", false)) {
+		goto error;
+	}
+
 	if (init_implicit_component_args(&implicit_debug_info_args,
 			"filter.lttng-utils.debug-info", false)) {
 		goto error;
@@ -3727,6 +3761,18 @@ enum bt_config_cli_args_status bt_config_convert_from_args(int argc,
 					goto error;
 				}
 
+				if (bt_value_array_append_string_element(run_args, arg)) {
+					BT_CLI_LOGE_APPEND_CAUSE_OOM();
+					goto error;
+				}
+				break;
+			case OPT_PROFILE:
+				if (bt_value_array_append_string_element(run_args,
+						"--profile")) {
+					BT_CLI_LOGE_APPEND_CAUSE_OOM();
+					goto error;
+				}
+
 				if (bt_value_array_append_string_element(run_args, arg)) {
 					BT_CLI_LOGE_APPEND_CAUSE_OOM();
 					goto error;
@@ -4053,6 +4099,12 @@ enum bt_config_cli_args_status bt_config_convert_from_args(int argc,
 				implicit_ctf_output_args.exists = true;
 			} else if (strcmp(arg, "dummy") == 0) {
 				implicit_dummy_args.exists = true;
+			} else if (strcmp(arg, "stats") == 0) {
+				implicit_stats_args.exists = true;
+				append_implicit_component_param(
+					&implicit_stats_args, "statistics", "yes");
+				append_implicit_component_param(
+					&implicit_stats_args, "step", "0");
 			} else if (strcmp(arg, "ctf-metadata") == 0) {
 				print_ctf_metadata = true;
 			} else {
@@ -4112,6 +4164,7 @@ enum bt_config_cli_args_status bt_config_convert_from_args(int argc,
 		case OPT_OMIT_SYSTEM_PLUGIN_PATH:
 		case OPT_PARAMS:
 		case OPT_PLUGIN_PATH:
+		case OPT_PROFILE:
 		case OPT_RETRY_DURATION:
 			/* Ignore in this pass */
 			break;
@@ -4197,12 +4250,12 @@ enum bt_config_cli_args_status bt_config_convert_from_args(int argc,
 	}
 
 	/*
-	 * If -o dummy and -o ctf were not specified, and if there are
-	 * no explicit sink components, then use an implicit
+	 * If -o dummy, -o stats, and -o ctf were not specified, and if
+	 * there are no explicit sink components, then use an implicit
 	 * `sink.text.pretty` component.
 	 */
-	if (!implicit_dummy_args.exists && !implicit_ctf_output_args.exists &&
-			!sink_names) {
+	if (!implicit_dummy_args.exists && !implicit_stats_args.exists &&
+			!implicit_ctf_output_args.exists && !sink_names) {
 		implicit_text_args.exists = true;
 	}
 
@@ -4374,6 +4427,17 @@ enum bt_config_cli_args_status bt_config_convert_from_args(int argc,
 		}
 	}
 
+	/*
+	 * If -o stats was given, the implicit `sink.utils.counter`
+	 * component only needs the classes and times of the events:
+	 * make any src.ctf.fs component skip the event record fields.
+	 */
+	if (implicit_stats_args.exists) {
+		(void) append_multiple_implicit_components_param(
+			discovered_source_args, "source.ctf.fs",
+			"skip-event-record-fields", "yes");
+	}
+
 	/*
 	 * If the implicit `source.ctf.lttng-live` component exists,
 	 * make sure there's at least one non-option argument (which is
@@ -4432,6 +4496,12 @@ enum bt_config_cli_args_status bt_config_convert_from_args(int argc,
 		goto error;
 	}
 
+	ret = assign_name_to_implicit_component(&implicit_stats_args,
+		"stats", all_names, &sink_names, true);
+	if (ret) {
+		goto error;
+	}
+
 	ret = assign_name_to_implicit_component(&implicit_muxer_args,
 		"muxer", all_names, NULL, false);
 	if (ret) {
@@ -4532,6 +4602,12 @@ enum bt_config_cli_args_status bt_config_convert_from_args(int argc,
 		goto error;
 	}
 
+	ret = append_run_args_for_implicit_component(&implicit_stats_args,
+		run_args);
+	if (ret) {
+		goto error;
+	}
+
 	ret = append_run_args_for_implicit_component(&implicit_muxer_args,
 		run_args);
 	if (ret) {
@@ -4650,6 +4726,7 @@ end:
 	finalize_implicit_component_args(&implicit_ctf_output_args);
 	finalize_implicit_component_args(&implicit_lttng_live_args);
 	finalize_implicit_component_args(&implicit_dummy_args);
+	finalize_implicit_component_args(&implicit_stats_args);
 	finalize_implicit_component_args(&implicit_text_args);
 	finalize_implicit_component_args(&implicit_debug_info_args);
 	finalize_implicit_component_args(&implicit_muxer_args);
@@ -73,6 +73,13 @@ struct bt_config {
 			 */
 			uint64_t retry_duration_us;
 
+			/*
+			 * Path of the file to which to write the JSON
+			 * profile of the graph, or `NULL` to disable
+			 * profiling.
+			 */
+			GString *profile_path;
+
 			/* Allowed MIP versions */
 			bool allow_mip_0;
 			bool allow_mip_1;
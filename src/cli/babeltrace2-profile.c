@@ -0,0 +1,212 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS, Inc.
+ */
+
+#define BT_LOG_TAG "CLI/PROFILE"
+#include "logging.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include <glib.h>
+#include <babeltrace2/babeltrace.h>
+
+#include "common/assert.h"
+#include "common/common.h"
+
+#include "babeltrace2-profile.h"
+
+struct append_json_map_entry_data {
+	GString *json;
+	bool is_first;
+};
+
+static
+void append_json_str(GString *json, const char *str)
+{
+	const char *ch;
+
+	g_string_append_c(json, '"');
+
+	for (ch = str; *ch != '\0'; ch++) {
+		switch (*ch) {
+		case '"':
+			g_string_append(json, "\\\"");
+			break;
+		case '\\':
+			g_string_append(json, "\\\\");
+			break;
+		case '\n':
+			g_string_append(json, "\\n");
+			break;
+		case '\r':
+			g_string_append(json, "\\r");
+			break;
+		case '\t':
+			g_string_append(json, "\\t");
+			break;
+		default:
+			if ((unsigned char) *ch < 0x20) {
+				g_string_append_printf(json, "\\u%04x",
+					(unsigned int) (unsigned char) *ch);
+			} else {
+				g_string_append_c(json, *ch);
+			}
+		}
+	}
+
+	g_string_append_c(json, '"');
+}
+
+static
+void append_json_val(GString *json, const bt_value *val);
+
+static
+bt_value_map_foreach_entry_const_func_status append_json_map_entry(
+		const char *key, const bt_value *val, void *user_data)
+{
+	struct append_json_map_entry_data *data = user_data;
+
+	if (!data->is_first) {
+		g_string_append_c(data->json, ',');
+	}
+
+	data->is_first = false;
+	append_json_str(data->json, key);
+	g_string_append_c(data->json, ':');
+	append_json_val(data->json, val);
+	return BT_VALUE_MAP_FOREACH_ENTRY_CONST_FUNC_STATUS_OK;
+}
+
+static
+void append_json_val(GString *json, const bt_value *val)
+{
+	switch (bt_value_get_type(val)) {
+	case BT_VALUE_TYPE_NULL:
+		g_string_append(json, "null");
+		break;
+	case BT_VALUE_TYPE_BOOL:
+		g_string_append(json,
+			bt_value_bool_get(val) ? "true" : "false");
+		break;
+	case BT_VALUE_TYPE_UNSIGNED_INTEGER:
+		g_string_append_printf(json, "%" PRIu64,
+			bt_value_integer_unsigned_get(val));
+		break;
+	case BT_VALUE_TYPE_SIGNED_INTEGER:
+		g_string_append_printf(json, "%" PRId64,
+			bt_value_integer_signed_get(val));
+		break;
+	case BT_VALUE_TYPE_REAL:
+	{
+		const double real = bt_value_real_get(val);
+		char buf[G_ASCII_DTOSTR_BUF_SIZE];
+
+		if (isfinite(real)) {
+			g_string_append(json,
+				g_ascii_dtostr(buf, sizeof(buf), real));
+		} else {
+			/* JSON has no infinity or NaN */
+			g_string_append(json, "null");
+		}
+
+		break;
+	}
+	case BT_VALUE_TYPE_STRING:
+		append_json_str(json, bt_value_string_get(val));
+		break;
+	case BT_VALUE_TYPE_ARRAY:
+	{
+		uint64_t i;
+
+		g_string_append_c(json, '[');
+
+		for (i = 0; i < bt_value_array_get_length(val); i++) {
+			if (i > 0) {
+				g_string_append_c(json, ',');
+			}
+
+			append_json_val(json,
+				bt_value_array_borrow_element_by_index_const(
+					val, i));
+		}
+
+		g_string_append_c(json, ']');
+		break;
+	}
+	case BT_VALUE_TYPE_MAP:
+	{
+		struct append_json_map_entry_data data = {
+			.json = json,
+			.is_first = true,
+		};
+		bt_value_map_foreach_entry_const_status foreach_status;
+
+		g_string_append_c(json, '{');
+		foreach_status = bt_value_map_foreach_entry_const(val,
+			append_json_map_entry, &data);
+		BT_ASSERT(foreach_status ==
+			BT_VALUE_MAP_FOREACH_ENTRY_CONST_STATUS_OK);
+		g_string_append_c(json, '}');
+		break;
+	}
+	default:
+		bt_common_abort();
+	}
+}
+
+int cli_write_graph_profile(const bt_graph *graph, const char *path)
+{
+	int ret = 0;
+	const bt_value *profile = NULL;
+	GString *json = NULL;
+	GError *gerror = NULL;
+	bt_graph_get_profile_status get_profile_status;
+
+	BT_ASSERT(graph);
+	BT_ASSERT(path);
+	get_profile_status = bt_graph_get_profile(graph, &profile);
+	if (get_profile_status != BT_GRAPH_GET_PROFILE_STATUS_OK) {
+		BT_CLI_LOGE_APPEND_CAUSE("Cannot get the graph's profile.");
+		goto error;
+	}
+
+	json = g_string_new(NULL);
+	if (!json) {
+		BT_CLI_LOGE_APPEND_CAUSE("Failed to allocate a GString.");
+		goto error;
+	}
+
+	append_json_val(json, profile);
+	g_string_append_c(json, '\n');
+
+	if (!g_file_set_contents(path, json->str, (gssize) json->len,
+			&gerror)) {
+		BT_CLI_LOGE_APPEND_CAUSE(
+			"Cannot write the graph's profile: path=\"%s\", msg=\"%s\"",
+			path, gerror->message);
+		goto error;
+	}
+
+	BT_LOGI("Wrote graph's profile: path=\"%s\"", path);
+	goto end;
+
+error:
+	ret = -1;
+
+end:
+	if (gerror) {
+		g_error_free(gerror);
+	}
+
+	if (json) {
+		g_string_free(json, TRUE);
+	}
+
+	bt_value_put_ref(profile);
+	return ret;
+}
@@ -0,0 +1,20 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS, Inc.
+ */
+
+#ifndef BABELTRACE_CLI_BABELTRACE2_PROFILE_H
+#define BABELTRACE_CLI_BABELTRACE2_PROFILE_H
+
+#include <babeltrace2/babeltrace.h>
+
+/*
+ * Writes the current profile of `graph`, of which the profiling must be
+ * enabled, as JSON to the file `path`, replacing it atomically.
+ *
+ * Returns 0 on success, or -1 on error (with an appended error cause).
+ */
+int cli_write_graph_profile(const bt_graph *graph, const char *path);
+
+#endif /* BABELTRACE_CLI_BABELTRACE2_PROFILE_H */
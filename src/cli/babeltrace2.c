@@ -24,6 +24,7 @@
 #include "babeltrace2-cfg-cli-args-default.h"
 #include "babeltrace2-log-level.h"
 #include "babeltrace2-plugins.h"
+#include "babeltrace2-profile.h"
 #include "babeltrace2-query.h"
 
 #define ENV_BABELTRACE_WARN_COMMAND_NAME_DIRECTORY_CLASH "BABELTRACE_CLI_WARN_COMMAND_NAME_DIRECTORY_CLASH"
@@ -54,6 +55,9 @@ const char *bt_cmd_status_string(enum bt_cmd_status cmd_status)
 /* Application's interrupter (owned by this) */
 static bt_interrupter *the_interrupter;
 
+/* Set by the `SIGUSR1` handler to request a profile dump */
+static volatile sig_atomic_t profile_dump_requested;
+
 #ifdef __MINGW32__
 
 #include <windows.h>
@@ -75,8 +79,38 @@ void set_signal_handler(void)
 	}
 }
 
+static
+void set_profile_signal_handler(void)
+{
+}
+
 #else /* __MINGW32__ */
 
+static
+void profile_signal_handler(int signum)
+{
+	if (signum != SIGUSR1) {
+		return;
+	}
+
+	profile_dump_requested = 1;
+}
+
+static
+void set_profile_signal_handler(void)
+{
+	struct sigaction new_action;
+
+	/*
+	 * Restart interrupted system calls: a profile dump request
+	 * must not look like a cancellation to the components.
+	 */
+	new_action.sa_handler = profile_signal_handler;
+	sigemptyset(&new_action.sa_mask);
+	new_action.sa_flags = SA_RESTART;
+	sigaction(SIGUSR1, &new_action, NULL);
+}
+
 static
 void signal_handler(int signum)
 {
@@ -1920,6 +1954,16 @@ int cmd_run_ctx_init(struct cmd_run_ctx *ctx, struct bt_config *cfg)
 	}
 
 	bt_graph_add_interrupter(ctx->graph, the_interrupter);
+
+	if (cfg->cmd_data.run.profile_path) {
+		if (bt_graph_enable_profiling(ctx->graph) !=
+				BT_GRAPH_ENABLE_PROFILING_STATUS_OK) {
+			BT_CLI_LOGE_APPEND_CAUSE(
+				"Cannot enable the graph's profiling.");
+			goto error;
+		}
+	}
+
 	add_listener_status = bt_graph_add_source_component_output_port_added_listener(
 		ctx->graph, graph_source_output_port_added_listener, ctx,
 		NULL);
@@ -2478,6 +2522,76 @@ end:
 	return ret;
 }
 
+/*
+ * Writes the profile of the graph of `ctx` to the path of the
+ * `--profile` option, only logging a warning on error.
+ *
+ * This function keeps the current thread's error, if any.
+ */
+static
+void cmd_run_ctx_write_profile(struct cmd_run_ctx *ctx)
+{
+	const char *path = ctx->cfg->cmd_data.run.profile_path->str;
+	const bt_error *error = bt_current_thread_take_error();
+
+	if (cli_write_graph_profile(ctx->graph, path)) {
+		BT_LOGW("Cannot write the graph's profile: path=\"%s\"",
+			path);
+		bt_current_thread_clear_error();
+	}
+
+	if (error) {
+		BT_CURRENT_THREAD_MOVE_ERROR_AND_RESET(error);
+	}
+}
+
+/*
+ * Like bt_graph_run(), but calls bt_graph_run_once() in a loop to
+ * write the profile of the graph of `ctx` whenever the user requests
+ * it (`SIGUSR1`).
+ */
+static
+bt_graph_run_status cmd_run_ctx_run_graph_with_profile(
+		struct cmd_run_ctx *ctx)
+{
+	bt_graph_run_status run_status;
+
+	while (true) {
+		bt_graph_run_once_status run_once_status =
+			bt_graph_run_once(ctx->graph);
+
+		if (profile_dump_requested) {
+			profile_dump_requested = 0;
+			cmd_run_ctx_write_profile(ctx);
+		}
+
+		switch (run_once_status) {
+		case BT_GRAPH_RUN_ONCE_STATUS_OK:
+			if (bt_interrupter_is_set(the_interrupter)) {
+				run_status = BT_GRAPH_RUN_STATUS_AGAIN;
+				goto end;
+			}
+
+			break;
+		case BT_GRAPH_RUN_ONCE_STATUS_END:
+			run_status = BT_GRAPH_RUN_STATUS_OK;
+			goto end;
+		case BT_GRAPH_RUN_ONCE_STATUS_AGAIN:
+			run_status = BT_GRAPH_RUN_STATUS_AGAIN;
+			goto end;
+		case BT_GRAPH_RUN_ONCE_STATUS_MEMORY_ERROR:
+			run_status = BT_GRAPH_RUN_STATUS_MEMORY_ERROR;
+			goto end;
+		default:
+			run_status = BT_GRAPH_RUN_STATUS_ERROR;
+			goto end;
+		}
+	}
+
+end:
+	return run_status;
+}
+
 static
 enum bt_cmd_status cmd_run(struct bt_config *cfg)
 {
@@ -2522,9 +2636,19 @@ enum bt_cmd_status cmd_run(struct bt_config *cfg)
 
 	BT_LOGI_STR("Running the graph.");
 
+	if (cfg->cmd_data.run.profile_path) {
+		set_profile_signal_handler();
+	}
+
 	/* Run the graph */
 	while (true) {
-		bt_graph_run_status run_status = bt_graph_run(ctx.graph);
+		bt_graph_run_status run_status;
+
+		if (cfg->cmd_data.run.profile_path) {
+			run_status = cmd_run_ctx_run_graph_with_profile(&ctx);
+		} else {
+			run_status = bt_graph_run(ctx.graph);
+		}
 
 		/*
 		 * Reset console in case something messed with console
@@ -2550,15 +2674,28 @@ enum bt_cmd_status cmd_run(struct bt_config *cfg)
 			}
 
 			if (cfg->cmd_data.run.retry_duration_us > 0) {
-				BT_LOGT("Got BT_GRAPH_RUN_STATUS_AGAIN: sleeping: "
-					"time-us=%" PRIu64,
+				bt_graph_wait_for_readiness_status wait_status;
+
+				/*
+				 * Wait until any message iterator which
+				 * returned "try again" says it's ready, or
+				 * for at most the retry duration.
+				 */
+				BT_LOGT("Got BT_GRAPH_RUN_STATUS_AGAIN: waiting: "
+					"max-time-us=%" PRIu64,
 					cfg->cmd_data.run.retry_duration_us);
+				wait_status = bt_graph_wait_for_readiness(
+					ctx.graph,
+					cfg->cmd_data.run.retry_duration_us);
+				if (wait_status) {
+					BT_CLI_LOGE_APPEND_CAUSE(
+						"Failed to wait for the graph's readiness.");
+					goto error;
+				}
 
-				if (usleep(cfg->cmd_data.run.retry_duration_us)) {
-					if (bt_interrupter_is_set(the_interrupter)) {
-						cmd_status = BT_CMD_STATUS_INTERRUPTED;
-						goto end;
-					}
+				if (bt_interrupter_is_set(the_interrupter)) {
+					cmd_status = BT_CMD_STATUS_INTERRUPTED;
+					goto end;
 				}
 			}
 			break;
@@ -2577,6 +2714,12 @@ error:
 	cmd_status = BT_CMD_STATUS_ERROR;
 
 end:
+	/* Write the final profile */
+	if (ctx.graph && cfg->cmd_data.run.profile_path &&
+			bt_graph_profiling_is_enabled(ctx.graph)) {
+		cmd_run_ctx_write_profile(&ctx);
+	}
+
 	cmd_run_ctx_destroy(&ctx);
 	return cmd_status;
 }
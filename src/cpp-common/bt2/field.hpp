@@ -1040,6 +1040,23 @@ public:
         return *this;
     }
 
+    /*
+     * Makes this field borrow the first `len` bytes of `begin` as its
+     * value until it calls `releaseFunc` with `userData`.
+     *
+     * `begin[len]` must be a null character.
+     */
+    CommonStringField borrowedValue(const char * const begin, const std::uint64_t len,
+                                    const bt_field_borrowed_data_release_func releaseFunc,
+                                    void * const userData) const noexcept
+    {
+        static_assert(!std::is_const<LibObjT>::value,
+                      "Not available with `bt2::ConstStringField`.");
+
+        bt_field_string_set_borrowed_value(this->libObjPtr(), begin, len, releaseFunc, userData);
+        return *this;
+    }
+
     Value value() const noexcept
     {
         return bt_field_string_get_value(this->libObjPtr());
@@ -1139,6 +1156,20 @@ public:
         return {internal::CommonBlobFieldSpec<LibObjT>::data(this->libObjPtr()), this->length()};
     }
 
+    /*
+     * Makes this field borrow `data` as its data, keeping its current
+     * length, until it calls `releaseFunc` with `userData`.
+     */
+    CommonBlobField borrowedData(const std::uint8_t * const data,
+                                 const bt_field_borrowed_data_release_func releaseFunc,
+                                 void * const userData) const noexcept
+    {
+        static_assert(!std::is_const<LibObjT>::value, "Not available with `bt2::ConstBlobField`.");
+
+        bt_field_blob_set_borrowed_data(this->libObjPtr(), data, releaseFunc, userData);
+        return *this;
+    }
+
     std::uint64_t length() const noexcept
     {
         return bt_field_blob_get_length(this->libObjPtr());
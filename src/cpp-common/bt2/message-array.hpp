@@ -18,6 +18,7 @@
 namespace bt2 {
 
 class ConstMessageArray;
+class SelfMessageIterator;
 
 class ConstMessageArrayIterator final
 {
@@ -120,6 +121,8 @@ private:
  */
 class ConstMessageArray final
 {
+    friend class SelfMessageIterator;
+
 private:
     explicit ConstMessageArray(const bt_message_array_const libArrayPtr, const std::uint64_t length,
                                const std::uint64_t capacity) noexcept :
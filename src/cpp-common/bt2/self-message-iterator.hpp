@@ -9,9 +9,13 @@
 
 #include <babeltrace2/babeltrace.h>
 
+#include "common/assert.h"
 #include "common/common.h"
+#include "cpp-common/bt2s/optional.hpp"
+#include "cpp-common/bt2s/span.hpp"
 
 #include "borrowed-object.hpp"
+#include "message-array.hpp"
 #include "message-iterator.hpp"
 #include "self-component-port.hpp"
 
@@ -58,6 +62,28 @@ public:
         return static_cast<bool>(bt_self_message_iterator_is_interrupted(this->libObjPtr()));
     }
 
+    bt2s::optional<std::int64_t> autoSeekNsFromOrigin() const noexcept
+    {
+        std::int64_t nsFromOrigin;
+
+        if (bt_self_message_iterator_is_auto_seeking(this->libObjPtr(), &nsFromOrigin)) {
+            return nsFromOrigin;
+        }
+
+        return bt2s::nullopt;
+    }
+
+    SelfMessageIterator readinessFd(const int fd) const noexcept
+    {
+        bt_self_message_iterator_set_readiness_fd(this->libObjPtr(), fd);
+        return *this;
+    }
+
+    void addDecodedBytes(const std::uint64_t count) const noexcept
+    {
+        bt_self_message_iterator_add_decoded_bytes(this->libObjPtr(), count);
+    }
+
     template <typename T>
     T& data() const noexcept
     {
@@ -149,6 +175,54 @@ public:
         return EventMessage::Shared::createWithoutRef(libObjPtr);
     }
 
+    /*
+     * Creates one event message for each event class of
+     * `libEventClsPtrs`, all for the packet `packet`, and appends them
+     * to `msgs`.
+     *
+     * `msgs` must have room for `libEventClsPtrs.size()` more messages.
+     */
+    void createEventMessages(ConstMessageArray& msgs,
+                             const bt2s::span<const bt_event_class * const> libEventClsPtrs,
+                             const ConstPacket packet) const
+    {
+        BT_ASSERT_DBG(msgs.length() + libEventClsPtrs.size() <= msgs.capacity());
+
+        const auto status = bt_message_event_create_many_with_packet(
+            this->libObjPtr(), libEventClsPtrs.data(), packet.libObjPtr(), libEventClsPtrs.size(),
+            &msgs._mLibArrayPtr[msgs._mLen]);
+
+        if (status == BT_MESSAGE_EVENT_CREATE_MANY_STATUS_MEMORY_ERROR) {
+            throw MemoryError {};
+        }
+
+        msgs._mLen += libEventClsPtrs.size();
+    }
+
+    /*
+     * Like createEventMessages() above, but the message at index `i`
+     * also has a default clock snapshot with the value
+     * `clockSnapshotValues[i]`.
+     */
+    void createEventMessages(ConstMessageArray& msgs,
+                             const bt2s::span<const bt_event_class * const> libEventClsPtrs,
+                             const ConstPacket packet,
+                             const bt2s::span<const std::uint64_t> clockSnapshotValues) const
+    {
+        BT_ASSERT_DBG(msgs.length() + libEventClsPtrs.size() <= msgs.capacity());
+        BT_ASSERT_DBG(clockSnapshotValues.size() == libEventClsPtrs.size());
+
+        const auto status = bt_message_event_create_many_with_packet_and_default_clock_snapshot(
+            this->libObjPtr(), libEventClsPtrs.data(), packet.libObjPtr(),
+            clockSnapshotValues.data(), libEventClsPtrs.size(), &msgs._mLibArrayPtr[msgs._mLen]);
+
+        if (status == BT_MESSAGE_EVENT_CREATE_MANY_STATUS_MEMORY_ERROR) {
+            throw MemoryError {};
+        }
+
+        msgs._mLen += libEventClsPtrs.size();
+    }
+
     PacketBeginningMessage::Shared createPacketBeginningMessage(const ConstPacket packet) const
     {
         const auto libObjPtr =
@@ -698,54 +698,58 @@ end:
 }
 
 static
-int set_packet_context_timestamps(struct bt_ctf_stream *stream)
+int get_packet_init_clock_value(struct bt_ctf_stream *stream,
+		uint64_t *init_clock_value)
 {
 	int ret = 0;
 	uint64_t val;
-	uint64_t cur_clock_value;
-	uint64_t init_clock_value = 0;
 	struct bt_ctf_field *ts_begin_field = bt_ctf_field_structure_get_field_by_name(
 		stream->packet_context, "timestamp_begin");
-	struct bt_ctf_field *ts_end_field = bt_ctf_field_structure_get_field_by_name(
-		stream->packet_context, "timestamp_end");
-	struct bt_ctf_field_common *packet_context =
-		(void *) stream->packet_context;
-	uint64_t i;
-	int64_t len;
+
+	*init_clock_value = 0;
 
 	if (ts_begin_field && bt_ctf_field_is_set_recursive(ts_begin_field)) {
 		/* Use provided `timestamp_begin` value as starting value */
 		ret = bt_ctf_field_integer_unsigned_get_value(ts_begin_field, &val);
 		BT_ASSERT_DBG(ret == 0);
-		init_clock_value = val;
+		*init_clock_value = val;
 	} else if (stream->last_ts_end != -1ULL) {
 		/* Use last packet's ending timestamp as starting value */
-		init_clock_value = stream->last_ts_end;
+		*init_clock_value = stream->last_ts_end;
 	}
 
-	cur_clock_value = init_clock_value;
-
 	if (stream->last_ts_end != -1ULL &&
-			cur_clock_value < stream->last_ts_end) {
+			*init_clock_value < stream->last_ts_end) {
 		BT_LOGW("Packet's initial timestamp is less than previous "
 			"packet's final timestamp: "
 			"stream-addr=%p, stream-name=\"%s\", "
 			"cur-packet-ts-begin=%" PRIu64 ", "
 			"prev-packet-ts-end=%" PRIu64,
 			stream, bt_ctf_stream_get_name(stream),
-			cur_clock_value, stream->last_ts_end);
+			*init_clock_value, stream->last_ts_end);
 		ret = -1;
 		goto end;
 	}
 
+end:
+	bt_ctf_object_put_ref(ts_begin_field);
+	return ret;
+}
+
+static
+int visit_packet_context_update_clock_value(struct bt_ctf_stream *stream,
+		uint64_t *val)
+{
+	int ret = 0;
+	struct bt_ctf_field_common *packet_context =
+		(void *) stream->packet_context;
+	uint64_t i;
+	int64_t len;
+
 	/*
-	 * Visit all the packet context fields, followed by all the
-	 * fields of all the events, in order, updating our current
-	 * clock value as we visit.
-	 *
 	 * While visiting the packet context fields, do not consider
-	 * `timestamp_begin` and `timestamp_end` because this function's
-	 * purpose is to set them anyway. Also do not consider
+	 * `timestamp_begin` and `timestamp_end` because the purpose of
+	 * the caller is to set them anyway. Also do not consider
 	 * `packet_size`, `content_size`, `events_discarded`, and
 	 * `packet_seq_num` if they are not set because those are
 	 * autopopulating fields.
@@ -795,8 +799,7 @@ int set_packet_context_timestamps(struct bt_ctf_stream *stream)
 			continue;
 		}
 
-		ret = visit_field_update_clock_value(member_field,
-			&cur_clock_value);
+		ret = visit_field_update_clock_value(member_field, val);
 		bt_ctf_object_put_ref(member_field);
 		if (ret) {
 			BT_LOGW("Cannot automatically update clock value "
@@ -809,25 +812,20 @@ int set_packet_context_timestamps(struct bt_ctf_stream *stream)
 		}
 	}
 
-	for (i = 0; i < stream->events->len; i++) {
-		struct bt_ctf_event *event = g_ptr_array_index(stream->events, i);
+end:
+	return ret;
+}
 
-		BT_ASSERT_DBG(event);
-		ret = visit_event_update_clock_value(event, &cur_clock_value);
-		if (ret) {
-			BT_LOGW("Cannot automatically update clock value "
-				"in stream's packet context: "
-				"stream-addr=%p, stream-name=\"%s\", "
-				"index=%" PRIu64 ", event-addr=%p, "
-				"event-class-id=%" PRId64 ", "
-				"event-class-name=\"%s\"",
-				stream, bt_ctf_stream_get_name(stream),
-				i, event,
-				bt_ctf_event_class_common_get_id(event->common.class),
-				bt_ctf_event_class_common_get_name(event->common.class));
-			goto end;
-		}
-	}
+static
+int set_packet_context_final_timestamps(struct bt_ctf_stream *stream,
+		uint64_t init_clock_value, uint64_t cur_clock_value)
+{
+	int ret = 0;
+	uint64_t val;
+	struct bt_ctf_field *ts_begin_field = bt_ctf_field_structure_get_field_by_name(
+		stream->packet_context, "timestamp_begin");
+	struct bt_ctf_field *ts_end_field = bt_ctf_field_structure_get_field_by_name(
+		stream->packet_context, "timestamp_end");
 
 	/*
 	 * Everything is visited, thus the current clock value
@@ -876,6 +874,58 @@ end:
 	return ret;
 }
 
+static
+int set_packet_context_timestamps(struct bt_ctf_stream *stream)
+{
+	int ret = 0;
+	uint64_t cur_clock_value;
+	uint64_t init_clock_value;
+	uint64_t i;
+
+	ret = get_packet_init_clock_value(stream, &init_clock_value);
+	if (ret) {
+		goto end;
+	}
+
+	/*
+	 * Visit all the packet context fields, followed by all the
+	 * fields of all the events, in order, updating our current
+	 * clock value as we visit.
+	 */
+	cur_clock_value = init_clock_value;
+	ret = visit_packet_context_update_clock_value(stream,
+		&cur_clock_value);
+	if (ret) {
+		goto end;
+	}
+
+	for (i = 0; i < stream->events->len; i++) {
+		struct bt_ctf_event *event = g_ptr_array_index(stream->events, i);
+
+		BT_ASSERT_DBG(event);
+		ret = visit_event_update_clock_value(event, &cur_clock_value);
+		if (ret) {
+			BT_LOGW("Cannot automatically update clock value "
+				"in stream's packet context: "
+				"stream-addr=%p, stream-name=\"%s\", "
+				"index=%" PRIu64 ", event-addr=%p, "
+				"event-class-id=%" PRId64 ", "
+				"event-class-name=\"%s\"",
+				stream, bt_ctf_stream_get_name(stream),
+				i, event,
+				bt_ctf_event_class_common_get_id(event->common.class),
+				bt_ctf_event_class_common_get_name(event->common.class));
+			goto end;
+		}
+	}
+
+	ret = set_packet_context_final_timestamps(stream, init_clock_value,
+		cur_clock_value);
+
+end:
+	return ret;
+}
+
 static
 int auto_populate_packet_context(struct bt_ctf_stream *stream, bool set_ts,
 		uint64_t packet_size_bits, uint64_t content_size_bits)
@@ -1364,113 +1414,664 @@ end:
 	return ret;
 }
 
-BT_EXPORT
-int bt_ctf_stream_append_event(struct bt_ctf_stream *stream,
-		struct bt_ctf_event *event)
+static
+void reset_structure_field(struct bt_ctf_field *structure, const char *name)
 {
-	int ret = 0;
+	struct bt_ctf_field *member;
 
-	if (!stream) {
-		BT_LOGW_STR("Invalid parameter: stream is NULL.");
-		ret = -1;
-		goto end;
+	member = bt_ctf_field_structure_get_field_by_name(structure, name);
+	if (member) {
+		bt_ctf_field_common_reset_recursive((void *) member);
+		bt_ctf_object_put_ref(member);
 	}
+}
 
-	if (!event) {
-		BT_LOGW_STR("Invalid parameter: event is NULL.");
-		ret = -1;
-		goto end;
+static
+void reset_packet_context_auto_fields(struct bt_ctf_stream *stream)
+{
+	if (stream->packet_context) {
+		reset_structure_field(stream->packet_context, "timestamp_begin");
+		reset_structure_field(stream->packet_context, "timestamp_end");
+		reset_structure_field(stream->packet_context, "packet_size");
+		reset_structure_field(stream->packet_context, "content_size");
+		reset_structure_field(stream->packet_context, "events_discarded");
 	}
+}
 
-	BT_LOGT("Appending event to stream: "
-		"stream-addr=%p, stream-name=\"%s\", event-addr=%p, "
-		"event-class-name=\"%s\", event-class-id=%" PRId64,
-		stream, bt_ctf_stream_get_name(stream), event,
-		bt_ctf_event_class_common_get_name(
-			bt_ctf_event_common_borrow_class(BT_CTF_TO_COMMON(event))),
-		bt_ctf_event_class_common_get_id(
-			bt_ctf_event_common_borrow_class(BT_CTF_TO_COMMON(event))));
+static
+enum bt_ctf_byte_order get_native_byte_order(struct bt_ctf_stream *stream)
+{
+	struct bt_ctf_trace *trace =
+		BT_CTF_FROM_COMMON(bt_ctf_stream_class_common_borrow_trace(
+			stream->common.stream_class));
 
-	/*
-	 * The event is not supposed to have a parent stream at this
-	 * point. The only other way an event can have a parent stream
-	 * is if it was assigned when setting a packet to the event,
-	 * in which case the packet's stream is not a writer stream,
-	 * and thus the user is trying to append an event which belongs
-	 * to another stream.
-	 */
-	if (event->common.base.parent) {
-		ret = -1;
-		goto end;
-	}
+	BT_ASSERT_DBG(trace);
+	return bt_ctf_trace_get_native_byte_order(trace);
+}
 
-	bt_ctf_object_set_parent(&event->common.base, &stream->common.base);
-	BT_LOGT_STR("Automatically populating the header of the event to append.");
-	ret = auto_populate_event_header(stream, event);
-	if (ret) {
-		/* auto_populate_event_header() reports errors */
-		goto error;
+static
+int serialize_event(struct bt_ctf_stream *stream, struct bt_ctf_event *event,
+		enum bt_ctf_byte_order native_byte_order)
+{
+	int ret = 0;
+	struct bt_ctf_event_class *event_class =
+		BT_CTF_FROM_COMMON(bt_ctf_event_common_borrow_class(
+			BT_CTF_TO_COMMON(event)));
+
+	BT_LOGT("Serializing event: event-addr=%p, "
+		"event-class-name=\"%s\", event-class-id=%" PRId64 ", "
+		"ser-offset=%" PRIu64,
+		event, bt_ctf_event_class_get_name(event_class),
+		bt_ctf_event_class_get_id(event_class),
+		bt_ctfser_get_offset_in_current_packet_bits(&stream->ctfser));
+
+	/* Write event header */
+	if (event->common.header_field) {
+		BT_LOGT_STR("Serializing event's header field.");
+		ret = bt_ctf_field_serialize_recursive(
+			(void *) event->common.header_field->field,
+			&stream->ctfser, native_byte_order);
+		if (ret) {
+			BT_LOGW("Cannot serialize event's header field: "
+				"field-addr=%p",
+				event->common.header_field->field);
+			goto end;
+		}
 	}
 
-	/* Make sure the various scopes of the event are set */
-	BT_LOGT_STR("Validating event to append.");
-	BT_CTF_ASSERT_PRE(bt_ctf_event_common_validate(BT_CTF_TO_COMMON(event)) == 0,
-		"Invalid event: event-addr=%p", event);
-
-	/* Save the new event and freeze it */
-	BT_LOGT_STR("Freezing the event to append.");
-	bt_ctf_event_common_set_is_frozen(BT_CTF_TO_COMMON(event), true);
-	g_ptr_array_add(stream->events, event);
+	/* Write stream event context */
+	if (event->common.stream_event_context_field) {
+		BT_LOGT_STR("Serializing event's stream event context field.");
+		ret = bt_ctf_field_serialize_recursive(
+			(void *) event->common.stream_event_context_field,
+			&stream->ctfser, native_byte_order);
+		if (ret) {
+			BT_LOGW("Cannot serialize event's stream event context field: "
+				"field-addr=%p",
+				event->common.stream_event_context_field);
+			goto end;
+		}
+	}
 
-	/*
-	 * Event had to hold a reference to its event class as long as it wasn't
-	 * part of the same trace hierarchy. From now on, the event and its
-	 * class share the same lifetime guarantees and the reference is no
-	 * longer needed.
-	 */
-	BT_LOGT_STR("Putting the event's class.");
-	bt_ctf_object_put_ref(event->common.class);
-	BT_LOGT("Appended event to stream: "
-		"stream-addr=%p, stream-name=\"%s\", event-addr=%p, "
-		"event-class-name=\"%s\", event-class-id=%" PRId64,
-		stream, bt_ctf_stream_get_name(stream), event,
-		bt_ctf_event_class_common_get_name(
-			bt_ctf_event_common_borrow_class(BT_CTF_TO_COMMON(event))),
-		bt_ctf_event_class_common_get_id(
-			bt_ctf_event_common_borrow_class(BT_CTF_TO_COMMON(event))));
+	/* Write event content */
+	ret = bt_ctf_event_serialize(event, &stream->ctfser,
+		native_byte_order);
+	if (ret) {
+		/* bt_ctf_event_serialize() logs errors */
+		goto end;
+	}
 
 end:
 	return ret;
-
-error:
-	/*
-	 * Orphan the event; we were not successful in associating it to
-	 * a stream.
-	 */
-	bt_ctf_object_set_parent(&event->common.base, NULL);
-	return ret;
 }
 
-BT_EXPORT
-struct bt_ctf_field *bt_ctf_stream_get_packet_context(struct bt_ctf_stream *stream)
+/*
+ * Opens a new packet and serializes the current packet header and
+ * packet context fields of `stream`, setting
+ * `*packet_context_offset_bits` to the offset of the latter within the
+ * packet so that close_packet() can overwrite it.
+ */
+static
+int open_packet(struct bt_ctf_stream *stream,
+		enum bt_ctf_byte_order native_byte_order,
+		uint64_t *packet_context_offset_bits)
 {
-	struct bt_ctf_field *packet_context = NULL;
+	int ret;
 
-	if (!stream) {
-		BT_LOGW_STR("Invalid parameter: stream is NULL.");
+	ret = bt_ctfser_open_packet(&stream->ctfser);
+	if (ret) {
+		/* bt_ctfser_open_packet() logs errors */
+		ret = -1;
 		goto end;
 	}
 
-	packet_context = stream->packet_context;
-	if (packet_context) {
-		bt_ctf_object_get_ref(packet_context);
+	if (stream->packet_header) {
+		BT_LOGT_STR("Serializing packet header field (initial).");
+		ret = bt_ctf_field_serialize_recursive(stream->packet_header,
+			&stream->ctfser, native_byte_order);
+		if (ret) {
+			BT_LOGW("Cannot serialize stream's packet header field: "
+				"field-addr=%p", stream->packet_header);
+			goto end;
+		}
+	}
+
+	if (stream->packet_context) {
+		/* Save packet context's position to overwrite it later */
+		*packet_context_offset_bits =
+			bt_ctfser_get_offset_in_current_packet_bits(
+				&stream->ctfser);
+
+		/* Write packet context */
+		BT_LOGT_STR("Serializing packet context field (initial).");
+		ret = bt_ctf_field_serialize_recursive(stream->packet_context,
+			&stream->ctfser, native_byte_order);
+		if (ret) {
+			BT_LOGW("Cannot serialize stream's packet context field: "
+				"field-addr=%p", stream->packet_context);
+			goto end;
+		}
 	}
+
 end:
-	return packet_context;
+	return ret;
 }
 
-BT_EXPORT
-int bt_ctf_stream_set_packet_context(struct bt_ctf_stream *stream,
+/*
+ * Closes the current packet of `stream`, of which the content ends at
+ * the current serializer offset, after overwriting its packet context
+ * field (at `packet_context_offset_bits`) with its final packet and
+ * content sizes.
+ */
+static
+int close_packet(struct bt_ctf_stream *stream,
+		enum bt_ctf_byte_order native_byte_order, bool has_packet_size,
+		uint64_t packet_context_offset_bits,
+		uint64_t *content_size_bits, uint64_t *packet_size_bits)
+{
+	int ret = 0;
+
+	*content_size_bits = bt_ctfser_get_offset_in_current_packet_bits(
+		&stream->ctfser);
+
+	if (!has_packet_size && *content_size_bits % 8 != 0) {
+		BT_LOGW("Stream's packet context field type has no `packet_size` field, "
+			"but current content size is not a multiple of 8 bits: "
+			"content-size=%" PRIu64 ", "
+			"packet-size=%" PRIu64,
+			*content_size_bits,
+			*packet_size_bits);
+		ret = -1;
+		goto end;
+	}
+
+	/* Set packet size; make it a multiple of 8 */
+	*packet_size_bits = (*content_size_bits + 7) & ~UINT64_C(7);
+
+	if (stream->packet_context) {
+		/*
+		 * The whole packet is serialized at this point. Make
+		 * sure that, if `packet_size` is missing, the current
+		 * content size is equal to the current packet size.
+		 */
+		struct bt_ctf_field *field =
+			bt_ctf_field_structure_get_field_by_name(
+				stream->packet_context, "content_size");
+
+		bt_ctf_object_put_ref(field);
+		if (!field) {
+			if (*content_size_bits != *packet_size_bits) {
+				BT_LOGW("Stream's packet context's `content_size` field is missing, "
+					"but current packet's content size is not equal to its packet size: "
+					"content-size=%" PRIu64 ", "
+					"packet-size=%" PRIu64,
+					bt_ctfser_get_offset_in_current_packet_bits(&stream->ctfser),
+					*packet_size_bits);
+				ret = -1;
+				goto end;
+			}
+		}
+
+		/*
+		 * Overwrite the packet context now that the stream
+		 * position's packet and content sizes have the correct
+		 * values.
+		 */
+		bt_ctfser_set_offset_in_current_packet_bits(&stream->ctfser,
+			packet_context_offset_bits);
+		ret = auto_populate_packet_context(stream, false,
+			*packet_size_bits, *content_size_bits);
+		if (ret) {
+			BT_LOGW_STR("Cannot automatically populate the stream's packet context field.");
+			ret = -1;
+			goto end;
+		}
+
+		BT_LOGT("Rewriting (serializing) packet context field.");
+		ret = bt_ctf_field_serialize_recursive(stream->packet_context,
+			&stream->ctfser, native_byte_order);
+		if (ret) {
+			BT_LOGW("Cannot serialize stream's packet context field: "
+				"field-addr=%p", stream->packet_context);
+			goto end;
+		}
+	}
+
+	stream->flushed_packet_count++;
+	bt_ctfser_close_current_packet(&stream->ctfser, *packet_size_bits / 8);
+
+end:
+	return ret;
+}
+
+/*
+ * Opens a new packet in streaming mode.
+ *
+ * The packet context is computed incrementally as events are appended:
+ * this function sets `timestamp_begin` and initializes the current
+ * clock value of the packet, while close_streaming_packet() sets the
+ * other automatic fields.
+ */
+static
+int open_streaming_packet(struct bt_ctf_stream *stream)
+{
+	int ret;
+	uint64_t init_clock_value;
+	uint64_t cur_clock_value;
+	struct bt_ctf_field *ts_begin_field = NULL;
+	struct bt_ctf_field *ts_end_field = NULL;
+
+	BT_ASSERT_DBG(!stream->streaming.packet_is_open);
+	BT_LOGT("Opening stream's packet (streaming mode): stream-addr=%p, "
+		"stream-name=\"%s\", packet-index=%u", stream,
+		bt_ctf_stream_get_name(stream), stream->flushed_packet_count);
+
+	ret = auto_populate_packet_header(stream);
+	if (ret) {
+		BT_LOGW_STR("Cannot automatically populate the stream's packet header field.");
+		ret = -1;
+		goto end;
+	}
+
+	/* Initialize packet/content sizes to `0`; we will overwrite later */
+	ret = auto_populate_packet_context(stream, false, 0, 0);
+	if (ret) {
+		BT_LOGW_STR("Cannot automatically populate the stream's packet context field.");
+		ret = -1;
+		goto end;
+	}
+
+	ret = get_packet_init_clock_value(stream, &init_clock_value);
+	if (ret) {
+		goto end;
+	}
+
+	cur_clock_value = init_clock_value;
+	ret = visit_packet_context_update_clock_value(stream,
+		&cur_clock_value);
+	if (ret) {
+		goto end;
+	}
+
+	/*
+	 * `timestamp_begin` is already known. Set `timestamp_end`, if
+	 * not set by the user, to the current clock value for the
+	 * initial packet context serialization:
+	 * close_streaming_packet() resets it to compute its final
+	 * value.
+	 */
+	ts_begin_field = bt_ctf_field_structure_get_field_by_name(
+		stream->packet_context, "timestamp_begin");
+	if (ts_begin_field && !bt_ctf_field_is_set_recursive(ts_begin_field)) {
+		ret = set_integer_field_value(ts_begin_field, init_clock_value);
+		BT_ASSERT_DBG(ret == 0);
+	}
+
+	ts_end_field = bt_ctf_field_structure_get_field_by_name(
+		stream->packet_context, "timestamp_end");
+	stream->streaming.ts_end_is_auto = ts_end_field &&
+		!bt_ctf_field_is_set_recursive(ts_end_field);
+	if (stream->streaming.ts_end_is_auto) {
+		ret = set_integer_field_value(ts_end_field, cur_clock_value);
+		BT_ASSERT_DBG(ret == 0);
+	}
+
+	ret = open_packet(stream, get_native_byte_order(stream),
+		&stream->streaming.packet_context_offset_bits);
+	if (ret) {
+		goto end;
+	}
+
+	stream->streaming.init_clock_value = init_clock_value;
+	stream->streaming.cur_clock_value = cur_clock_value;
+	stream->streaming.event_count = 0;
+	stream->streaming.packet_is_open = true;
+
+end:
+	if (ret) {
+		reset_packet_context_auto_fields(stream);
+	}
+
+	bt_ctf_object_put_ref(ts_begin_field);
+	bt_ctf_object_put_ref(ts_end_field);
+	return ret;
+}
+
+/*
+ * Closes the current packet in streaming mode, setting the final
+ * values of the automatic packet context fields.
+ */
+static
+int close_streaming_packet(struct bt_ctf_stream *stream)
+{
+	int ret;
+	uint64_t content_size_bits = 0;
+	uint64_t packet_size_bits = 0;
+
+	BT_ASSERT_DBG(stream->streaming.packet_is_open);
+
+	if (stream->streaming.ts_end_is_auto) {
+		reset_structure_field(stream->packet_context, "timestamp_end");
+	}
+
+	ret = set_packet_context_final_timestamps(stream,
+		stream->streaming.init_clock_value,
+		stream->streaming.cur_clock_value);
+	if (ret) {
+		BT_LOGW("Cannot set packet context's timestamp fields: "
+			"stream-addr=%p, stream-name=\"%s\"",
+			stream, bt_ctf_stream_get_name(stream));
+		goto end;
+	}
+
+	ret = close_packet(stream, get_native_byte_order(stream), true,
+		stream->streaming.packet_context_offset_bits,
+		&content_size_bits, &packet_size_bits);
+	if (ret) {
+		goto end;
+	}
+
+	stream->streaming.packet_is_open = false;
+	BT_LOGT("Closed stream's packet (streaming mode): "
+		"event-count=%" PRIu64 ", "
+		"content-size=%" PRIu64 ", packet-size=%" PRIu64,
+		stream->streaming.event_count, content_size_bits,
+		packet_size_bits);
+
+end:
+	/* Reset automatically-set fields. */
+	reset_packet_context_auto_fields(stream);
+	return ret;
+}
+
+/*
+ * Updates the current clock value of the current streaming packet of
+ * `stream` with the fields of `event`, and serializes `event`.
+ */
+static
+int serialize_streaming_event(struct bt_ctf_stream *stream,
+		struct bt_ctf_event *event,
+		enum bt_ctf_byte_order native_byte_order)
+{
+	int ret;
+
+	ret = visit_event_update_clock_value(event,
+		&stream->streaming.cur_clock_value);
+	if (ret) {
+		BT_LOGW("Cannot automatically update clock value "
+			"in stream's packet context: "
+			"stream-addr=%p, stream-name=\"%s\", event-addr=%p",
+			stream, bt_ctf_stream_get_name(stream), event);
+		goto end;
+	}
+
+	ret = serialize_event(stream, event, native_byte_order);
+
+end:
+	return ret;
+}
+
+/*
+ * Serializes `event` into the current packet of `stream` (streaming
+ * mode), opening a packet first if needed.
+ *
+ * If the current packet already contains events and `event` makes it
+ * larger than the maximum packet size, closes it without `event` and
+ * serializes `event` again into a new packet.
+ */
+static
+int append_event_streaming(struct bt_ctf_stream *stream,
+		struct bt_ctf_event *event)
+{
+	int ret = 0;
+	enum bt_ctf_byte_order native_byte_order =
+		get_native_byte_order(stream);
+	uint64_t event_offset_bits;
+	uint64_t prev_clock_value;
+
+	if (!stream->streaming.packet_is_open) {
+		ret = open_streaming_packet(stream);
+		if (ret) {
+			goto end;
+		}
+	}
+
+	event_offset_bits = bt_ctfser_get_offset_in_current_packet_bits(
+		&stream->ctfser);
+	prev_clock_value = stream->streaming.cur_clock_value;
+	ret = serialize_streaming_event(stream, event, native_byte_order);
+	if (ret) {
+		goto error;
+	}
+
+	if (stream->streaming.max_packet_size_bits > 0 &&
+			stream->streaming.event_count > 0 &&
+			bt_ctfser_get_offset_in_current_packet_bits(&stream->ctfser) >
+				stream->streaming.max_packet_size_bits) {
+		BT_LOGT("Event doesn't fit in the current packet: "
+			"closing it and opening a new one: "
+			"stream-addr=%p, stream-name=\"%s\", "
+			"event-addr=%p, max-packet-size=%" PRIu64,
+			stream, bt_ctf_stream_get_name(stream), event,
+			stream->streaming.max_packet_size_bits);
+		bt_ctfser_set_offset_in_current_packet_bits(&stream->ctfser,
+			event_offset_bits);
+		stream->streaming.cur_clock_value = prev_clock_value;
+		ret = close_streaming_packet(stream);
+		if (ret) {
+			goto error;
+		}
+
+		ret = open_streaming_packet(stream);
+		if (ret) {
+			goto end;
+		}
+
+		event_offset_bits = bt_ctfser_get_offset_in_current_packet_bits(
+			&stream->ctfser);
+		prev_clock_value = stream->streaming.cur_clock_value;
+		ret = serialize_streaming_event(stream, event,
+			native_byte_order);
+		if (ret) {
+			goto error;
+		}
+	}
+
+	stream->streaming.event_count++;
+	goto end;
+
+error:
+	/* Forget what was serialized of this event */
+	bt_ctfser_set_offset_in_current_packet_bits(&stream->ctfser,
+		event_offset_bits);
+	stream->streaming.cur_clock_value = prev_clock_value;
+
+end:
+	return ret;
+}
+
+BT_EXPORT
+int bt_ctf_stream_append_event(struct bt_ctf_stream *stream,
+		struct bt_ctf_event *event)
+{
+	int ret = 0;
+
+	if (!stream) {
+		BT_LOGW_STR("Invalid parameter: stream is NULL.");
+		ret = -1;
+		goto end;
+	}
+
+	if (!event) {
+		BT_LOGW_STR("Invalid parameter: event is NULL.");
+		ret = -1;
+		goto end;
+	}
+
+	BT_LOGT("Appending event to stream: "
+		"stream-addr=%p, stream-name=\"%s\", event-addr=%p, "
+		"event-class-name=\"%s\", event-class-id=%" PRId64,
+		stream, bt_ctf_stream_get_name(stream), event,
+		bt_ctf_event_class_common_get_name(
+			bt_ctf_event_common_borrow_class(BT_CTF_TO_COMMON(event))),
+		bt_ctf_event_class_common_get_id(
+			bt_ctf_event_common_borrow_class(BT_CTF_TO_COMMON(event))));
+
+	/*
+	 * The event is not supposed to have a parent stream at this
+	 * point. The only other way an event can have a parent stream
+	 * is if it was assigned when setting a packet to the event,
+	 * in which case the packet's stream is not a writer stream,
+	 * and thus the user is trying to append an event which belongs
+	 * to another stream.
+	 */
+	if (event->common.base.parent) {
+		ret = -1;
+		goto end;
+	}
+
+	bt_ctf_object_set_parent(&event->common.base, &stream->common.base);
+	BT_LOGT_STR("Automatically populating the header of the event to append.");
+	ret = auto_populate_event_header(stream, event);
+	if (ret) {
+		/* auto_populate_event_header() reports errors */
+		goto error;
+	}
+
+	/* Make sure the various scopes of the event are set */
+	BT_LOGT_STR("Validating event to append.");
+	BT_CTF_ASSERT_PRE(bt_ctf_event_common_validate(BT_CTF_TO_COMMON(event)) == 0,
+		"Invalid event: event-addr=%p", event);
+
+	/* Save the new event and freeze it */
+	BT_LOGT_STR("Freezing the event to append.");
+	bt_ctf_event_common_set_is_frozen(BT_CTF_TO_COMMON(event), true);
+
+	if (stream->streaming.enabled) {
+		/*
+		 * Serialize the event immediately: the stream doesn't
+		 * keep it, therefore the event keeps its reference to its
+		 * class.
+		 */
+		ret = append_event_streaming(stream, event);
+		if (ret) {
+			goto error;
+		}
+
+		bt_ctf_object_set_parent(&event->common.base, NULL);
+		BT_LOGT("Appended and serialized event to stream: "
+			"stream-addr=%p, stream-name=\"%s\", event-addr=%p",
+			stream, bt_ctf_stream_get_name(stream), event);
+		goto end;
+	}
+
+	g_ptr_array_add(stream->events, event);
+
+	/*
+	 * Event had to hold a reference to its event class as long as it wasn't
+	 * part of the same trace hierarchy. From now on, the event and its
+	 * class share the same lifetime guarantees and the reference is no
+	 * longer needed.
+	 */
+	BT_LOGT_STR("Putting the event's class.");
+	bt_ctf_object_put_ref(event->common.class);
+	BT_LOGT("Appended event to stream: "
+		"stream-addr=%p, stream-name=\"%s\", event-addr=%p, "
+		"event-class-name=\"%s\", event-class-id=%" PRId64,
+		stream, bt_ctf_stream_get_name(stream), event,
+		bt_ctf_event_class_common_get_name(
+			bt_ctf_event_common_borrow_class(BT_CTF_TO_COMMON(event))),
+		bt_ctf_event_class_common_get_id(
+			bt_ctf_event_common_borrow_class(BT_CTF_TO_COMMON(event))));
+
+end:
+	return ret;
+
+error:
+	/*
+	 * Orphan the event; we were not successful in associating it to
+	 * a stream.
+	 */
+	bt_ctf_object_set_parent(&event->common.base, NULL);
+	return ret;
+}
+
+BT_EXPORT
+int bt_ctf_stream_enable_streaming(struct bt_ctf_stream *stream,
+		uint64_t max_packet_size)
+{
+	int ret = 0;
+	struct bt_ctf_field *packet_size_field = NULL;
+
+	if (!stream) {
+		BT_LOGW_STR("Invalid parameter: stream is NULL.");
+		ret = -1;
+		goto end;
+	}
+
+	if (stream->events->len > 0) {
+		BT_LOGW("Invalid parameter: stream's current packet contains events: "
+			"stream-addr=%p, stream-name=\"%s\", event-count=%u",
+			stream, bt_ctf_stream_get_name(stream),
+			stream->events->len);
+		ret = -1;
+		goto end;
+	}
+
+	if (stream->packet_context) {
+		packet_size_field = bt_ctf_field_structure_get_field_by_name(
+			stream->packet_context, "packet_size");
+	}
+
+	if (!packet_size_field) {
+		BT_LOGW("Invalid parameter: stream's packet context has no `packet_size` field: "
+			"stream-addr=%p, stream-name=\"%s\"",
+			stream, bt_ctf_stream_get_name(stream));
+		ret = -1;
+		goto end;
+	}
+
+	if (max_packet_size > UINT64_MAX / 8) {
+		BT_LOGW("Invalid parameter: maximum packet size is too large: "
+			"stream-addr=%p, stream-name=\"%s\", "
+			"max-packet-size=%" PRIu64,
+			stream, bt_ctf_stream_get_name(stream),
+			max_packet_size);
+		ret = -1;
+		goto end;
+	}
+
+	stream->streaming.enabled = true;
+	stream->streaming.max_packet_size_bits = max_packet_size * 8;
+	BT_LOGT("Enabled stream's streaming mode: "
+		"stream-addr=%p, stream-name=\"%s\", max-packet-size=%" PRIu64,
+		stream, bt_ctf_stream_get_name(stream), max_packet_size);
+
+end:
+	bt_ctf_object_put_ref(packet_size_field);
+	return ret;
+}
+
+BT_EXPORT
+struct bt_ctf_field *bt_ctf_stream_get_packet_context(struct bt_ctf_stream *stream)
+{
+	struct bt_ctf_field *packet_context = NULL;
+
+	if (!stream) {
+		BT_LOGW_STR("Invalid parameter: stream is NULL.");
+		goto end;
+	}
+
+	packet_context = stream->packet_context;
+	if (packet_context) {
+		bt_ctf_object_get_ref(packet_context);
+	}
+end:
+	return packet_context;
+}
+
+BT_EXPORT
+int bt_ctf_stream_set_packet_context(struct bt_ctf_stream *stream,
 		struct bt_ctf_field *field)
 {
 	int ret = 0;
@@ -1584,25 +2185,12 @@ end:
 	return ret;
 }
 
-static
-void reset_structure_field(struct bt_ctf_field *structure, const char *name)
-{
-	struct bt_ctf_field *member;
-
-	member = bt_ctf_field_structure_get_field_by_name(structure, name);
-	if (member) {
-		bt_ctf_field_common_reset_recursive((void *) member);
-		bt_ctf_object_put_ref(member);
-	}
-}
-
 BT_EXPORT
 int bt_ctf_stream_flush(struct bt_ctf_stream *stream)
 {
 	int ret = 0;
 	size_t i;
 	uint64_t packet_context_offset_bits = 0;
-	struct bt_ctf_trace *trace;
 	enum bt_ctf_byte_order native_byte_order;
 	bool has_packet_size = false;
 	uint64_t packet_size_bits = 0;
@@ -1637,13 +2225,27 @@ int bt_ctf_stream_flush(struct bt_ctf_stream *stream)
 		}
 	}
 
+	if (stream->streaming.enabled) {
+		/*
+		 * The events of the current packet are already
+		 * serialized: only close it, opening an empty one first
+		 * if needed.
+		 */
+		if (!stream->streaming.packet_is_open) {
+			ret = open_streaming_packet(stream);
+			if (ret) {
+				goto end_no_stream;
+			}
+		}
+
+		ret = close_streaming_packet(stream);
+		goto end_no_stream;
+	}
+
 	BT_LOGT("Flushing stream's current packet: stream-addr=%p, "
 		"stream-name=\"%s\", packet-index=%u", stream,
 		bt_ctf_stream_get_name(stream), stream->flushed_packet_count);
-	trace = BT_CTF_FROM_COMMON(bt_ctf_stream_class_common_borrow_trace(
-		stream->common.stream_class));
-	BT_ASSERT_DBG(trace);
-	native_byte_order = bt_ctf_trace_get_native_byte_order(trace);
+	native_byte_order = get_native_byte_order(stream);
 
 	ret = auto_populate_packet_header(stream);
 	if (ret) {
@@ -1660,174 +2262,35 @@ int bt_ctf_stream_flush(struct bt_ctf_stream *stream)
 		goto end;
 	}
 
-	ret = bt_ctfser_open_packet(&stream->ctfser);
+	ret = open_packet(stream, native_byte_order,
+		&packet_context_offset_bits);
 	if (ret) {
-		/* bt_ctfser_open_packet() logs errors */
-		ret = -1;
 		goto end;
 	}
 
-	if (stream->packet_header) {
-		BT_LOGT_STR("Serializing packet header field (initial).");
-		ret = bt_ctf_field_serialize_recursive(stream->packet_header,
-			&stream->ctfser, native_byte_order);
-		if (ret) {
-			BT_LOGW("Cannot serialize stream's packet header field: "
-				"field-addr=%p", stream->packet_header);
-			goto end;
-		}
-	}
-
-	if (stream->packet_context) {
-		/* Save packet context's position to overwrite it later */
-		packet_context_offset_bits =
-			bt_ctfser_get_offset_in_current_packet_bits(
-				&stream->ctfser);
-
-		/* Write packet context */
-		BT_LOGT_STR("Serializing packet context field (initial).");
-		ret = bt_ctf_field_serialize_recursive(stream->packet_context,
-			&stream->ctfser, native_byte_order);
-		if (ret) {
-			BT_LOGW("Cannot serialize stream's packet context field: "
-				"field-addr=%p", stream->packet_context);
-			goto end;
-		}
-	}
-
 	BT_LOGT("Serializing events: count=%u", stream->events->len);
 
 	for (i = 0; i < stream->events->len; i++) {
-		struct bt_ctf_event *event = g_ptr_array_index(
-			stream->events, i);
-		struct bt_ctf_event_class *event_class =
-			BT_CTF_FROM_COMMON(bt_ctf_event_common_borrow_class(
-				BT_CTF_TO_COMMON(event)));
-
-		BT_LOGT("Serializing event: index=%zu, event-addr=%p, "
-			"event-class-name=\"%s\", event-class-id=%" PRId64 ", "
-			"ser-offset=%" PRIu64,
-			i, event, bt_ctf_event_class_get_name(event_class),
-			bt_ctf_event_class_get_id(event_class),
-			bt_ctfser_get_offset_in_current_packet_bits(
-				&stream->ctfser));
-
-		/* Write event header */
-		if (event->common.header_field) {
-			BT_LOGT_STR("Serializing event's header field.");
-			ret = bt_ctf_field_serialize_recursive(
-				(void *) event->common.header_field->field,
-				&stream->ctfser, native_byte_order);
-			if (ret) {
-				BT_LOGW("Cannot serialize event's header field: "
-					"field-addr=%p",
-					event->common.header_field->field);
-				goto end;
-			}
-		}
-
-		/* Write stream event context */
-		if (event->common.stream_event_context_field) {
-			BT_LOGT_STR("Serializing event's stream event context field.");
-			ret = bt_ctf_field_serialize_recursive(
-				(void *) event->common.stream_event_context_field,
-				&stream->ctfser, native_byte_order);
-			if (ret) {
-				BT_LOGW("Cannot serialize event's stream event context field: "
-					"field-addr=%p",
-					event->common.stream_event_context_field);
-				goto end;
-			}
-		}
-
-		/* Write event content */
-		ret = bt_ctf_event_serialize(event, &stream->ctfser,
+		ret = serialize_event(stream,
+			g_ptr_array_index(stream->events, i),
 			native_byte_order);
 		if (ret) {
-			/* bt_ctf_event_serialize() logs errors */
 			goto end;
 		}
 	}
 
-	content_size_bits = bt_ctfser_get_offset_in_current_packet_bits(
-		&stream->ctfser);
-
-	if (!has_packet_size && content_size_bits % 8 != 0) {
-		BT_LOGW("Stream's packet context field type has no `packet_size` field, "
-			"but current content size is not a multiple of 8 bits: "
-			"content-size=%" PRIu64 ", "
-			"packet-size=%" PRIu64,
-			content_size_bits,
-			packet_size_bits);
-		ret = -1;
+	ret = close_packet(stream, native_byte_order, has_packet_size,
+		packet_context_offset_bits, &content_size_bits,
+		&packet_size_bits);
+	if (ret) {
 		goto end;
 	}
 
-	/* Set packet size; make it a multiple of 8 */
-	packet_size_bits = (content_size_bits + 7) & ~UINT64_C(7);
-
-	if (stream->packet_context) {
-		/*
-		 * The whole packet is serialized at this point. Make
-		 * sure that, if `packet_size` is missing, the current
-		 * content size is equal to the current packet size.
-		 */
-		struct bt_ctf_field *field =
-			bt_ctf_field_structure_get_field_by_name(
-				stream->packet_context, "content_size");
-
-		bt_ctf_object_put_ref(field);
-		if (!field) {
-			if (content_size_bits != packet_size_bits) {
-				BT_LOGW("Stream's packet context's `content_size` field is missing, "
-					"but current packet's content size is not equal to its packet size: "
-					"content-size=%" PRIu64 ", "
-					"packet-size=%" PRIu64,
-					bt_ctfser_get_offset_in_current_packet_bits(&stream->ctfser),
-					packet_size_bits);
-				ret = -1;
-				goto end;
-			}
-		}
-
-		/*
-		 * Overwrite the packet context now that the stream
-		 * position's packet and content sizes have the correct
-		 * values.
-		 */
-		bt_ctfser_set_offset_in_current_packet_bits(&stream->ctfser,
-			packet_context_offset_bits);
-		ret = auto_populate_packet_context(stream, false,
-			packet_size_bits, content_size_bits);
-		if (ret) {
-			BT_LOGW_STR("Cannot automatically populate the stream's packet context field.");
-			ret = -1;
-			goto end;
-		}
-
-		BT_LOGT("Rewriting (serializing) packet context field.");
-		ret = bt_ctf_field_serialize_recursive(stream->packet_context,
-			&stream->ctfser, native_byte_order);
-		if (ret) {
-			BT_LOGW("Cannot serialize stream's packet context field: "
-				"field-addr=%p", stream->packet_context);
-			goto end;
-		}
-	}
-
 	g_ptr_array_set_size(stream->events, 0);
-	stream->flushed_packet_count++;
-	bt_ctfser_close_current_packet(&stream->ctfser, packet_size_bits / 8);
 
 end:
 	/* Reset automatically-set fields. */
-	if (stream->packet_context) {
-		reset_structure_field(stream->packet_context, "timestamp_begin");
-		reset_structure_field(stream->packet_context, "timestamp_end");
-		reset_structure_field(stream->packet_context, "packet_size");
-		reset_structure_field(stream->packet_context, "content_size");
-		reset_structure_field(stream->packet_context, "events_discarded");
-	}
+	reset_packet_context_auto_fields(stream);
 
 	if (ret == 0) {
 		BT_LOGT("Flushed stream's current packet: "
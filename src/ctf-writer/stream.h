@@ -14,6 +14,7 @@
 #include "common/macros.h"
 #include <babeltrace2-ctf-writer/stream.h>
 #include "ctfser/ctfser.h"
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "assert-pre.h"
@@ -78,6 +79,37 @@ struct bt_ctf_stream {
 	unsigned int flushed_packet_count;
 	uint64_t discarded_events;
 	uint64_t last_ts_end;
+
+	/*
+	 * Streaming mode (see bt_ctf_stream_enable_streaming()): events
+	 * are serialized when appended instead of being kept in
+	 * `events` until the next flush.
+	 */
+	struct {
+		bool enabled;
+
+		/* Maximum packet size (bits), or 0 for no automatic rollover */
+		uint64_t max_packet_size_bits;
+
+		/* Whether or not a packet is currently open */
+		bool packet_is_open;
+
+		/* Offset of the packet context within the current packet */
+		uint64_t packet_context_offset_bits;
+
+		/* Initial and current clock values of the current packet */
+		uint64_t init_clock_value;
+		uint64_t cur_clock_value;
+
+		/*
+		 * Whether or not the packet context's `timestamp_end`
+		 * field is automatically set
+		 */
+		bool ts_end_is_auto;
+
+		/* Number of events in the current packet */
+		uint64_t event_count;
+	} streaming;
 };
 
 struct bt_ctf_stream *bt_ctf_stream_create_with_id(
@@ -261,3 +261,15 @@ void bt_ctfser_close_current_packet(struct bt_ctfser *ctfser,
 		ctfser->path->str, ctfser->fd,
 		ctfser->stream_size_bytes);
 }
+
+void bt_ctfser_discard_closed_packet(struct bt_ctfser *ctfser)
+{
+	BT_LOGD("Discarding closed packet: path=\"%s\", fd=%d, "
+		"packet-size-bytes=%" PRIu64,
+		ctfser->path->str, ctfser->fd,
+		ctfser->prev_packet_size_bytes);
+	BT_ASSERT(ctfser->stream_size_bytes >=
+		ctfser->prev_packet_size_bytes);
+	ctfser->stream_size_bytes -= ctfser->prev_packet_size_bytes;
+	ctfser->prev_packet_size_bytes = 0;
+}
@@ -94,6 +94,14 @@ BT_EXTERN_C
 void bt_ctfser_close_current_packet(struct bt_ctfser *ctfser,
 		uint64_t packet_size_bytes);
 
+/*
+ * Discards the packet which bt_ctfser_close_current_packet() just
+ * closed: the next packet which bt_ctfser_open_packet() opens
+ * overwrites it in the stream file.
+ */
+BT_EXTERN_C
+void bt_ctfser_discard_closed_packet(struct bt_ctfser *ctfser);
+
 BT_EXTERN_C
 int _bt_ctfser_increase_cur_packet_size(struct bt_ctfser *ctfser);
 
@@ -556,6 +564,48 @@ void bt_ctfser_set_offset_in_current_packet_bits(struct bt_ctfser *ctfser,
 	ctfser->offset_in_cur_packet_bits = offset_bits;
 }
 
+/*
+ * Returns the address of the first byte of the packet which
+ * bt_ctfser_close_current_packet() just closed.
+ *
+ * This address remains valid until the next call to
+ * bt_ctfser_open_packet() or bt_ctfser_fini().
+ */
+static inline
+const uint8_t *bt_ctfser_get_closed_packet_addr(struct bt_ctfser *ctfser)
+{
+	BT_ASSERT_DBG(ctfser->base_mma);
+	return ((const uint8_t *) mmap_align_addr(ctfser->base_mma)) +
+		ctfser->mmap_base_offset;
+}
+
+/*
+ * Writes the `size` bytes of `data` at the current offset, which must
+ * be byte-aligned, within the current packet.
+ */
+static inline
+int bt_ctfser_write_bytes(struct bt_ctfser *ctfser, const uint8_t *data,
+		size_t size)
+{
+	int ret = 0;
+	const uint64_t size_bits = (uint64_t) size * 8;
+
+	BT_ASSERT_DBG(ctfser->offset_in_cur_packet_bits % 8 == 0);
+
+	while (G_UNLIKELY(!_bt_ctfser_has_space_left(ctfser, size_bits))) {
+		ret = _bt_ctfser_increase_cur_packet_size(ctfser);
+		if (G_UNLIKELY(ret)) {
+			goto end;
+		}
+	}
+
+	memcpy(_bt_ctfser_get_addr(ctfser), data, size);
+	_bt_ctfser_incr_offset(ctfser, size_bits);
+
+end:
+	return ret;
+}
+
 static inline
 const char *bt_ctfser_get_file_path(struct bt_ctfser *ctfser)
 {
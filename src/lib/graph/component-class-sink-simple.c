@@ -15,6 +15,7 @@
 #include <babeltrace2/graph/self-component.h>
 #include <babeltrace2/graph/message-iterator.h>
 #include <glib.h>
+#include <pthread.h>
 
 #include "component-class-sink-simple.h"
 #include "lib/func-status.h"
@@ -23,10 +24,17 @@
  * We keep a single simple sink component class reference. It's created
  * the first time bt_component_class_sink_simple_borrow() is called and
  * put by the put_simple_sink_component_class() library destructor.
+ *
+ * `simple_comp_cls_lock` protects its creation: the threads of
+ * independent graphs may call bt_component_class_sink_simple_borrow()
+ * concurrently.
  */
 static
 struct bt_component_class_sink *simple_comp_cls;
 
+static
+pthread_mutex_t simple_comp_cls_lock = PTHREAD_MUTEX_INITIALIZER;
+
 struct simple_sink_data {
 	bt_message_iterator *msg_iter;
 	struct simple_sink_init_method_data init_method_data;
@@ -185,31 +193,47 @@ enum bt_component_class_sink_consume_method_status simple_sink_consume(
 struct bt_component_class_sink *bt_component_class_sink_simple_borrow(void)
 {
 	enum bt_component_class_set_method_status set_method_status;
+	struct bt_component_class_sink *comp_cls;
 
-	if (simple_comp_cls) {
+	/* Fast path: already created */
+	comp_cls = __atomic_load_n(&simple_comp_cls, __ATOMIC_ACQUIRE);
+	if (comp_cls) {
 		goto end;
 	}
 
-	simple_comp_cls = bt_component_class_sink_create("simple-sink",
+	pthread_mutex_lock(&simple_comp_cls_lock);
+	comp_cls = simple_comp_cls;
+	if (comp_cls) {
+		/* Created by another thread meanwhile */
+		goto end_unlock;
+	}
+
+	comp_cls = bt_component_class_sink_create("simple-sink",
 		simple_sink_consume);
-	if (!simple_comp_cls) {
+	if (!comp_cls) {
 		BT_LIB_LOGE_APPEND_CAUSE(
 			"Cannot create simple sink component class.");
-		goto end;
+		goto end_unlock;
 	}
 
 	set_method_status = bt_component_class_sink_set_initialize_method(
-		simple_comp_cls, simple_sink_init);
+		comp_cls, simple_sink_init);
 	BT_ASSERT(set_method_status == BT_FUNC_STATUS_OK);
 	set_method_status = bt_component_class_sink_set_finalize_method(
-		simple_comp_cls, simple_sink_finalize);
+		comp_cls, simple_sink_finalize);
 	BT_ASSERT(set_method_status == BT_FUNC_STATUS_OK);
 	set_method_status = bt_component_class_sink_set_graph_is_configured_method(
-		simple_comp_cls, simple_sink_graph_is_configured);
+		comp_cls, simple_sink_graph_is_configured);
 	BT_ASSERT(set_method_status == BT_FUNC_STATUS_OK);
 
+	/* Publish the complete component class */
+	__atomic_store_n(&simple_comp_cls, comp_cls, __ATOMIC_RELEASE);
+
+end_unlock:
+	pthread_mutex_unlock(&simple_comp_cls_lock);
+
 end:
-	return simple_comp_cls;
+	return comp_cls;
 }
 
 __attribute__((destructor)) static
@@ -93,7 +93,7 @@ int bt_component_class_init(struct bt_component_class *class,
 {
 	int ret = 0;
 
-	bt_object_init_shared(&class->base, destroy_component_class);
+	bt_object_init_shared_atomic(&class->base, destroy_component_class);
 	class->type = type;
 	class->name = g_string_new(name);
 	if (!class->name) {
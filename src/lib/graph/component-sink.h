@@ -15,9 +15,17 @@
 
 #include "component.h"
 
+struct bt_profile_record;
+
 struct bt_component_sink {
 	struct bt_component parent;
 	bool graph_is_configured_method_called;
+
+	/*
+	 * Profile record (owned by the profile of the graph), or `NULL`
+	 * if profiling is disabled.
+	 */
+	struct bt_profile_record *profile_record;
 };
 
 struct bt_component *bt_component_sink_create(void);
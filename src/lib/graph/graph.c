@@ -21,6 +21,7 @@
 #include "lib/value.h"
 #include <unistd.h>
 #include <stdbool.h>
+#include <errno.h>
 #include <glib.h>
 
 #include "component-class-sink-simple.h"
@@ -31,6 +32,7 @@
 #include "interrupter.h"
 #include "message/event.h"
 #include "message/packet.h"
+#include "profile.h"
 
 typedef enum bt_graph_listener_func_status
 (*port_added_func_t)(const void *, const void *, void *);
@@ -104,6 +106,14 @@ void destroy_graph(struct bt_object *obj)
 		graph->components = NULL;
 	}
 
+	if (graph->readiness_fds) {
+		g_array_free(graph->readiness_fds, TRUE);
+		graph->readiness_fds = NULL;
+	}
+
+	bt_profile_destroy(graph->profile);
+	graph->profile = NULL;
+
 	if (graph->interrupters) {
 		BT_LOGD_STR("Putting interrupters.");
 		g_ptr_array_free(graph->interrupters, TRUE);
@@ -288,6 +298,12 @@ struct bt_graph *bt_graph_create(uint64_t mip_version)
 
 	graph->messages = g_ptr_array_new_with_free_func(
 		(GDestroyNotify) notify_message_graph_is_destroyed);
+	graph->readiness_fds = g_array_new(FALSE, FALSE, sizeof(int));
+	if (!graph->readiness_fds) {
+		BT_LIB_LOGE_APPEND_CAUSE("Failed to allocate one GArray.");
+		goto error;
+	}
+
 	BT_LIB_LOGI("Created graph object: %!+g", graph);
 
 end:
@@ -446,7 +462,20 @@ int consume_graph_sink(struct bt_component_sink *comp)
 	sink_class = (void *) comp->parent.class;
 	BT_ASSERT_DBG(sink_class->methods.consume);
 	BT_LIB_LOGD("Calling user's consume method: %!+c", comp);
-	consume_status = sink_class->methods.consume((void *) comp);
+
+	if (G_UNLIKELY(comp->profile_record)) {
+		struct bt_graph *graph = bt_component_borrow_graph((void *) comp);
+		struct bt_profile_frame profile_frame;
+
+		bt_profile_enter(graph->profile, comp->profile_record,
+			&profile_frame);
+		consume_status = sink_class->methods.consume((void *) comp);
+		bt_profile_leave(graph->profile, comp->profile_record,
+			&profile_frame, consume_status);
+	} else {
+		consume_status = sink_class->methods.consume((void *) comp);
+	}
+
 	BT_LOGD("User method returned: status=%s",
 		bt_common_func_status_string(consume_status));
 	BT_ASSERT_POST_DEV(CONSUME_METHOD_NAME, "valid-status",
@@ -1085,6 +1114,20 @@ int add_component_with_init_method_data(
 	if (bt_component_is_sink(component)) {
 		graph->has_sink = true;
 		g_queue_push_tail(graph->sinks_to_consume, component);
+
+		if (graph->profile) {
+			struct bt_component_sink *sink = (void *) component;
+
+			sink->profile_record = bt_profile_add_record(
+				graph->profile, component, false);
+			if (!sink->profile_record) {
+				BT_LIB_LOGE_APPEND_CAUSE(
+					"Cannot add sink component's profile record: "
+					"%![comp-]+c", component);
+				status = BT_FUNC_STATUS_MEMORY_ERROR;
+				goto end;
+			}
+		}
 	}
 
 	/*
@@ -1312,6 +1355,191 @@ bool bt_graph_is_interrupted(const struct bt_graph *graph)
 	return bt_interrupter_array_any_is_set(graph->interrupters);
 }
 
+void bt_graph_add_readiness_fd(struct bt_graph *graph, int fd)
+{
+	guint i;
+
+	BT_ASSERT_DBG(graph);
+	BT_ASSERT_DBG(fd >= 0);
+
+	for (i = 0; i < graph->readiness_fds->len; i++) {
+		if (g_array_index(graph->readiness_fds, int, i) == fd) {
+			return;
+		}
+	}
+
+	g_array_append_val(graph->readiness_fds, fd);
+	BT_LIB_LOGD("Added readiness file descriptor to graph: "
+		"%![graph-]+g, fd=%d", graph, fd);
+}
+
+BT_EXPORT
+enum bt_graph_wait_for_readiness_status bt_graph_wait_for_readiness(
+		struct bt_graph *graph, uint64_t max_duration_us)
+{
+	int status = BT_FUNC_STATUS_OK;
+	GPollFD *poll_fds = NULL;
+	guint nb_fds, i;
+	gint timeout_ms;
+	gint ret;
+
+	BT_ASSERT_PRE_NO_ERROR();
+	BT_ASSERT_PRE_GRAPH_NON_NULL(graph);
+	BT_ASSERT_PRE("graph-is-not-running", graph->can_consume,
+		"Cannot wait for a running graph: %!+g", graph);
+
+	/* Round up to the next millisecond, clamping to `G_MAXINT` */
+	if (max_duration_us >= (uint64_t) G_MAXINT * 1000) {
+		timeout_ms = G_MAXINT;
+	} else {
+		timeout_ms = (gint) ((max_duration_us + 999) / 1000);
+	}
+
+	nb_fds = graph->readiness_fds->len;
+
+	if (nb_fds > 0) {
+		poll_fds = g_new0(GPollFD, nb_fds);
+		if (!poll_fds) {
+			BT_LIB_LOGE_APPEND_CAUSE(
+				"Failed to allocate poll file descriptors.");
+			status = BT_FUNC_STATUS_MEMORY_ERROR;
+			goto end;
+		}
+
+		for (i = 0; i < nb_fds; i++) {
+			poll_fds[i].fd =
+				g_array_index(graph->readiness_fds, int, i);
+			poll_fds[i].events = G_IO_IN | G_IO_HUP | G_IO_ERR;
+		}
+	}
+
+	BT_LIB_LOGD("Waiting for graph's readiness: %![graph-]+g, "
+		"fd-count=%u, timeout-ms=%d", graph, nb_fds, timeout_ms);
+
+	/*
+	 * Use g_poll() even without any file descriptor (instead of
+	 * g_usleep(), which restarts on `EINTR`) so that a signal,
+	 * typically one which sets an interrupter, wakes us up.
+	 */
+	ret = g_poll(poll_fds, nb_fds, timeout_ms);
+	if (ret < 0 && errno != EINTR) {
+		BT_LIB_LOGE_APPEND_CAUSE("Failed to poll: "
+			"%![graph-]+g, fd-count=%u, errno=%d, msg=\"%s\"",
+			graph, nb_fds, errno, g_strerror(errno));
+		status = BT_FUNC_STATUS_ERROR;
+		goto end;
+	}
+
+	BT_LIB_LOGD("Waited for graph's readiness: %![graph-]+g, "
+		"ready-fd-count=%d", graph, ret);
+
+end:
+	g_array_set_size(graph->readiness_fds, 0);
+	g_free(poll_fds);
+	return status;
+}
+
+BT_EXPORT
+enum bt_graph_enable_profiling_status bt_graph_enable_profiling(
+		struct bt_graph *graph)
+{
+	int status = BT_FUNC_STATUS_OK;
+	guint i;
+
+	BT_ASSERT_PRE_NO_ERROR();
+	BT_ASSERT_PRE_GRAPH_NON_NULL(graph);
+	BT_ASSERT_PRE("graph-is-not-configured",
+		graph->config_state == BT_GRAPH_CONFIGURATION_STATE_CONFIGURING,
+		"Graph is not in the \"configuring\" state: %!+g", graph);
+
+	if (graph->profile) {
+		BT_LIB_LOGD("Graph's profiling is already enabled: %!+g",
+			graph);
+		goto end;
+	}
+
+	graph->profile = bt_profile_create();
+	if (!graph->profile) {
+		BT_LIB_LOGE_APPEND_CAUSE("Cannot create graph's profile.");
+		status = BT_FUNC_STATUS_MEMORY_ERROR;
+		goto end;
+	}
+
+	/* Sink components added after this get their record when added */
+	for (i = 0; i < graph->components->len; i++) {
+		struct bt_component *comp = graph->components->pdata[i];
+		struct bt_component_sink *sink = (void *) comp;
+
+		if (!bt_component_is_sink(comp)) {
+			continue;
+		}
+
+		sink->profile_record = bt_profile_add_record(graph->profile,
+			comp, false);
+		if (!sink->profile_record) {
+			BT_LIB_LOGE_APPEND_CAUSE(
+				"Cannot add sink component's profile record: "
+				"%![comp-]+c", comp);
+			status = BT_FUNC_STATUS_MEMORY_ERROR;
+			goto error;
+		}
+	}
+
+	BT_LIB_LOGI("Enabled graph's profiling: %!+g", graph);
+	goto end;
+
+error:
+	for (i = 0; i < graph->components->len; i++) {
+		struct bt_component *comp = graph->components->pdata[i];
+
+		if (bt_component_is_sink(comp)) {
+			((struct bt_component_sink *) comp)->profile_record =
+				NULL;
+		}
+	}
+
+	bt_profile_destroy(graph->profile);
+	graph->profile = NULL;
+
+end:
+	return status;
+}
+
+BT_EXPORT
+bt_bool bt_graph_profiling_is_enabled(const struct bt_graph *graph)
+{
+	BT_ASSERT_PRE_GRAPH_NON_NULL(graph);
+	return (bt_bool) (graph->profile != NULL);
+}
+
+BT_EXPORT
+enum bt_graph_get_profile_status bt_graph_get_profile(
+		const struct bt_graph *graph, const struct bt_value **profile)
+{
+	int status = BT_FUNC_STATUS_OK;
+
+	BT_ASSERT_PRE_NO_ERROR();
+	BT_ASSERT_PRE_GRAPH_NON_NULL(graph);
+	BT_ASSERT_PRE_NON_NULL("profile-output", profile,
+		"Profile (output)");
+	BT_ASSERT_PRE("graph-profiling-is-enabled", graph->profile,
+		"Graph's profiling is disabled: %!+g", graph);
+	BT_ASSERT_PRE("graph-is-not-running", graph->can_consume,
+		"Cannot get the profile of a running graph: %!+g", graph);
+	*profile = bt_profile_to_value(graph->profile, graph->components);
+	if (!*profile) {
+		BT_LIB_LOGE_APPEND_CAUSE("Cannot create graph's profile value: "
+			"%!+g", graph);
+		status = BT_FUNC_STATUS_MEMORY_ERROR;
+		goto end;
+	}
+
+	bt_value_freeze(*profile);
+
+end:
+	return status;
+}
+
 BT_EXPORT
 enum bt_graph_add_interrupter_status bt_graph_add_interrupter(
 		struct bt_graph *graph, const struct bt_interrupter *intr)
@@ -24,6 +24,7 @@
 #include "component.h"
 #include "component-sink.h"
 #include "connection.h"
+#include "profile.h"
 
 /* Protection: this file uses BT_LIB_LOG*() macros directly */
 #ifndef BT_LIB_LOG_SUPPORTED
@@ -122,6 +123,21 @@ struct bt_graph {
 	 * array (on destruction).
 	 */
 	GPtrArray *messages;
+
+	/*
+	 * Array of `int`: readiness file descriptors of the message
+	 * iterators which returned `BT_FUNC_STATUS_AGAIN` since the
+	 * last call to bt_graph_wait_for_readiness().
+	 *
+	 * Each file descriptor appears at most once.
+	 */
+	GArray *readiness_fds;
+
+	/*
+	 * Profile, owned by this, or `NULL` if profiling is disabled:
+	 * see bt_graph_enable_profiling().
+	 */
+	struct bt_profile *profile;
 };
 
 static inline
@@ -145,6 +161,8 @@ void bt_graph_add_message(struct bt_graph *graph,
 
 bool bt_graph_is_interrupted(const struct bt_graph *graph);
 
+void bt_graph_add_readiness_fd(struct bt_graph *graph, int fd);
+
 static inline
 const char *bt_graph_configuration_state_string(
 		enum bt_graph_configuration_state state)
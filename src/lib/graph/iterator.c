@@ -49,6 +49,7 @@
 #include "message/message-iterator-inactivity.h"
 #include "message/stream.h"
 #include "message/packet.h"
+#include "profile.h"
 #include "lib/func-status.h"
 #include "clock-correlation-validator/clock-correlation-validator.h"
 
@@ -376,6 +377,7 @@ int create_self_component_input_port_message_iterator(
 
 	g_ptr_array_set_size(iterator->msgs, MSG_BATCH_SIZE);
 	iterator->last_ns_from_origin = INT64_MIN;
+	iterator->readiness_fd = -1;
 
 	/* The per-stream state is only used for dev assertions right now. */
 	BT_IF_DEV_MODE(iterator->per_stream_state = g_hash_table_new_full(
@@ -405,6 +407,17 @@ int create_self_component_input_port_message_iterator(
 	set_msg_iterator_state(iterator,
 		BT_MESSAGE_ITERATOR_STATE_NON_INITIALIZED);
 
+	if (iterator->graph->profile) {
+		iterator->profile_record = bt_profile_add_record(
+			iterator->graph->profile, upstream_comp, true);
+		if (!iterator->profile_record) {
+			BT_LIB_LOGE_APPEND_CAUSE(
+				"Cannot add message iterator's profile record.");
+			status = BT_FUNC_STATUS_MEMORY_ERROR;
+			goto error;
+		}
+	}
+
 	/* Copy methods from the message iterator class to the message iterator. */
 	BT_ASSERT(bt_component_class_has_message_iterator_class(upstream_comp_cls));
 	upstream_comp_cls_with_iter_cls = container_of(upstream_comp_cls,
@@ -1290,9 +1303,28 @@ bt_message_iterator_next(
 	 * and status.
 	 */
 	*user_count = 0;
-	status = (int) call_iterator_next_method(iterator,
-		(void *) iterator->msgs->pdata, MSG_BATCH_SIZE,
-		user_count);
+
+	if (G_UNLIKELY(iterator->profile_record)) {
+		struct bt_profile_frame profile_frame;
+
+		bt_profile_enter(iterator->graph->profile,
+			iterator->profile_record, &profile_frame);
+		status = (int) call_iterator_next_method(iterator,
+			(void *) iterator->msgs->pdata, MSG_BATCH_SIZE,
+			user_count);
+		bt_profile_leave(iterator->graph->profile,
+			iterator->profile_record, &profile_frame, status);
+
+		if (status == BT_FUNC_STATUS_OK) {
+			bt_profile_record_count_msgs(iterator->profile_record,
+				(void *) iterator->msgs->pdata, *user_count);
+		}
+	} else {
+		status = (int) call_iterator_next_method(iterator,
+			(void *) iterator->msgs->pdata, MSG_BATCH_SIZE,
+			user_count);
+	}
+
 	BT_LOGD("User method returned: status=%s, msg-count=%" PRIu64,
 		bt_common_func_status_string(status), *user_count);
 	if (status < 0) {
@@ -1325,6 +1357,11 @@ bt_message_iterator_next(
 		*msgs = (void *) iterator->msgs->pdata;
 		break;
 	case BT_FUNC_STATUS_AGAIN:
+		if (iterator->readiness_fd >= 0) {
+			bt_graph_add_readiness_fd(iterator->graph,
+				iterator->readiness_fd);
+		}
+
 		goto end;
 	case BT_FUNC_STATUS_END:
 		set_msg_iterator_state(iterator,
@@ -2288,8 +2325,11 @@ bt_message_iterator_seek_ns_from_origin(
 			goto end;
 		}
 
+		iterator->auto_seek.is_active = true;
+		iterator->auto_seek.ns_from_origin = ns_from_origin;
 		status = find_message_ge_ns_from_origin(iterator,
 			ns_from_origin, stream_states);
+		iterator->auto_seek.is_active = false;
 		switch (status) {
 		case BT_FUNC_STATUS_OK:
 		case BT_FUNC_STATUS_END:
@@ -2442,6 +2482,53 @@ bt_bool bt_self_message_iterator_is_interrupted(
 	return (bt_bool) bt_graph_is_interrupted(iterator->graph);
 }
 
+BT_EXPORT
+bt_bool bt_self_message_iterator_is_auto_seeking(
+		const struct bt_self_message_iterator *self_msg_iter,
+		int64_t *ns_from_origin)
+{
+	const struct bt_message_iterator *iterator =
+		(const void *) self_msg_iter;
+
+	BT_ASSERT_PRE_DEV_MSG_ITER_NON_NULL(iterator);
+	BT_ASSERT_PRE_DEV_NON_NULL("ns-from-origin-output", ns_from_origin,
+		"Nanoseconds from origin (output)");
+
+	if (!iterator->auto_seek.is_active) {
+		return BT_FALSE;
+	}
+
+	*ns_from_origin = iterator->auto_seek.ns_from_origin;
+	return BT_TRUE;
+}
+
+BT_EXPORT
+void bt_self_message_iterator_set_readiness_fd(
+		struct bt_self_message_iterator *self_msg_iter, int fd)
+{
+	struct bt_message_iterator *iterator = (void *) self_msg_iter;
+
+	BT_ASSERT_PRE_MSG_ITER_NON_NULL(iterator);
+	BT_ASSERT_PRE("valid-fd", fd >= -1,
+		"Invalid readiness file descriptor: fd=%d", fd);
+	iterator->readiness_fd = fd;
+	BT_LIB_LOGD("Set message iterator's readiness file descriptor: "
+		"%!+i, fd=%d", iterator, fd);
+}
+
+BT_EXPORT
+void bt_self_message_iterator_add_decoded_bytes(
+		struct bt_self_message_iterator *self_msg_iter, uint64_t count)
+{
+	struct bt_message_iterator *iterator = (void *) self_msg_iter;
+
+	BT_ASSERT_PRE_DEV_MSG_ITER_NON_NULL(iterator);
+
+	if (iterator->profile_record) {
+		iterator->profile_record->decoded_bytes += count;
+	}
+}
+
 BT_EXPORT
 void bt_message_iterator_get_ref(
 		const struct bt_message_iterator *iterator)
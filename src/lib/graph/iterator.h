@@ -153,9 +153,30 @@ struct bt_message_iterator {
 		 * restore it.
 		 */
 		void *original_next_callback;
+
+		/*
+		 * Whether or not we're currently fast-forwarding this
+		 * iterator to find a message at or after `ns_from_origin`
+		 * (see bt_self_message_iterator_is_auto_seeking()).
+		 */
+		bool is_active;
+		int64_t ns_from_origin;
 	} auto_seek;
 
 	void *user_data;
+
+	/*
+	 * Readiness file descriptor, or -1 if none: see
+	 * bt_self_message_iterator_set_readiness_fd().
+	 */
+	int readiness_fd;
+
+	/*
+	 * Profile record (owned by the profile of the graph), or `NULL`
+	 * if profiling was disabled when this message iterator was
+	 * created.
+	 */
+	struct bt_profile_record *profile_record;
 };
 
 void bt_message_iterator_try_finalize(
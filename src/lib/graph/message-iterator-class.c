@@ -71,7 +71,8 @@ struct bt_message_iterator_class *bt_message_iterator_class_create(
 		goto end;
 	}
 
-	bt_object_init_shared(&message_iterator_class->base, destroy_iterator_class);
+	bt_object_init_shared_atomic(&message_iterator_class->base,
+		destroy_iterator_class);
 
 	message_iterator_class->methods.next = next_method;
 
@@ -18,6 +18,7 @@
 #include "lib/trace-ir/stream-class.h"
 #include <babeltrace2/trace-ir/trace.h>
 #include "lib/trace-ir/clock-snapshot.h"
+#include "lib/func-status.h"
 #include "lib/graph/graph.h"
 #include <babeltrace2/graph/message.h>
 #include <babeltrace2/types.h>
@@ -43,6 +44,7 @@ struct bt_message *bt_message_event_new(
 
 	bt_message_init(&message->parent, BT_MESSAGE_TYPE_EVENT,
 		(bt_object_release_func) bt_message_event_recycle, graph);
+	bt_object_init_unique(&message->embedded_default_cs.base);
 	goto end;
 
 error:
@@ -99,44 +101,24 @@ end:
 	return event;
 }
 
+/*
+ * Creates one event message, having an instance of `event_class`, from
+ * the event message pool of the graph of `msg_iter`.
+ *
+ * The caller is responsible for checking the preconditions and for
+ * freezing the packet, the stream, and the event class.
+ */
 static inline
-struct bt_message *create_event_message(
-		struct bt_self_message_iterator *self_msg_iter,
-		const struct bt_event_class *c_event_class,
-		const struct bt_packet *c_packet,
-		const struct bt_stream *c_stream, bool with_cs,
-		uint64_t raw_value, const char *api_func)
+struct bt_message_event *create_event_message_from_pool(
+		struct bt_message_iterator *msg_iter,
+		struct bt_event_class *event_class,
+		struct bt_stream_class *stream_class,
+		struct bt_packet *packet, struct bt_stream *stream,
+		bool with_cs, uint64_t raw_value, const char *api_func)
 {
-	struct bt_message_iterator *msg_iter =
-		(void *) self_msg_iter;
 	struct bt_message_event *message = NULL;
-	struct bt_event_class *event_class = (void *) c_event_class;
-	struct bt_stream_class *stream_class;
-	struct bt_packet *packet = (void *) c_packet;
-	struct bt_stream *stream = (void *) c_stream;
 	struct bt_event *event;
 
-	BT_ASSERT_DBG(stream);
-	BT_ASSERT_PRE_MSG_ITER_NON_NULL_FROM_FUNC(api_func, msg_iter);
-	BT_ASSERT_PRE_EC_NON_NULL_FROM_FUNC(api_func, event_class);
-	stream_class = bt_event_class_borrow_stream_class_inline(event_class);
-	BT_ASSERT_PRE_FROM_FUNC(api_func,
-		"stream-class-is-event-class-stream-class",
-		bt_event_class_borrow_stream_class(event_class) ==
-			stream->class,
-		"Stream's class and event's stream class differ: "
-		"%![ec-]+E, %![stream-]+s", event_class, stream);
-	BT_ASSERT_DBG(stream_class);
-	BT_ASSERT_PRE_FROM_FUNC(api_func,
-		"with-default-clock-snapshot-if-stream-class-has-default-clock-class",
-		(with_cs && stream_class->default_clock_class) ||
-		(!with_cs && !stream_class->default_clock_class),
-		"Creating an event message with a default clock snapshot, but without "
-		"a default clock class, or without a default clock snapshot, "
-		"but with a default clock class: ",
-		"%![ec-]+E, %![sc-]+S, with-cs=%d, "
-		"cs-val=%" PRIu64,
-		event_class, stream_class, with_cs, raw_value);
 	BT_LIB_LOGD("Creating event message object: %![ec-]+E", event_class);
 	event = create_event(event_class, packet, stream, api_func);
 	if (G_UNLIKELY(!event)) {
@@ -170,17 +152,70 @@ struct bt_message *create_event_message(
 
 	if (with_cs) {
 		BT_ASSERT_DBG(stream_class->default_clock_class);
-		message->default_cs = bt_clock_snapshot_create(
-			stream_class->default_clock_class);
-		if (!message->default_cs) {
-			goto error;
-		}
-
-		bt_clock_snapshot_set_raw_value(message->default_cs, raw_value);
+		bt_clock_snapshot_init_embedded(&message->embedded_default_cs,
+			stream_class->default_clock_class, raw_value);
+		message->default_cs = &message->embedded_default_cs;
 	}
 
 	BT_ASSERT_DBG(!message->event);
 	message->event = event;
+	BT_LIB_LOGD("Created event message object: "
+		"%![msg-]+n, %![event-]+e", message, event);
+	goto end;
+
+error:
+	BT_ASSERT(!message);
+	bt_event_destroy(event);
+
+end:
+	return message;
+}
+
+#define BT_ASSERT_PRE_WITH_CS_IF_SC_HAS_DEF_CLK_CLS(_func, _sc, _with_cs) \
+	BT_ASSERT_PRE_FROM_FUNC(_func,					\
+		"with-default-clock-snapshot-if-stream-class-has-default-clock-class", \
+		((_with_cs) && (_sc)->default_clock_class) ||		\
+		(!(_with_cs) && !(_sc)->default_clock_class),		\
+		"Creating an event message with a default clock snapshot, but without " \
+		"a default clock class, or without a default clock snapshot, " \
+		"but with a default clock class: "			\
+		"%![sc-]+S, with-cs=%d", (_sc), (_with_cs))
+
+static inline
+struct bt_message *create_event_message(
+		struct bt_self_message_iterator *self_msg_iter,
+		const struct bt_event_class *c_event_class,
+		const struct bt_packet *c_packet,
+		const struct bt_stream *c_stream, bool with_cs,
+		uint64_t raw_value, const char *api_func)
+{
+	struct bt_message_iterator *msg_iter =
+		(void *) self_msg_iter;
+	struct bt_message_event *message;
+	struct bt_event_class *event_class = (void *) c_event_class;
+	struct bt_stream_class *stream_class;
+	struct bt_packet *packet = (void *) c_packet;
+	struct bt_stream *stream = (void *) c_stream;
+
+	BT_ASSERT_DBG(stream);
+	BT_ASSERT_PRE_MSG_ITER_NON_NULL_FROM_FUNC(api_func, msg_iter);
+	BT_ASSERT_PRE_EC_NON_NULL_FROM_FUNC(api_func, event_class);
+	stream_class = bt_event_class_borrow_stream_class_inline(event_class);
+	BT_ASSERT_PRE_FROM_FUNC(api_func,
+		"stream-class-is-event-class-stream-class",
+		bt_event_class_borrow_stream_class(event_class) ==
+			stream->class,
+		"Stream's class and event's stream class differ: "
+		"%![ec-]+E, %![stream-]+s", event_class, stream);
+	BT_ASSERT_DBG(stream_class);
+	BT_ASSERT_PRE_WITH_CS_IF_SC_HAS_DEF_CLK_CLS(api_func, stream_class,
+		with_cs);
+	message = create_event_message_from_pool(msg_iter, event_class,
+		stream_class, packet, stream, with_cs, raw_value, api_func);
+	if (G_UNLIKELY(!message)) {
+		/* create_event_message_from_pool() logs errors */
+		goto end;
+	}
 
 	if (packet) {
 		bt_packet_set_is_frozen(packet, true);
@@ -188,16 +223,91 @@ struct bt_message *create_event_message(
 
 	bt_stream_freeze(stream);
 	bt_event_class_freeze(event_class);
-	BT_LIB_LOGD("Created event message object: "
-		"%![msg-]+n, %![event-]+e", message, event);
+
+end:
+	return (void *) message;
+}
+
+static
+enum bt_message_event_create_many_status create_event_messages(
+		struct bt_self_message_iterator *self_msg_iter,
+		const struct bt_event_class * const *c_event_classes,
+		const struct bt_packet *c_packet, bool with_cs,
+		const uint64_t *raw_values, uint64_t count,
+		bt_message_array_const messages, const char *api_func)
+{
+	struct bt_message_iterator *msg_iter =
+		(void *) self_msg_iter;
+	struct bt_packet *packet = (void *) c_packet;
+	struct bt_stream *stream;
+	struct bt_stream_class *stream_class;
+	enum bt_message_event_create_many_status status =
+		BT_FUNC_STATUS_OK;
+	uint64_t i;
+
+	BT_ASSERT_PRE_MSG_ITER_NON_NULL_FROM_FUNC(api_func, msg_iter);
+	BT_ASSERT_PRE_NON_NULL_FROM_FUNC(api_func, "event-classes",
+		c_event_classes, "Event class array");
+	BT_ASSERT_PRE_NON_NULL_FROM_FUNC(api_func, "message-array",
+		messages, "Message array (output)");
+	stream = packet->stream;
+	BT_ASSERT_DBG(stream);
+	stream_class = stream->class;
+	BT_ASSERT_DBG(stream_class);
+
+	/*
+	 * All the messages share the same packet, therefore the same
+	 * stream and stream class: check the stream class once.
+	 */
+	BT_ASSERT_PRE_WITH_CS_IF_SC_HAS_DEF_CLK_CLS(api_func, stream_class,
+		with_cs);
+	BT_LIB_LOGD("Creating event message objects: "
+		"%![packet-]+a, count=%" PRIu64, packet, count);
+
+	for (i = 0; i < count; i++) {
+		struct bt_event_class *event_class =
+			(void *) c_event_classes[i];
+		struct bt_message_event *message;
+
+		BT_ASSERT_PRE_EC_NON_NULL_FROM_FUNC(api_func, event_class);
+		BT_ASSERT_PRE_FROM_FUNC(api_func,
+			"stream-class-is-event-class-stream-class",
+			bt_event_class_borrow_stream_class_inline(
+				event_class) == stream_class,
+			"Packet's stream class and event's stream class differ: "
+			"%![ec-]+E, %![packet-]+a, index=%" PRIu64,
+			event_class, packet, i);
+		message = create_event_message_from_pool(msg_iter,
+			event_class, stream_class, packet, stream, with_cs,
+			with_cs ? raw_values[i] : 0, api_func);
+		if (G_UNLIKELY(!message)) {
+			BT_LIB_LOGE_APPEND_CAUSE(
+				"Cannot create event message: "
+				"%![ec-]+E, %![packet-]+a, index=%" PRIu64,
+				event_class, packet, i);
+			status = BT_FUNC_STATUS_MEMORY_ERROR;
+			goto error;
+		}
+
+		bt_event_class_freeze(event_class);
+		messages[i] = (void *) message;
+	}
+
+	bt_packet_set_is_frozen(packet, true);
+	bt_stream_freeze(stream);
+	BT_LIB_LOGD("Created event message objects: "
+		"%![packet-]+a, count=%" PRIu64, packet, count);
 	goto end;
 
 error:
-	BT_ASSERT(!message);
-	bt_event_destroy(event);
+	/* Release the messages created so far (indexes 0 to `i - 1`) */
+	while (i > 0) {
+		i--;
+		BT_OBJECT_PUT_REF_AND_RESET(messages[i]);
+	}
 
 end:
-	return (void *) message;
+	return status;
 }
 
 BT_EXPORT
@@ -251,6 +361,37 @@ bt_message_event_create_with_packet_and_default_clock_snapshot(
 		packet->stream, true, raw_value, __func__);
 }
 
+BT_EXPORT
+enum bt_message_event_create_many_status
+bt_message_event_create_many_with_packet(
+		struct bt_self_message_iterator *msg_iter,
+		const struct bt_event_class * const *event_classes,
+		const struct bt_packet *packet, uint64_t count,
+		bt_message_array_const messages)
+{
+	BT_ASSERT_PRE_DEV_NO_ERROR();
+	BT_ASSERT_PRE_PACKET_NON_NULL(packet);
+	return create_event_messages(msg_iter, event_classes, packet,
+		false, NULL, count, messages, __func__);
+}
+
+BT_EXPORT
+enum bt_message_event_create_many_status
+bt_message_event_create_many_with_packet_and_default_clock_snapshot(
+		struct bt_self_message_iterator *msg_iter,
+		const struct bt_event_class * const *event_classes,
+		const struct bt_packet *packet,
+		const uint64_t *raw_values, uint64_t count,
+		bt_message_array_const messages)
+{
+	BT_ASSERT_PRE_DEV_NO_ERROR();
+	BT_ASSERT_PRE_PACKET_NON_NULL(packet);
+	BT_ASSERT_PRE_NON_NULL("clock-snapshot-values", raw_values,
+		"Default clock snapshot value array");
+	return create_event_messages(msg_iter, event_classes, packet,
+		true, raw_values, count, messages, __func__);
+}
+
 void bt_message_event_destroy(struct bt_message *msg)
 {
 	struct bt_message_event *event_msg = (void *) msg;
@@ -263,11 +404,6 @@ void bt_message_event_destroy(struct bt_message *msg)
 		event_msg->event = NULL;
 	}
 
-	if (event_msg->default_cs) {
-		bt_clock_snapshot_recycle(event_msg->default_cs);
-		event_msg->default_cs = NULL;
-	}
-
 	g_free(msg);
 }
 
@@ -291,7 +427,8 @@ void bt_message_event_recycle(struct bt_message *msg)
 	event_msg->event = NULL;
 
 	if (event_msg->default_cs) {
-		bt_clock_snapshot_recycle(event_msg->default_cs);
+		bt_clock_snapshot_reset(event_msg->default_cs);
+		event_msg->default_cs->clock_class = NULL;
 		event_msg->default_cs = NULL;
 	}
 
@@ -12,6 +12,8 @@
 #include <babeltrace2/trace-ir/event-class.h>
 #include <babeltrace2/trace-ir/event.h>
 
+#include "lib/trace-ir/clock-snapshot.h"
+
 #include "message.h"
 
 #ifdef __cplusplus
@@ -21,7 +23,24 @@ extern "C" {
 struct bt_message_event {
 	struct bt_message parent;
 	struct bt_event *event;
+
+	/*
+	 * Points to `embedded_default_cs` when the message has a default
+	 * clock snapshot, or `NULL`.
+	 */
 	struct bt_clock_snapshot *default_cs;
+
+	/*
+	 * Default clock snapshot storage: embedding the clock snapshot
+	 * in the message, instead of getting one from the pool of the
+	 * clock class, saves a pool operation (and a clock class
+	 * reference) for each event message.
+	 *
+	 * Its clock class is a weak reference: the event of the message
+	 * keeps its event class, and therefore its stream class and the
+	 * default clock class of the latter, alive.
+	 */
+	struct bt_clock_snapshot embedded_default_cs;
 };
 
 struct bt_message *bt_message_event_new(struct bt_graph *graph);
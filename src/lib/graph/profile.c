@@ -0,0 +1,295 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS, Inc.
+ */
+
+#define BT_LOG_TAG "LIB/PROFILE"
+#include "lib/logging.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <glib.h>
+#include <babeltrace2/babeltrace.h>
+
+#include "common/assert.h"
+#include "common/common.h"
+#include "lib/object.h"
+
+#include "component.h"
+#include "component-class.h"
+#include "profile.h"
+
+struct bt_profile *bt_profile_create(void)
+{
+	struct bt_profile *profile = g_new0(struct bt_profile, 1);
+
+	if (!profile) {
+		BT_LIB_LOGE_APPEND_CAUSE("Failed to allocate one profile.");
+		goto error;
+	}
+
+	profile->records = g_ptr_array_new_with_free_func(g_free);
+	if (!profile->records) {
+		BT_LIB_LOGE_APPEND_CAUSE("Failed to allocate one GPtrArray.");
+		goto error;
+	}
+
+	goto end;
+
+error:
+	bt_profile_destroy(profile);
+	profile = NULL;
+
+end:
+	return profile;
+}
+
+void bt_profile_destroy(struct bt_profile *profile)
+{
+	if (!profile) {
+		return;
+	}
+
+	if (profile->records) {
+		g_ptr_array_free(profile->records, TRUE);
+		profile->records = NULL;
+	}
+
+	g_free(profile);
+}
+
+struct bt_profile_record *bt_profile_add_record(struct bt_profile *profile,
+		struct bt_component *component, bool is_msg_iter)
+{
+	struct bt_profile_record *record;
+
+	BT_ASSERT(profile);
+	BT_ASSERT(component);
+	record = g_new0(struct bt_profile_record, 1);
+	if (!record) {
+		BT_LIB_LOGE_APPEND_CAUSE("Failed to allocate one profile record.");
+		goto end;
+	}
+
+	record->component = component;
+	record->is_msg_iter = is_msg_iter;
+	g_ptr_array_add(profile->records, record);
+	BT_LIB_LOGD("Added profile record: %![comp-]+c, is-msg-iter=%d",
+		component, is_msg_iter);
+
+end:
+	return record;
+}
+
+static
+const char *msg_type_key(unsigned int index)
+{
+	static const char * const keys[BT_PROFILE_MSG_TYPE_COUNT] = {
+		"stream-beginning",
+		"stream-end",
+		"event",
+		"packet-beginning",
+		"packet-end",
+		"discarded-events",
+		"discarded-packets",
+		"message-iterator-inactivity",
+	};
+
+	BT_ASSERT(index < BT_PROFILE_MSG_TYPE_COUNT);
+	return keys[index];
+}
+
+static
+const char *comp_type_key(enum bt_component_class_type type)
+{
+	switch (type) {
+	case BT_COMPONENT_CLASS_TYPE_SOURCE:
+		return "source";
+	case BT_COMPONENT_CLASS_TYPE_FILTER:
+		return "filter";
+	case BT_COMPONENT_CLASS_TYPE_SINK:
+		return "sink";
+	}
+
+	bt_common_abort();
+}
+
+static
+void add_record_counters(struct bt_profile_record *sum,
+		const struct bt_profile_record *record)
+{
+	unsigned int i;
+
+	sum->calls += record->calls;
+	sum->again_count += record->again_count;
+	sum->ok_calls += record->ok_calls;
+
+	for (i = 0; i < BT_PROFILE_MSG_TYPE_COUNT; i++) {
+		sum->msg_counts[i] += record->msg_counts[i];
+	}
+
+	sum->decoded_bytes += record->decoded_bytes;
+	sum->inclusive_time_ns += record->inclusive_time_ns;
+	sum->child_time_ns += record->child_time_ns;
+}
+
+/*
+ * Inserts the counters of `record` as entries of the map value `map`.
+ *
+ * Returns 0 on success, or a negative value on memory error.
+ */
+static
+int insert_record_counters(struct bt_value *map,
+		const struct bt_profile_record *record, bool is_msg_iter)
+{
+	int ret = -1;
+	const uint64_t self_time_ns =
+		record->inclusive_time_ns >= record->child_time_ns ?
+			record->inclusive_time_ns - record->child_time_ns : 0;
+
+	if (bt_value_map_insert_unsigned_integer_entry(map, "calls",
+			record->calls) ||
+			bt_value_map_insert_unsigned_integer_entry(map,
+				"again-count", record->again_count) ||
+			bt_value_map_insert_unsigned_integer_entry(map,
+				"inclusive-time-ns",
+				record->inclusive_time_ns) ||
+			bt_value_map_insert_unsigned_integer_entry(map,
+				"self-time-ns", self_time_ns)) {
+		goto end;
+	}
+
+	if (is_msg_iter) {
+		struct bt_value *msg_counts;
+		uint64_t msg_count = 0;
+		unsigned int i;
+
+		if (bt_value_map_insert_empty_map_entry(map, "message-counts",
+				&msg_counts)) {
+			goto end;
+		}
+
+		for (i = 0; i < BT_PROFILE_MSG_TYPE_COUNT; i++) {
+			if (bt_value_map_insert_unsigned_integer_entry(
+					msg_counts, msg_type_key(i),
+					record->msg_counts[i])) {
+				goto end;
+			}
+
+			msg_count += record->msg_counts[i];
+		}
+
+		if (bt_value_map_insert_unsigned_integer_entry(map,
+				"message-count", msg_count) ||
+				bt_value_map_insert_real_entry(map,
+					"mean-batch-size",
+					record->ok_calls == 0 ? 0. :
+						(double) msg_count /
+						(double) record->ok_calls) ||
+				bt_value_map_insert_unsigned_integer_entry(map,
+					"decoded-bytes",
+					record->decoded_bytes)) {
+			goto end;
+		}
+	}
+
+	ret = 0;
+
+end:
+	return ret;
+}
+
+static
+int append_comp(struct bt_value *comps, const struct bt_profile *profile,
+		const struct bt_component *comp)
+{
+	int ret = -1;
+	const bool is_sink =
+		comp->class->type == BT_COMPONENT_CLASS_TYPE_SINK;
+	struct bt_profile_record sum = { 0 };
+	struct bt_value *comp_map;
+	struct bt_value *msg_iters = NULL;
+	guint i;
+
+	if (bt_value_array_append_empty_map_element(comps, &comp_map) ||
+			bt_value_map_insert_string_entry(comp_map, "name",
+				comp->name->str) ||
+			bt_value_map_insert_string_entry(comp_map,
+				"class-name", comp->class->name->str) ||
+			bt_value_map_insert_string_entry(comp_map, "type",
+				comp_type_key(comp->class->type))) {
+		goto end;
+	}
+
+	if (!is_sink) {
+		if (bt_value_map_insert_empty_array_entry(comp_map,
+				"message-iterators", &msg_iters)) {
+			goto end;
+		}
+	}
+
+	for (i = 0; i < profile->records->len; i++) {
+		const struct bt_profile_record *record =
+			profile->records->pdata[i];
+
+		if (record->component != comp) {
+			continue;
+		}
+
+		add_record_counters(&sum, record);
+
+		if (record->is_msg_iter) {
+			struct bt_value *msg_iter_map;
+
+			BT_ASSERT(msg_iters);
+
+			if (bt_value_array_append_empty_map_element(msg_iters,
+					&msg_iter_map) ||
+					insert_record_counters(msg_iter_map,
+						record, true)) {
+				goto end;
+			}
+		}
+	}
+
+	ret = insert_record_counters(comp_map, &sum, !is_sink);
+
+end:
+	return ret;
+}
+
+struct bt_value *bt_profile_to_value(const struct bt_profile *profile,
+		const GPtrArray *components)
+{
+	struct bt_value *map;
+	struct bt_value *comps;
+	guint i;
+
+	BT_ASSERT(profile);
+	BT_ASSERT(components);
+	map = bt_value_map_create();
+	if (!map) {
+		goto error;
+	}
+
+	if (bt_value_map_insert_empty_array_entry(map, "components", &comps)) {
+		goto error;
+	}
+
+	for (i = 0; i < components->len; i++) {
+		if (append_comp(comps, profile, components->pdata[i])) {
+			goto error;
+		}
+	}
+
+	goto end;
+
+error:
+	BT_LIB_LOGE_APPEND_CAUSE("Failed to create the profile value.");
+	BT_OBJECT_PUT_REF_AND_RESET(map);
+
+end:
+	return map;
+}
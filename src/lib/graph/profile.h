@@ -0,0 +1,175 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS, Inc.
+ */
+
+#ifndef BABELTRACE_LIB_GRAPH_PROFILE_H
+#define BABELTRACE_LIB_GRAPH_PROFILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <glib.h>
+#include <babeltrace2/babeltrace.h>
+
+#include "common/assert.h"
+#include "lib/func-status.h"
+
+/* Number of message types (see `enum bt_message_type`) */
+#define BT_PROFILE_MSG_TYPE_COUNT	8
+
+struct bt_component;
+
+/*
+ * Profiling counters of a single message iterator or of a single sink
+ * component.
+ *
+ * A record is owned by the profile of the graph, not by the message
+ * iterator, so that its counters remain available after the message
+ * iterator is destroyed.
+ */
+struct bt_profile_record {
+	/* Upstream component (message iterator) or sink component (weak) */
+	struct bt_component *component;
+
+	/* True if this is the record of a message iterator */
+	bool is_msg_iter;
+
+	/* Calls of the "next" (message iterator) or "consume" method */
+	uint64_t calls;
+
+	/* Calls which returned `BT_FUNC_STATUS_AGAIN` */
+	uint64_t again_count;
+
+	/* Calls of the "next" method which returned `BT_FUNC_STATUS_OK` */
+	uint64_t ok_calls;
+
+	/*
+	 * Returned messages, indexed by the bit position of their type
+	 * (message iterator only).
+	 */
+	uint64_t msg_counts[BT_PROFILE_MSG_TYPE_COUNT];
+
+	/*
+	 * Bytes decoded from the data source (see
+	 * bt_self_message_iterator_add_decoded_bytes()).
+	 */
+	uint64_t decoded_bytes;
+
+	/* Cumulative duration of the method calls */
+	uint64_t inclusive_time_ns;
+
+	/*
+	 * Part of `inclusive_time_ns` spent in the methods of other
+	 * records (upstream message iterators) during those calls.
+	 */
+	uint64_t child_time_ns;
+};
+
+/*
+ * Profile of a graph: exists only when profiling is enabled.
+ */
+struct bt_profile {
+	/* Array of `struct bt_profile_record *` (owned by this) */
+	GPtrArray *records;
+
+	/* Record of the method currently executing, or `NULL` */
+	struct bt_profile_record *current;
+};
+
+/* State saved by bt_profile_enter() and restored by bt_profile_leave() */
+struct bt_profile_frame {
+	struct bt_profile_record *parent;
+	uint64_t begin_ns;
+};
+
+struct bt_profile *bt_profile_create(void);
+
+void bt_profile_destroy(struct bt_profile *profile);
+
+struct bt_profile_record *bt_profile_add_record(struct bt_profile *profile,
+		struct bt_component *component, bool is_msg_iter);
+
+struct bt_value *bt_profile_to_value(const struct bt_profile *profile,
+		const GPtrArray *components);
+
+static inline
+uint64_t bt_profile_now_ns(void)
+{
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+		return (uint64_t) ts.tv_sec * UINT64_C(1000000000) +
+			(uint64_t) ts.tv_nsec;
+	}
+#endif
+
+	return (uint64_t) g_get_monotonic_time() * UINT64_C(1000);
+}
+
+/*
+ * Makes `record` the current record of `profile` and starts timing
+ * one of its method calls.
+ */
+static inline
+void bt_profile_enter(struct bt_profile *profile,
+		struct bt_profile_record *record,
+		struct bt_profile_frame *frame)
+{
+	BT_ASSERT_DBG(profile);
+	BT_ASSERT_DBG(record);
+	frame->parent = profile->current;
+	profile->current = record;
+	frame->begin_ns = bt_profile_now_ns();
+}
+
+/*
+ * Stops timing the method call which bt_profile_enter() started and
+ * restores the previous current record of `profile`.
+ */
+static inline
+void bt_profile_leave(struct bt_profile *profile,
+		struct bt_profile_record *record,
+		struct bt_profile_frame *frame, int status)
+{
+	const uint64_t elapsed_ns = bt_profile_now_ns() - frame->begin_ns;
+
+	BT_ASSERT_DBG(profile->current == record);
+	record->calls++;
+	record->inclusive_time_ns += elapsed_ns;
+
+	if (status == BT_FUNC_STATUS_AGAIN) {
+		record->again_count++;
+	}
+
+	if (frame->parent) {
+		frame->parent->child_time_ns += elapsed_ns;
+	}
+
+	profile->current = frame->parent;
+}
+
+/*
+ * Counts the `count` messages `msgs` which a message iterator returned.
+ */
+static inline
+void bt_profile_record_count_msgs(struct bt_profile_record *record,
+		const bt_message * const *msgs, uint64_t count)
+{
+	uint64_t i;
+
+	record->ok_calls++;
+
+	for (i = 0; i < count; i++) {
+		const unsigned int type =
+			(unsigned int) bt_message_get_type(msgs[i]);
+
+		BT_ASSERT_DBG(type != 0);
+		record->msg_counts[__builtin_ctz(type)]++;
+	}
+}
+
+#endif /* BABELTRACE_LIB_GRAPH_PROFILE_H */
@@ -467,7 +467,10 @@ static inline void format_field(char **buf_ch, bool extended,
 	{
 		const struct bt_field_string *str = (const void *) field;
 
-		if (str->buf) {
+		if (str->borrowed.data) {
+			BUF_APPEND(", %spartial-borrowed-value=\"%.32s\"",
+				PRFIELD((const char *) str->borrowed.data));
+		} else if (str->buf) {
 			BT_ASSERT(str->buf->data);
 			BUF_APPEND(", %spartial-value=\"%.32s\"",
 				PRFIELD(str->buf->data));
@@ -33,13 +33,13 @@ enum bt_logging_level bt_logging_get_minimal_level(void)
 BT_EXPORT
 enum bt_logging_level bt_logging_get_global_level(void)
 {
-	return bt_lib_log_level;
+	return __atomic_load_n(&bt_lib_log_level, __ATOMIC_RELAXED);
 }
 
 BT_EXPORT
 void bt_logging_set_global_level(enum bt_logging_level log_level)
 {
-	bt_lib_log_level = log_level;
+	__atomic_store_n(&bt_lib_log_level, log_level, __ATOMIC_RELAXED);
 }
 
 static
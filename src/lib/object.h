@@ -36,6 +36,16 @@ struct bt_object {
 	 */
 	bool is_shared;
 
+	/*
+	 * True if the reference count of this object is updated
+	 * atomically.
+	 *
+	 * This is the case for objects which the threads of independent
+	 * graphs may share, like component classes and plugins: all the
+	 * other objects belong to a single graph at a time.
+	 */
+	bool has_atomic_ref_count;
+
 	/*
 	 * Current reference count.
 	 */
@@ -187,6 +197,7 @@ void bt_object_init(struct bt_object *obj, bool is_shared,
 	BT_ASSERT_DBG(obj);
 	BT_ASSERT_DBG(!is_shared || release_func);
 	obj->is_shared = is_shared;
+	obj->has_atomic_ref_count = false;
 	obj->release_func = release_func;
 	obj->parent_is_owner_listener_func = NULL;
 	obj->spec_release_func = NULL;
@@ -201,6 +212,19 @@ void bt_object_init_shared(struct bt_object *obj,
 	bt_object_init(obj, true, release_func);
 }
 
+/*
+ * Like bt_object_init_shared(), but the reference count of `obj` is
+ * then updated atomically so that multiple threads may get and put
+ * references to it concurrently.
+ */
+static inline
+void bt_object_init_shared_atomic(struct bt_object *obj,
+		bt_object_release_func release_func)
+{
+	bt_object_init_shared(obj, release_func);
+	obj->has_atomic_ref_count = true;
+}
+
 static inline
 void bt_object_init_unique(struct bt_object *obj)
 {
@@ -234,7 +258,13 @@ void bt_object_inc_ref_count(const struct bt_object *c_obj)
 
 	BT_ASSERT_DBG(obj);
 	BT_ASSERT_DBG(obj->is_shared);
-	obj->ref_count++;
+
+	if (G_UNLIKELY(obj->has_atomic_ref_count)) {
+		__atomic_add_fetch(&obj->ref_count, 1, __ATOMIC_RELAXED);
+	} else {
+		obj->ref_count++;
+	}
+
 	BT_ASSERT_DBG(obj->ref_count != 0);
 }
 
@@ -299,12 +329,21 @@ void bt_object_put_ref_no_null_check(const void *c_obj)
 		obj, obj->ref_count, obj->ref_count - 1);
 #endif
 
-	obj->ref_count--;
+	if (G_UNLIKELY(obj->has_atomic_ref_count)) {
+		if (__atomic_sub_fetch(&obj->ref_count, 1,
+				__ATOMIC_ACQ_REL) != 0) {
+			return;
+		}
+	} else {
+		obj->ref_count--;
 
-	if (obj->ref_count == 0) {
-		BT_ASSERT_DBG(obj->release_func);
-		obj->release_func(obj);
+		if (obj->ref_count != 0) {
+			return;
+		}
 	}
+
+	BT_ASSERT_DBG(obj->release_func);
+	obj->release_func(obj);
 }
 
 static inline
@@ -18,6 +18,7 @@
 #include <string.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <pthread.h>
 #include <glib.h>
 #include <gmodule.h>
 
@@ -70,21 +71,32 @@ BT_PLUGIN_MODULE();
  * called after GLib's thread-specific data is destroyed, which contains
  * the allocated memory for GLib data structures (what's used by
  * g_slice_alloc()).
+ *
+ * `component_class_list_lock` protects this list: the threads of
+ * independent graphs may load plugins and destroy component classes
+ * concurrently.
  */
 
 static
 BT_LIST_HEAD(component_class_list);
 
+static
+pthread_mutex_t component_class_list_lock = PTHREAD_MUTEX_INITIALIZER;
+
 __attribute__((destructor)) static
 void fini_comp_class_list(void)
 {
 	struct bt_component_class *comp_class, *tmp;
 
+	pthread_mutex_lock(&component_class_list_lock);
+
 	bt_list_for_each_entry_safe(comp_class, tmp, &component_class_list, node) {
 		bt_list_del(&comp_class->node);
 		BT_OBJECT_PUT_REF_AND_RESET(comp_class->so_handle);
 	}
 
+	pthread_mutex_unlock(&component_class_list_lock);
+
 	BT_LOGD_STR("Released references from all component classes to shared library handles.");
 }
 
@@ -165,7 +177,7 @@ int bt_plugin_so_shared_lib_handle_create(
 		goto end;
 	}
 
-	bt_object_init_shared(&(*shared_lib_handle)->base,
+	bt_object_init_shared_atomic(&(*shared_lib_handle)->base,
 		bt_plugin_so_shared_lib_handle_destroy);
 
 	if (!path) {
@@ -1675,7 +1687,9 @@ static
 void plugin_comp_class_destroy_listener(struct bt_component_class *comp_class,
 		void *data __attribute__((unused)))
 {
+	pthread_mutex_lock(&component_class_list_lock);
 	bt_list_del(&comp_class->node);
+	pthread_mutex_unlock(&component_class_list_lock);
 	BT_OBJECT_PUT_REF_AND_RESET(comp_class->so_handle);
 	BT_LOGD("Component class destroyed: removed entry from list: "
 		"comp-cls-addr=%p", comp_class);
@@ -1696,7 +1710,9 @@ void bt_plugin_so_on_add_component_class(struct bt_plugin *plugin,
 	BT_ASSERT(plugin->spec_data);
 	BT_ASSERT(plugin->type == BT_PLUGIN_TYPE_SO);
 
+	pthread_mutex_lock(&component_class_list_lock);
 	bt_list_add(&comp_class->node, &component_class_list);
+	pthread_mutex_unlock(&component_class_list_lock);
 	comp_class->so_handle = spec->shared_lib_handle;
 	bt_object_get_ref_no_null_check(comp_class->so_handle);
 
@@ -62,20 +62,46 @@ int init_python_plugin_provider(void)
 #else /* BT_BUILT_IN_PYTHON_PLUGIN_SUPPORT */
 static GModule *python_plugin_provider_module;
 
+/*
+ * Set once, with release semantics, by init_python_plugin_provider()
+ * when the Python plugin provider module is loaded.
+ */
 static
 create_all_from_file_sym_type bt_plugin_python_create_all_from_file_sym;
 
+/* Protects the loading of the Python plugin provider module */
+static pthread_mutex_t python_plugin_provider_lock = PTHREAD_MUTEX_INITIALIZER;
+
 static
 int init_python_plugin_provider(void) {
 	int status = BT_FUNC_STATUS_OK;
 	const char *provider_dir_envvar;
 	static const char * const provider_dir_envvar_name = "LIBBABELTRACE2_PLUGIN_PROVIDER_DIR";
 	char *provider_path = NULL;
+	create_all_from_file_sym_type sym;
+
+	/* Fast path: already loaded */
+	if (__atomic_load_n(&bt_plugin_python_create_all_from_file_sym,
+			__ATOMIC_ACQUIRE)) {
+		return status;
+	}
+
+	pthread_mutex_lock(&python_plugin_provider_lock);
 
 	if (bt_plugin_python_create_all_from_file_sym) {
+		/* Loaded by another thread meanwhile */
 		goto end;
 	}
 
+	if (python_plugin_provider_module) {
+		/*
+		 * A previous call opened the module, but couldn't find
+		 * its loading symbol: close it and retry from scratch.
+		 */
+		g_module_close(python_plugin_provider_module);
+		python_plugin_provider_module = NULL;
+	}
+
 	BT_LOGI_STR("Loading Python plugin provider module.");
 
 	provider_dir_envvar = getenv(provider_dir_envvar_name);
@@ -107,7 +133,7 @@ int init_python_plugin_provider(void) {
 
 	if (!g_module_symbol(python_plugin_provider_module,
 			PYTHON_PLUGIN_PROVIDER_SYM_NAME_STR,
-			(gpointer) &bt_plugin_python_create_all_from_file_sym)) {
+			(gpointer) &sym)) {
 		/*
 		 * This is an error because, since we found the Python
 		 * plugin provider shared object, we expect this symbol
@@ -124,10 +150,13 @@ int init_python_plugin_provider(void) {
 		goto end;
 	}
 
+	__atomic_store_n(&bt_plugin_python_create_all_from_file_sym, sym,
+		__ATOMIC_RELEASE);
 	BT_LOGI("Loaded Python plugin provider module: addr=%p",
 		python_plugin_provider_module);
 
 end:
+	pthread_mutex_unlock(&python_plugin_provider_lock);
 	g_free(provider_path);
 
 	return status;
@@ -502,15 +531,20 @@ end:
 	return status;
 }
 
-static struct {
-	pthread_mutex_t lock;
+/*
+ * Context of the current nftw() call of
+ * bt_plugin_create_append_all_from_dir().
+ *
+ * nftw() doesn't pass any user data to its callback: this is
+ * thread-local so that different threads may walk plugin directories
+ * concurrently.
+ */
+static __thread struct {
 	struct bt_plugin_set *plugin_set;
 	bool recurse;
 	bool fail_on_load_error;
 	int status;
-} append_all_from_dir_info = {
-	.lock = PTHREAD_MUTEX_INITIALIZER
-};
+} append_all_from_dir_info;
 
 static
 int nftw_append_all_from_dir(const char *file,
@@ -622,7 +656,6 @@ int bt_plugin_create_append_all_from_dir(struct bt_plugin_set *plugin_set,
 		goto end;
 	}
 
-	pthread_mutex_lock(&append_all_from_dir_info.lock);
 	append_all_from_dir_info.plugin_set = plugin_set;
 	append_all_from_dir_info.recurse = recurse;
 	append_all_from_dir_info.status = BT_FUNC_STATUS_OK;
@@ -631,7 +664,6 @@ int bt_plugin_create_append_all_from_dir(struct bt_plugin_set *plugin_set,
 		APPEND_ALL_FROM_DIR_NFDOPEN_MAX, nftw_flags);
 	append_all_from_dir_info.plugin_set = NULL;
 	status = append_all_from_dir_info.status;
-	pthread_mutex_unlock(&append_all_from_dir_info.lock);
 	if (ret) {
 		BT_LIB_LOGW_APPEND_CAUSE("Failed to walk directory",
 			": path=\"%s\", recurse=%d",
@@ -39,14 +39,39 @@ void bt_clock_snapshot_reset(struct bt_clock_snapshot *clock_snapshot)
 	clock_snapshot->is_set = false;
 }
 
+/*
+ * Computes and caches the value of `clock_snapshot` in nanoseconds
+ * from origin so that bt_clock_snapshot_get_ns_from_origin() only has
+ * to return it.
+ */
 static inline
 void set_ns_from_origin(struct bt_clock_snapshot *clock_snapshot)
 {
-	if (bt_util_ns_from_origin_clock_class(clock_snapshot->clock_class,
-			clock_snapshot->value_cycles,
-			&clock_snapshot->ns_from_origin)) {
-		clock_snapshot->ns_from_origin_overflows = true;
+	const struct bt_clock_class *clock_class = clock_snapshot->clock_class;
+
+	/*
+	 * Fast path: with a 1 GHz clock class, a cycle is a nanosecond,
+	 * so that the value in nanoseconds from origin is the base
+	 * offset plus the raw value, provided the sum doesn't overflow.
+	 */
+	if (G_LIKELY(clock_class->frequency == UINT64_C(1000000000) &&
+			!clock_class->base_offset.overflows &&
+			clock_snapshot->value_cycles < (uint64_t) INT64_MAX)) {
+		const int64_t base_offset_ns = clock_class->base_offset.value_ns;
+		const int64_t value_ns = (int64_t) clock_snapshot->value_cycles;
+
+		if (G_LIKELY(base_offset_ns <= 0 ||
+				value_ns <= INT64_MAX - base_offset_ns)) {
+			clock_snapshot->ns_from_origin = base_offset_ns + value_ns;
+			clock_snapshot->ns_from_origin_overflows = false;
+			return;
+		}
 	}
+
+	clock_snapshot->ns_from_origin_overflows =
+		bt_util_ns_from_origin_clock_class(clock_class,
+			clock_snapshot->value_cycles,
+			&clock_snapshot->ns_from_origin) != 0;
 }
 
 static inline
@@ -59,6 +84,26 @@ void bt_clock_snapshot_set_raw_value(struct bt_clock_snapshot *clock_snapshot,
 	bt_clock_snapshot_set(clock_snapshot);
 }
 
+/*
+ * Initializes the clock snapshot `clock_snapshot`, which another
+ * object embeds (instead of getting it from the pool of
+ * `clock_class`), and sets its raw value to `cycles`.
+ *
+ * `clock_snapshot->clock_class` is a weak reference: the embedding
+ * object must guarantee that `clock_class` exists as long as it uses
+ * `clock_snapshot`.
+ */
+static inline
+void bt_clock_snapshot_init_embedded(struct bt_clock_snapshot *clock_snapshot,
+		struct bt_clock_class *clock_class, uint64_t cycles)
+{
+	BT_ASSERT_DBG(clock_snapshot);
+	BT_ASSERT_DBG(clock_class);
+	BT_ASSERT_DBG(clock_class->frozen);
+	clock_snapshot->clock_class = clock_class;
+	bt_clock_snapshot_set_raw_value(clock_snapshot, cycles);
+}
+
 void bt_clock_snapshot_destroy(struct bt_clock_snapshot *clock_snapshot);
 
 struct bt_clock_snapshot *bt_clock_snapshot_new(struct bt_clock_class *clock_class);
@@ -82,6 +82,12 @@ struct bt_event *bt_event_new(struct bt_event_class *event_class)
 			/* bt_field_create() logs errors */
 			goto error;
 		}
+
+		if (fc->may_borrow_data) {
+			bt_field_set_owner_has_borrowed_data(
+				event->common_context_field,
+				&event->has_borrowed_data);
+		}
 	}
 
 	fc = event_class->specific_context_fc;
@@ -91,6 +97,12 @@ struct bt_event *bt_event_new(struct bt_event_class *event_class)
 			/* bt_field_create() logs errors */
 			goto error;
 		}
+
+		if (fc->may_borrow_data) {
+			bt_field_set_owner_has_borrowed_data(
+				event->specific_context_field,
+				&event->has_borrowed_data);
+		}
 	}
 
 	fc = event_class->payload_fc;
@@ -100,6 +112,12 @@ struct bt_event *bt_event_new(struct bt_event_class *event_class)
 			/* bt_field_create() logs errors */
 			goto error;
 		}
+
+		if (fc->may_borrow_data) {
+			bt_field_set_owner_has_borrowed_data(
+				event->payload_field,
+				&event->has_borrowed_data);
+		}
 	}
 
 	goto end;
@@ -49,6 +49,13 @@ struct bt_event {
 	struct bt_field *specific_context_field;
 	struct bt_field *payload_field;
 	bool frozen;
+
+	/*
+	 * Whether or not some field of this event borrowed its data
+	 * since this event was last recycled (see
+	 * bt_field_set_owner_has_borrowed_data())
+	 */
+	bool has_borrowed_data;
 };
 
 void bt_event_destroy(struct bt_event *event);
@@ -95,6 +102,29 @@ void _bt_event_reset_dev_mode(struct bt_event *event)
 # define bt_event_reset_dev_mode(_x)
 #endif
 
+static inline
+void bt_event_release_borrowed_data(struct bt_event *event)
+{
+	BT_ASSERT_DBG(event);
+
+	if (event->common_context_field &&
+			event->common_context_field->class->may_borrow_data) {
+		bt_field_release_borrowed_data(event->common_context_field);
+	}
+
+	if (event->specific_context_field &&
+			event->specific_context_field->class->may_borrow_data) {
+		bt_field_release_borrowed_data(event->specific_context_field);
+	}
+
+	if (event->payload_field &&
+			event->payload_field->class->may_borrow_data) {
+		bt_field_release_borrowed_data(event->payload_field);
+	}
+
+	event->has_borrowed_data = false;
+}
+
 static inline
 void bt_event_reset(struct bt_event *event)
 {
@@ -141,6 +171,15 @@ void bt_event_recycle(struct bt_event *event)
 	 * 4. Put our event class reference.
 	 */
 	bt_event_reset(event);
+
+	/*
+	 * Don't keep borrowed data (a whole file mapping, for example)
+	 * alive while this event waits in the pool.
+	 */
+	if (event->has_borrowed_data) {
+		bt_event_release_borrowed_data(event);
+	}
+
 	event_class = event->class;
 	BT_ASSERT_DBG(event_class);
 	event->class = NULL;
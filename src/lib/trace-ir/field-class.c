@@ -48,6 +48,8 @@ int init_field_class(struct bt_field_class *fc, enum bt_field_class_type type,
 	BT_ASSERT(release_func);
 	bt_object_init_shared(&fc->base, release_func);
 	fc->type = type;
+	fc->may_borrow_data = type == BT_FIELD_CLASS_TYPE_STRING ||
+		bt_field_class_type_is(type, BT_FIELD_CLASS_TYPE_BLOB);
 	fc->user_attributes = bt_value_map_create();
 	if (!fc->user_attributes) {
 		BT_LIB_LOGE_APPEND_CAUSE(
@@ -1282,6 +1284,7 @@ int append_named_field_class_to_container_field_class(
 	 */
 	bt_field_class_freeze(named_fc->fc);
 	g_ptr_array_add(container_fc->named_fcs, named_fc);
+	container_fc->common.may_borrow_data |= named_fc->fc->may_borrow_data;
 
 	if (named_fc->name) {
 		/*
@@ -1568,6 +1571,7 @@ struct bt_field_class *create_option_field_class(
 	opt_fc->content_fc = content_fc;
 	bt_object_get_ref_no_null_check(opt_fc->content_fc);
 	bt_field_class_freeze(opt_fc->content_fc);
+	opt_fc->common.may_borrow_data = content_fc->may_borrow_data;
 
 	if (selector_fc) {
 		bt_field_class_freeze(selector_fc);
@@ -2595,6 +2599,7 @@ int init_array_field_class(struct bt_field_class_array *fc,
 	fc->element_fc = element_fc;
 	bt_object_get_ref_no_null_check(fc->element_fc);
 	bt_field_class_freeze(element_fc);
+	fc->common.may_borrow_data = element_fc->may_borrow_data;
 
 end:
 	return ret;
@@ -48,6 +48,12 @@ struct bt_field_class {
 	 */
 	bool part_of_trace_class;
 
+	/*
+	 * Whether or not an instance of this field class may contain a
+	 * field which borrows its data, that is, a string or BLOB field
+	 */
+	bool may_borrow_data;
+
 	/* Effective MIP version for this field class */
 	uint64_t mip_version;
 };
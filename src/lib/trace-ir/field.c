@@ -383,6 +383,34 @@ end:
 	return (void *) real_field;
 }
 
+static inline
+void release_borrowed_data(struct bt_field_borrowed_data *borrowed)
+{
+	bt_field_borrowed_data_release_func release_func;
+	void *user_data;
+
+	BT_ASSERT_DBG(borrowed);
+
+	if (!borrowed->data) {
+		return;
+	}
+
+	release_func = borrowed->release_func;
+	user_data = borrowed->user_data;
+	borrowed->data = NULL;
+	borrowed->release_func = NULL;
+	borrowed->user_data = NULL;
+	release_func(user_data);
+}
+
+static inline
+void mark_owner_has_borrowed_data(struct bt_field *field)
+{
+	if (field->owner_has_borrowed_data) {
+		*field->owner_has_borrowed_data = true;
+	}
+}
+
 static
 struct bt_field *create_string_field(struct bt_field_class *fc)
 {
@@ -565,6 +593,7 @@ struct bt_field *create_blob_field(struct bt_field_class *fc)
 			(void *) fc;
 		blob_field->length = blob_static_fc->length;
 		blob_field->data = g_malloc(blob_field->length);
+		blob_field->data_size = blob_field->length;
 		if (!blob_field->data) {
 			BT_LIB_LOGE_APPEND_CAUSE(
 				"Failed to allocate BLOB field data: %![fc-]+F",
@@ -929,6 +958,11 @@ const char *bt_field_string_get_value(const struct bt_field *field)
 	BT_ASSERT_PRE_DEV_FIELD_IS_SET("field", field);
 	BT_ASSERT_PRE_DEV_FIELD_HAS_CLASS_TYPE("field", field, "string-field",
 		BT_FIELD_CLASS_TYPE_STRING, "Field");
+
+	if (string_field->borrowed.data) {
+		return string_field->borrowed.data;
+	}
+
 	return (const char *) string_field->buf->data;
 }
 
@@ -950,11 +984,33 @@ void clear_string_field(struct bt_field *field)
 	struct bt_field_string *string_field = (void *) field;
 
 	BT_ASSERT_DBG(field);
+	release_borrowed_data(&string_field->borrowed);
 	string_field->length = 0;
 	bt_g_array_index(string_field->buf, char, 0) = '\0';
 	bt_field_set_single(field, true);
 }
 
+/*
+ * Copies the borrowed value of the string field `string_field`, if any,
+ * to its own buffer, and then releases it.
+ */
+static inline
+void unborrow_string_field_value(struct bt_field_string *string_field)
+{
+	if (G_LIKELY(!string_field->borrowed.data)) {
+		return;
+	}
+
+	if (string_field->length + 1 > string_field->buf->len) {
+		g_array_set_size(string_field->buf, string_field->length + 1);
+	}
+
+	/* Also copy the terminating null character */
+	memcpy(string_field->buf->data, string_field->borrowed.data,
+		string_field->length + 1);
+	release_borrowed_data(&string_field->borrowed);
+}
+
 BT_EXPORT
 enum bt_field_string_set_value_status bt_field_string_set_value(
 		struct bt_field *field, const char *value)
@@ -996,6 +1052,7 @@ enum bt_field_string_append_status append_to_string_field_with_length(
 
 	BT_ASSERT_DBG(field);
 	BT_ASSERT_DBG(value);
+	unborrow_string_field_value(string_field);
 	new_length = length + string_field->length;
 
 	if (G_UNLIKELY(new_length + 1 > string_field->buf->len)) {
@@ -1040,6 +1097,30 @@ void bt_field_string_clear(struct bt_field *field)
 	clear_string_field(field);
 }
 
+BT_EXPORT
+void bt_field_string_set_borrowed_value(struct bt_field *field,
+		const char *value, uint64_t length,
+		bt_field_borrowed_data_release_func release_func,
+		void *user_data)
+{
+	struct bt_field_string *string_field = (void *) field;
+
+	BT_ASSERT_PRE_DEV_FOR_APPEND_TO_STRING_FIELD_WITH_LENGTH(field, value,
+		length);
+	BT_ASSERT_PRE_DEV("value-is-null-terminated", value[length] == '\0',
+		"Borrowed string value isn't null-terminated: "
+		"partial-value=\"%.32s\", length=%" PRIu64, value, length);
+	BT_ASSERT_PRE_DEV_NON_NULL("release-function", release_func,
+		"Release function");
+	release_borrowed_data(&string_field->borrowed);
+	string_field->borrowed.data = value;
+	string_field->borrowed.release_func = release_func;
+	string_field->borrowed.user_data = user_data;
+	string_field->length = length;
+	mark_owner_has_borrowed_data(field);
+	bt_field_set_single(field, true);
+}
+
 BT_EXPORT
 uint64_t bt_field_array_get_length(const struct bt_field *field)
 {
@@ -1085,6 +1166,11 @@ enum bt_field_array_dynamic_set_length_status bt_field_array_dynamic_set_length(
 				goto end;
 			}
 
+			if (array_fc->element_fc->may_borrow_data) {
+				bt_field_set_owner_has_borrowed_data(elem_field,
+					field->owner_has_borrowed_data);
+			}
+
 			BT_ASSERT_DBG(!array_field->fields->pdata[i]);
 			array_field->fields->pdata[i] = elem_field;
 		}
@@ -1369,7 +1455,7 @@ uint64_t bt_field_variant_get_selected_option_index(
 BT_EXPORT
 uint8_t *bt_field_blob_get_data(struct bt_field *field)
 {
-	const struct bt_field_blob *blob_field = (const void *) field;
+	struct bt_field_blob *blob_field = (void *) field;
 
 	BT_ASSERT_PRE_DEV_FIELD_NON_NULL(field);
 	BT_ASSERT_PRE_DEV_FIELD_IS_BLOB("field", field, "Field");
@@ -1378,6 +1464,20 @@ uint8_t *bt_field_blob_get_data(struct bt_field *field)
 		blob_field->length > 0,
 		"BLOB field length is not set: %!+f", field);
 
+	if (blob_field->borrowed.data) {
+		/* Copy on write */
+		if (blob_field->length > blob_field->data_size) {
+			blob_field->data = g_realloc(blob_field->data,
+				blob_field->length);
+			BT_ASSERT(blob_field->data);
+			blob_field->data_size = blob_field->length;
+		}
+
+		memcpy(blob_field->data, blob_field->borrowed.data,
+			blob_field->length);
+		release_borrowed_data(&blob_field->borrowed);
+	}
+
 	/* Assume that the user will fill the bytes. */
 	bt_field_set_single(field, true);
 
@@ -1392,6 +1492,10 @@ const uint8_t *bt_field_blob_get_data_const(const struct bt_field *field)
 	BT_ASSERT_PRE_DEV_FIELD_NON_NULL(field);
 	BT_ASSERT_PRE_DEV_FIELD_IS_BLOB("field", field, "Field");
 
+	if (blob_field->borrowed.data) {
+		return blob_field->borrowed.data;
+	}
+
 	return blob_field->data;
 }
 
@@ -1407,7 +1511,9 @@ enum bt_field_blob_dynamic_set_length_status bt_field_blob_dynamic_set_length(
 	BT_ASSERT_PRE_DEV_FIELD_IS_DYNAMIC_BLOB("field", field, "Field");
 	BT_ASSERT_PRE_DEV_FIELD_HOT(field);
 
-	if (G_UNLIKELY(length > blob_field->length)) {
+	release_borrowed_data(&blob_field->borrowed);
+
+	if (G_UNLIKELY(length > blob_field->data_size)) {
 		/* Make more room */
 		uint8_t *data = g_realloc(blob_field->data, length);
 
@@ -1420,6 +1526,7 @@ enum bt_field_blob_dynamic_set_length_status bt_field_blob_dynamic_set_length(
 		}
 
 		blob_field->data = data;
+		blob_field->data_size = length;
 	}
 
 	blob_field->length = length;
@@ -1440,6 +1547,29 @@ uint64_t bt_field_blob_get_length(const struct bt_field *field)
 	return blob_field->length;
 }
 
+BT_EXPORT
+void bt_field_blob_set_borrowed_data(struct bt_field *field,
+		const uint8_t *data,
+		bt_field_borrowed_data_release_func release_func,
+		void *user_data)
+{
+	struct bt_field_blob *blob_field = (void *) field;
+
+	BT_ASSERT_PRE_DEV_NO_ERROR();
+	BT_ASSERT_PRE_DEV_FIELD_NON_NULL(field);
+	BT_ASSERT_PRE_DEV_FIELD_IS_BLOB("field", field, "Field");
+	BT_ASSERT_PRE_DEV_FIELD_HOT(field);
+	BT_ASSERT_PRE_DEV_NON_NULL("data", data, "Data");
+	BT_ASSERT_PRE_DEV_NON_NULL("release-function", release_func,
+		"Release function");
+	release_borrowed_data(&blob_field->borrowed);
+	blob_field->borrowed.data = data;
+	blob_field->borrowed.release_func = release_func;
+	blob_field->borrowed.user_data = user_data;
+	mark_owner_has_borrowed_data(field);
+	bt_field_set_single(field, true);
+}
+
 
 static inline
 void bt_field_finalize(struct bt_field *field)
@@ -1543,7 +1673,7 @@ void destroy_blob_field(struct bt_field *field)
 	BT_ASSERT(field);
 	BT_LIB_LOGD("Destroying BLOB field object: %!+f", field);
 	bt_field_finalize(field);
-
+	release_borrowed_data(&blob_field->borrowed);
 	g_free(blob_field->data);
 
 	g_free(field);
@@ -1574,6 +1704,7 @@ void destroy_string_field(struct bt_field *field)
 	BT_ASSERT(field);
 	BT_LIB_LOGD("Destroying string field object: %!+f", field);
 	bt_field_finalize(field);
+	release_borrowed_data(&string_field->borrowed);
 
 	if (string_field->buf) {
 		g_array_free(string_field->buf, TRUE);
@@ -1583,6 +1714,126 @@ void destroy_string_field(struct bt_field *field)
 	g_free(field);
 }
 
+void bt_field_set_owner_has_borrowed_data(struct bt_field *field,
+		bool *owner_has_borrowed_data)
+{
+	enum bt_field_class_type type;
+	uint64_t i;
+
+	BT_ASSERT(field);
+	BT_ASSERT(field->class->may_borrow_data);
+	type = field->class->type;
+	field->owner_has_borrowed_data = owner_has_borrowed_data;
+
+	if (type == BT_FIELD_CLASS_TYPE_STRUCTURE) {
+		struct bt_field_structure *struct_field = (void *) field;
+
+		for (i = 0; i < struct_field->fields->len; i++) {
+			struct bt_field *member_field =
+				struct_field->fields->pdata[i];
+
+			if (member_field->class->may_borrow_data) {
+				bt_field_set_owner_has_borrowed_data(
+					member_field, owner_has_borrowed_data);
+			}
+		}
+	} else if (bt_field_class_type_is(type, BT_FIELD_CLASS_TYPE_ARRAY)) {
+		struct bt_field_array *array_field = (void *) field;
+
+		/*
+		 * bt_field_array_dynamic_set_length() handles the element
+		 * fields it creates afterwards.
+		 */
+		for (i = 0; i < array_field->fields->len; i++) {
+			bt_field_set_owner_has_borrowed_data(
+				array_field->fields->pdata[i],
+				owner_has_borrowed_data);
+		}
+	} else if (bt_field_class_type_is(type, BT_FIELD_CLASS_TYPE_OPTION)) {
+		struct bt_field_option *opt_field = (void *) field;
+
+		bt_field_set_owner_has_borrowed_data(opt_field->content_field,
+			owner_has_borrowed_data);
+	} else if (bt_field_class_type_is(type, BT_FIELD_CLASS_TYPE_VARIANT)) {
+		struct bt_field_variant *var_field = (void *) field;
+
+		for (i = 0; i < var_field->fields->len; i++) {
+			struct bt_field *opt_field = var_field->fields->pdata[i];
+
+			if (opt_field->class->may_borrow_data) {
+				bt_field_set_owner_has_borrowed_data(
+					opt_field, owner_has_borrowed_data);
+			}
+		}
+	}
+}
+
+void bt_field_release_borrowed_data(struct bt_field *field)
+{
+	enum bt_field_class_type type;
+	uint64_t i;
+
+	BT_ASSERT_DBG(field);
+	BT_ASSERT_DBG(field->class->may_borrow_data);
+	type = field->class->type;
+
+	if (type == BT_FIELD_CLASS_TYPE_STRING) {
+		struct bt_field_string *string_field = (void *) field;
+
+		if (string_field->borrowed.data) {
+			release_borrowed_data(&string_field->borrowed);
+			string_field->length = 0;
+			bt_g_array_index(string_field->buf, char, 0) = '\0';
+		}
+	} else if (bt_field_class_type_is(type, BT_FIELD_CLASS_TYPE_BLOB)) {
+		struct bt_field_blob *blob_field = (void *) field;
+
+		if (blob_field->borrowed.data) {
+			release_borrowed_data(&blob_field->borrowed);
+
+			/* Only the owned data remains */
+			blob_field->length = MIN(blob_field->length,
+				blob_field->data_size);
+		}
+	} else if (type == BT_FIELD_CLASS_TYPE_STRUCTURE) {
+		struct bt_field_structure *struct_field = (void *) field;
+
+		for (i = 0; i < struct_field->fields->len; i++) {
+			struct bt_field *member_field =
+				struct_field->fields->pdata[i];
+
+			if (member_field->class->may_borrow_data) {
+				bt_field_release_borrowed_data(member_field);
+			}
+		}
+	} else if (bt_field_class_type_is(type, BT_FIELD_CLASS_TYPE_ARRAY)) {
+		struct bt_field_array *array_field = (void *) field;
+
+		/*
+		 * Also consider the fields beyond the current length: they
+		 * may still borrow data from a previous use.
+		 */
+		for (i = 0; i < array_field->fields->len; i++) {
+			bt_field_release_borrowed_data(
+				array_field->fields->pdata[i]);
+		}
+	} else if (bt_field_class_type_is(type, BT_FIELD_CLASS_TYPE_OPTION)) {
+		struct bt_field_option *opt_field = (void *) field;
+
+		bt_field_release_borrowed_data(opt_field->content_field);
+	} else if (bt_field_class_type_is(type, BT_FIELD_CLASS_TYPE_VARIANT)) {
+		struct bt_field_variant *var_field = (void *) field;
+
+		for (i = 0; i < var_field->fields->len; i++) {
+			struct bt_field *opt_field = var_field->fields->pdata[i];
+
+			if (opt_field->class->may_borrow_data) {
+				bt_field_release_borrowed_data(opt_field);
+			}
+		}
+	}
+}
+
 void bt_field_destroy(struct bt_field *field)
 {
 	BT_ASSERT(field);
@@ -9,6 +9,7 @@
 #define BABELTRACE_LIB_TRACE_IR_FIELD_H
 
 #include "lib/object.h"
+#include <babeltrace2/trace-ir/field.h>
 #include <babeltrace2/types.h>
 #include <stdint.h>
 #include <stdbool.h>
@@ -38,6 +39,13 @@ struct bt_field {
 	/* Virtual table for slow path (dev mode) operations */
 	struct bt_field_methods *methods;
 
+	/*
+	 * Flag of the owner (event or packet) of this field to set when
+	 * this field, or one of its contained fields, borrows its data
+	 * (`NULL` if none)
+	 */
+	bool *owner_has_borrowed_data;
+
 	bool is_set;
 	bool frozen;
 };
@@ -96,11 +104,28 @@ struct bt_field_variant {
 	GPtrArray *fields;
 };
 
+/* Data which a string or BLOB field borrows from its user */
+struct bt_field_borrowed_data {
+	/* Borrowed data, or `NULL` if none */
+	const void *data;
+
+	bt_field_borrowed_data_release_func release_func;
+	void *user_data;
+};
+
 struct bt_field_blob {
 	struct bt_field common;
 
 	uint64_t length;
+
+	/* Owned data */
 	uint8_t *data;
+
+	/* Size of `data` (bytes) */
+	uint64_t data_size;
+
+	/* If `borrowed.data` isn't `NULL`, then it's the actual data */
+	struct bt_field_borrowed_data borrowed;
 };
 
 struct bt_field_array {
@@ -117,6 +142,9 @@ struct bt_field_string {
 	struct bt_field common;
 	GArray *buf;
 	uint64_t length;
+
+	/* If `borrowed.data` isn't `NULL`, then it's the actual value */
+	struct bt_field_borrowed_data borrowed;
 };
 
 #ifdef BT_DEV_MODE
@@ -168,4 +196,24 @@ struct bt_field *bt_field_create(struct bt_field_class *class);
 
 void bt_field_destroy(struct bt_field *field);
 
+/*
+ * Makes the fields of `field` which may borrow their data set
+ * `*owner_has_borrowed_data` to true when they do (see
+ * bt_field_string_set_borrowed_value() and
+ * bt_field_blob_set_borrowed_data()).
+ *
+ * Call this when attaching `field` to its owner.
+ */
+void bt_field_set_owner_has_borrowed_data(struct bt_field *field,
+		bool *owner_has_borrowed_data);
+
+/*
+ * Releases the data which `field` and its contained fields borrow, if
+ * any.
+ *
+ * Call this when recycling the owner of `field` so that a pooled object
+ * doesn't keep borrowed data until its next use.
+ */
+void bt_field_release_borrowed_data(struct bt_field *field);
+
 #endif /* BABELTRACE_LIB_TRACE_IR_FIELD_H */
@@ -78,6 +78,16 @@ void reset_packet(struct bt_packet *packet)
 	if (packet->context_field) {
 		bt_field_set_is_frozen(packet->context_field->field, false);
 		bt_field_reset(packet->context_field->field);
+
+		/*
+		 * Don't keep borrowed data alive while this packet waits
+		 * in the pool.
+		 */
+		if (packet->has_borrowed_data) {
+			bt_field_release_borrowed_data(
+				packet->context_field->field);
+			packet->has_borrowed_data = false;
+		}
 	}
 }
 
@@ -182,6 +192,12 @@ struct bt_packet *bt_packet_new(struct bt_stream *stream)
 				"Cannot create packet context field wrapper.");
 			goto error;
 		}
+
+		if (stream->class->packet_context_fc->may_borrow_data) {
+			bt_field_set_owner_has_borrowed_data(
+				packet->context_field->field,
+				&packet->has_borrowed_data);
+		}
 	}
 
 	BT_LIB_LOGD("Created packet object: %!+a", packet);
@@ -21,6 +21,13 @@ struct bt_packet {
 	struct bt_field_wrapper *context_field;
 	struct bt_stream *stream;
 	bool frozen;
+
+	/*
+	 * Whether or not some field of this packet borrowed its data
+	 * since this packet was last recycled (see
+	 * bt_field_set_owner_has_borrowed_data())
+	 */
+	bool has_borrowed_data;
 };
 
 void _bt_packet_set_is_frozen(const struct bt_packet *packet, bool is_frozen);
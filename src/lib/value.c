@@ -46,6 +46,9 @@ static
 struct bt_value bt_value_null_instance = {
 	.base = {
 		.is_shared = true,
+
+		/* All the threads share this singleton */
+		.has_atomic_ref_count = true,
 		.ref_count = 1,
 		.release_func = bt_value_null_instance_release_func,
 		.spec_release_func = NULL,
@@ -83,13 +86,24 @@ void bt_value_array_destroy(struct bt_value *object)
 static
 void bt_value_map_destroy(struct bt_value *object)
 {
-	/*
-	 * Hash table's registered value destructor will take care of
-	 * putting each contained object. Keys are GQuarks and cannot
-	 * be destroyed anyway.
-	 */
-	g_hash_table_destroy(BT_VALUE_TO_MAP(object)->ght);
-	BT_VALUE_TO_MAP(object)->ght = NULL;
+	struct bt_value_map *map_obj = BT_VALUE_TO_MAP(object);
+	guint i;
+
+	if (map_obj->entries) {
+		for (i = 0; i < map_obj->entries->len; i++) {
+			struct bt_value_map_entry *entry = &g_array_index(
+				map_obj->entries, struct bt_value_map_entry, i);
+
+			g_free(entry->key);
+			bt_object_put_ref(entry->value);
+		}
+
+		g_array_free(map_obj->entries, TRUE);
+		map_obj->entries = NULL;
+	}
+
+	g_free(map_obj->index);
+	map_obj->index = NULL;
 }
 
 static
@@ -204,8 +218,7 @@ static
 struct bt_value *bt_value_map_copy(const struct bt_value *map_obj)
 {
 	int ret;
-	GHashTableIter iter;
-	gpointer key, element_obj;
+	guint i;
 	struct bt_value *copy_obj;
 	struct bt_value *element_obj_copy = NULL;
 	struct bt_value_map *typed_map_obj;
@@ -217,10 +230,11 @@ struct bt_value *bt_value_map_copy(const struct bt_value *map_obj)
 		goto end;
 	}
 
-	g_hash_table_iter_init(&iter, typed_map_obj->ght);
-
-	while (g_hash_table_iter_next(&iter, &key, &element_obj)) {
-		const char *key_str = g_quark_to_string(GPOINTER_TO_UINT(key));
+	for (i = 0; i < typed_map_obj->entries->len; i++) {
+		const struct bt_value_map_entry *entry = &g_array_index(
+			typed_map_obj->entries, struct bt_value_map_entry, i);
+		const char *key_str = entry->key;
+		struct bt_value *element_obj = entry->value;
 
 		BT_ASSERT(key_str);
 		BT_LOGD("Copying map value's element: element-addr=%p, "
@@ -399,8 +413,7 @@ bt_bool bt_value_map_is_equal(const struct bt_value *object_a,
 		const struct bt_value *object_b)
 {
 	bt_bool ret = BT_TRUE;
-	GHashTableIter iter;
-	gpointer key, element_obj_a;
+	guint i;
 	const struct bt_value_map *map_obj_a = BT_VALUE_TO_MAP(object_a);
 
 	if (bt_value_map_get_size(object_a) !=
@@ -415,11 +428,12 @@ bt_bool bt_value_map_is_equal(const struct bt_value *object_a,
 		goto end;
 	}
 
-	g_hash_table_iter_init(&iter, map_obj_a->ght);
-
-	while (g_hash_table_iter_next(&iter, &key, &element_obj_a)) {
+	for (i = 0; i < map_obj_a->entries->len; i++) {
+		const struct bt_value_map_entry *entry = &g_array_index(
+			map_obj_a->entries, struct bt_value_map_entry, i);
+		const struct bt_value *element_obj_a = entry->value;
 		const struct bt_value *element_obj_b;
-		const char *key_str = g_quark_to_string(GPOINTER_TO_UINT(key));
+		const char *key_str = entry->key;
 
 		element_obj_b = bt_value_map_borrow_entry_value_const(object_b,
 			key_str);
@@ -478,14 +492,12 @@ void bt_value_array_freeze(struct bt_value *object)
 static
 void bt_value_map_freeze(struct bt_value *object)
 {
-	GHashTableIter iter;
-	gpointer key, element_obj;
+	guint i;
 	const struct bt_value_map *map_obj = BT_VALUE_TO_MAP(object);
 
-	g_hash_table_iter_init(&iter, map_obj->ght);
-
-	while (g_hash_table_iter_next(&iter, &key, &element_obj)) {
-		bt_value_freeze(element_obj);
+	for (i = 0; i < map_obj->entries->len; i++) {
+		bt_value_freeze(g_array_index(map_obj->entries,
+			struct bt_value_map_entry, i).value);
 	}
 
 	bt_value_generic_freeze(object);
@@ -777,10 +789,10 @@ struct bt_value *bt_value_map_create(void)
 	}
 
 	map_obj->base = bt_value_create_base(BT_VALUE_TYPE_MAP);
-	map_obj->ght = g_hash_table_new_full(g_direct_hash, g_direct_equal,
-		NULL, (GDestroyNotify) bt_object_put_ref);
-	if (!map_obj->ght) {
-		BT_LIB_LOGE_APPEND_CAUSE("Failed to allocate a GHashTable.");
+	map_obj->entries = g_array_new(FALSE, FALSE,
+		sizeof(struct bt_value_map_entry));
+	if (!map_obj->entries) {
+		BT_LIB_LOGE_APPEND_CAUSE("Failed to allocate a GArray.");
 		g_free(map_obj);
 		map_obj = NULL;
 		goto end;
@@ -1118,18 +1130,106 @@ uint64_t bt_value_map_get_size(const struct bt_value *map_obj)
 {
 	BT_ASSERT_PRE_DEV_VALUE_NON_NULL(map_obj);
 	BT_ASSERT_PRE_DEV_VALUE_IS_MAP(map_obj);
-	return (uint64_t) g_hash_table_size(BT_VALUE_TO_MAP(map_obj)->ght);
+	return (uint64_t) BT_VALUE_TO_MAP(map_obj)->entries->len;
+}
+
+/*
+ * Returns the index, within `map_obj->entries`, of the entry having the
+ * key `key` of which the g_str_hash() value is `key_hash`, or -1 if
+ * there's none.
+ */
+static
+gint64 find_map_entry(const struct bt_value_map *map_obj, const char *key,
+		guint key_hash)
+{
+	const struct bt_value_map_entry *entries =
+		(const void *) map_obj->entries->data;
+
+	if (!map_obj->index) {
+		guint i;
+
+		for (i = 0; i < map_obj->entries->len; i++) {
+			if (entries[i].key_hash == key_hash &&
+					strcmp(entries[i].key, key) == 0) {
+				return (gint64) i;
+			}
+		}
+	} else {
+		const guint mask = map_obj->index_slot_count - 1;
+		guint slot_i;
+
+		for (slot_i = key_hash & mask; map_obj->index[slot_i] != 0;
+				slot_i = (slot_i + 1) & mask) {
+			const guint entry_i = map_obj->index[slot_i] - 1;
+
+			if (entries[entry_i].key_hash == key_hash &&
+					strcmp(entries[entry_i].key, key) == 0) {
+				return (gint64) entry_i;
+			}
+		}
+	}
+
+	return -1;
+}
+
+/*
+ * Adds the entry at the index `entry_i` of `map_obj->entries` to the
+ * hash index of `map_obj`, which must have a free slot.
+ */
+static
+void index_map_entry(struct bt_value_map *map_obj, guint entry_i)
+{
+	const guint mask = map_obj->index_slot_count - 1;
+	guint slot_i = g_array_index(map_obj->entries,
+		struct bt_value_map_entry, entry_i).key_hash & mask;
+
+	while (map_obj->index[slot_i] != 0) {
+		slot_i = (slot_i + 1) & mask;
+	}
+
+	map_obj->index[slot_i] = entry_i + 1;
+}
+
+/*
+ * (Re)builds the hash index of `map_obj` so that its load factor is at
+ * most 1/2.
+ */
+static
+void rebuild_map_index(struct bt_value_map *map_obj)
+{
+	guint slot_count = 16;
+	guint i;
+
+	while (slot_count < map_obj->entries->len * 2) {
+		slot_count *= 2;
+	}
+
+	g_free(map_obj->index);
+	map_obj->index = g_new0(guint, slot_count);
+	map_obj->index_slot_count = slot_count;
+
+	for (i = 0; i < map_obj->entries->len; i++) {
+		index_map_entry(map_obj, i);
+	}
 }
 
 BT_EXPORT
 struct bt_value *bt_value_map_borrow_entry_value(struct bt_value *map_obj,
 		const char *key)
 {
+	const struct bt_value_map *typed_map_obj = BT_VALUE_TO_MAP(map_obj);
+	gint64 entry_i;
+
 	BT_ASSERT_PRE_DEV_VALUE_NON_NULL(map_obj);
 	BT_ASSERT_PRE_DEV_KEY_NON_NULL(key);
 	BT_ASSERT_PRE_DEV_VALUE_IS_MAP(map_obj);
-	return g_hash_table_lookup(BT_VALUE_TO_MAP(map_obj)->ght,
-		GUINT_TO_POINTER(g_quark_from_string(key)));
+	entry_i = find_map_entry(typed_map_obj, key, g_str_hash(key));
+	if (entry_i < 0) {
+		return NULL;
+	}
+
+	return g_array_index(typed_map_obj->entries,
+		struct bt_value_map_entry, entry_i).value;
 }
 
 BT_EXPORT
@@ -1145,8 +1245,8 @@ bt_bool bt_value_map_has_entry(const struct bt_value *map_obj, const char *key)
 	BT_ASSERT_PRE_DEV_VALUE_NON_NULL(map_obj);
 	BT_ASSERT_PRE_DEV_KEY_NON_NULL(key);
 	BT_ASSERT_PRE_DEV_VALUE_IS_MAP(map_obj);
-	return bt_g_hash_table_contains(BT_VALUE_TO_MAP(map_obj)->ght,
-		GUINT_TO_POINTER(g_quark_from_string(key)));
+	return find_map_entry(BT_VALUE_TO_MAP(map_obj), key,
+		g_str_hash(key)) >= 0;
 }
 
 static
@@ -1154,6 +1254,10 @@ enum bt_value_map_insert_entry_status insert_map_value_entry(
 		struct bt_value *map_obj, const char *key,
 		struct bt_value *element_obj, const char *api_func)
 {
+	struct bt_value_map *typed_map_obj;
+	guint key_hash;
+	gint64 entry_i;
+
 	BT_ASSERT_PRE_NO_ERROR_FROM_FUNC(api_func);
 	BT_ASSERT_PRE_NON_NULL_FROM_FUNC(api_func, "map-value-object",
 		map_obj, "Map value object");
@@ -1163,9 +1267,42 @@ enum bt_value_map_insert_entry_status insert_map_value_entry(
 	BT_ASSERT_PRE_VALUE_HAS_TYPE_FROM_FUNC(api_func, "value-object",
 		map_obj, "map", BT_VALUE_TYPE_MAP);
 	BT_ASSERT_PRE_DEV_VALUE_HOT_FROM_FUNC(api_func, map_obj);
-	g_hash_table_insert(BT_VALUE_TO_MAP(map_obj)->ght,
-		GUINT_TO_POINTER(g_quark_from_string(key)), element_obj);
+	typed_map_obj = BT_VALUE_TO_MAP(map_obj);
+	key_hash = g_str_hash(key);
+	entry_i = find_map_entry(typed_map_obj, key, key_hash);
 	bt_object_get_ref(element_obj);
+
+	if (entry_i >= 0) {
+		/* Replace the value of the existing entry */
+		struct bt_value_map_entry *entry = &g_array_index(
+			typed_map_obj->entries, struct bt_value_map_entry,
+			entry_i);
+
+		bt_object_put_ref(entry->value);
+		entry->value = element_obj;
+	} else {
+		struct bt_value_map_entry entry = {
+			.key = g_strdup(key),
+			.key_hash = key_hash,
+			.value = element_obj,
+		};
+
+		g_array_append_val(typed_map_obj->entries, entry);
+
+		if (typed_map_obj->index) {
+			if (typed_map_obj->entries->len * 2 >
+					typed_map_obj->index_slot_count) {
+				rebuild_map_index(typed_map_obj);
+			} else {
+				index_map_entry(typed_map_obj,
+					typed_map_obj->entries->len - 1);
+			}
+		} else if (typed_map_obj->entries->len >
+				BT_VALUE_MAP_MAX_UNINDEXED_ENTRY_COUNT) {
+			rebuild_map_index(typed_map_obj);
+		}
+	}
+
 	BT_LOGT("Inserted value into map value: map-value-addr=%p, "
 		"key=\"%s\", element-value-addr=%p",
 		map_obj, key, element_obj);
@@ -1315,8 +1452,7 @@ enum bt_value_map_foreach_entry_status foreach_map_entry(
 		const char *user_func_name)
 {
 	int status = BT_FUNC_STATUS_OK;
-	gpointer key, element_obj;
-	GHashTableIter iter;
+	guint i;
 	struct bt_value_map *typed_map_obj = BT_VALUE_TO_MAP(map_obj);
 
 	BT_ASSERT_PRE_NO_ERROR_FROM_FUNC(api_func);
@@ -1325,10 +1461,11 @@ enum bt_value_map_foreach_entry_status foreach_map_entry(
 		func, "User function");
 	BT_ASSERT_PRE_VALUE_HAS_TYPE_FROM_FUNC(api_func, "value-object",
 		map_obj, "map", BT_VALUE_TYPE_MAP);
-	g_hash_table_iter_init(&iter, typed_map_obj->ght);
-
-	while (g_hash_table_iter_next(&iter, &key, &element_obj)) {
-		const char *key_str = g_quark_to_string(GPOINTER_TO_UINT(key));
+	for (i = 0; i < typed_map_obj->entries->len; i++) {
+		const struct bt_value_map_entry *entry = &g_array_index(
+			typed_map_obj->entries, struct bt_value_map_entry, i);
+		const char *key_str = entry->key;
+		struct bt_value *element_obj = entry->value;
 
 		status = func(key_str, element_obj, data);
 		BT_ASSERT_POST_NO_ERROR_IF_NO_ERROR_STATUS(user_func_name,
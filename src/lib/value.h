@@ -46,9 +46,41 @@ struct bt_value_array {
 	GPtrArray *garray;
 };
 
+/*
+ * Maximum number of entries of a map value without a hash index: up to
+ * this count, finding an entry is a linear search in its entry array.
+ */
+#define BT_VALUE_MAP_MAX_UNINDEXED_ENTRY_COUNT	8
+
+struct bt_value_map_entry {
+	/* Owned by this */
+	char *key;
+
+	/* g_str_hash() of `key` */
+	guint key_hash;
+
+	/* Owned by this */
+	struct bt_value *value;
+};
+
 struct bt_value_map {
 	struct bt_value base;
-	GHashTable *ght;
+
+	/* Array of `struct bt_value_map_entry`, in insertion order */
+	GArray *entries;
+
+	/*
+	 * Open addressing (linear probing) hash index of `entries`, or
+	 * `NULL` while `entries` contains at most
+	 * `BT_VALUE_MAP_MAX_UNINDEXED_ENTRY_COUNT` entries.
+	 *
+	 * Each slot is either 0 (empty) or the index of an entry within
+	 * `entries` plus one.
+	 */
+	guint *index;
+
+	/* Number of slots of `index` (power of two) */
+	guint index_slot_count;
 };
 
 void _bt_value_freeze(const struct bt_value *object);
@@ -15,6 +15,60 @@
 
 namespace muxing {
 
+bt2::OptionalBorrowedObject<bt2::ConstClockSnapshot> msgCs(const bt2::ConstMessage msg) noexcept
+{
+    switch (msg.type()) {
+    case bt2::MessageType::Event:
+        if (msg.asEvent().streamClassDefaultClockClass()) {
+            return msg.asEvent().defaultClockSnapshot();
+        }
+
+        break;
+    case bt2::MessageType::PacketBeginning:
+        if (msg.asPacketBeginning().packet().stream().cls().packetsHaveBeginningClockSnapshot()) {
+            return msg.asPacketBeginning().defaultClockSnapshot();
+        }
+
+        break;
+    case bt2::MessageType::PacketEnd:
+        if (msg.asPacketEnd().packet().stream().cls().packetsHaveEndClockSnapshot()) {
+            return msg.asPacketEnd().defaultClockSnapshot();
+        }
+
+        break;
+    case bt2::MessageType::DiscardedEvents:
+        if (msg.asDiscardedEvents().stream().cls().discardedEventsHaveDefaultClockSnapshots()) {
+            return msg.asDiscardedEvents().beginningDefaultClockSnapshot();
+        }
+
+        break;
+    case bt2::MessageType::DiscardedPackets:
+        if (msg.asDiscardedPackets().stream().cls().discardedPacketsHaveDefaultClockSnapshots()) {
+            return msg.asDiscardedPackets().beginningDefaultClockSnapshot();
+        }
+
+        break;
+    case bt2::MessageType::MessageIteratorInactivity:
+        return msg.asMessageIteratorInactivity().clockSnapshot();
+    case bt2::MessageType::StreamBeginning:
+        if (msg.asStreamBeginning().streamClassDefaultClockClass()) {
+            return msg.asStreamBeginning().defaultClockSnapshot();
+        }
+
+        break;
+    case bt2::MessageType::StreamEnd:
+        if (msg.asStreamEnd().streamClassDefaultClockClass()) {
+            return msg.asStreamEnd().defaultClockSnapshot();
+        }
+
+        break;
+    default:
+        bt_common_abort();
+    }
+
+    return {};
+}
+
 /*
  * Compares two optional objects.
  *
@@ -8,9 +8,20 @@
 #define BABELTRACE_PLUGINS_COMMON_MUXING_MUXING_HPP
 
 #include "cpp-common/bt2/message.hpp"
+#include "cpp-common/bt2/optional-borrowed-object.hpp"
 
 namespace muxing {
 
+/*
+ * Returns the default clock snapshot of `msg`, or the clock snapshot
+ * of `msg` if it's a message iterator inactivity message, possibly
+ * missing.
+ *
+ * For a discarded events/packets message, returns its beginning
+ * default clock snapshot.
+ */
+bt2::OptionalBorrowedObject<bt2::ConstClockSnapshot> msgCs(bt2::ConstMessage msg) noexcept;
+
 class MessageComparator final
 {
 public:
@@ -0,0 +1,70 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS Inc. and Linux Foundation
+ */
+
+#include "event-record-cls-filter.hpp"
+
+namespace ctf {
+namespace src {
+
+EventRecordClsFilter::EventRecordClsFilter(std::unordered_set<std::string> names,
+                                           std::unordered_set<unsigned long long> ids) noexcept :
+    _mNames {std::move(names)},
+    _mIds {std::move(ids)}
+{
+}
+
+EventRecordClsFilter EventRecordClsFilter::fromParams(const bt2::ConstMapValue params,
+                                                      const bt2c::Logger& logger)
+{
+    std::unordered_set<std::string> names;
+    std::unordered_set<unsigned long long> ids;
+
+    /* event-record-class-names parameter */
+    if (const auto namesVal = params["event-record-class-names"]) {
+        const auto namesArrayVal = namesVal->asArray();
+
+        for (std::uint64_t i = 0; i < namesArrayVal.length(); ++i) {
+            names.emplace(namesArrayVal[i].asString().value().str());
+        }
+    }
+
+    /* event-record-class-ids parameter */
+    if (const auto idsVal = params["event-record-class-ids"]) {
+        const auto idsArrayVal = idsVal->asArray();
+
+        for (std::uint64_t i = 0; i < idsArrayVal.length(); ++i) {
+            const auto id = idsArrayVal[i].asSignedInteger().value();
+
+            if (id < 0) {
+                BT_CPPLOGE_APPEND_CAUSE_AND_THROW_SPEC(
+                    logger, bt2c::Error,
+                    "Invalid `event-record-class-ids` parameter: expecting non-negative IDs: "
+                    "index={}, val={}",
+                    i, id);
+            }
+
+            ids.emplace(static_cast<unsigned long long>(id));
+        }
+    }
+
+    return EventRecordClsFilter {std::move(names), std::move(ids)};
+}
+
+bool EventRecordClsFilter::keeps(const EventRecordCls& eventRecordCls) const noexcept
+{
+    if (this->isEmpty()) {
+        return true;
+    }
+
+    if (_mIds.find(eventRecordCls.id()) != _mIds.end()) {
+        return true;
+    }
+
+    return eventRecordCls.name() && _mNames.find(*eventRecordCls.name()) != _mNames.end();
+}
+
+} /* namespace src */
+} /* namespace ctf */
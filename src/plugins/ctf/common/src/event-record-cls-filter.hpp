@@ -0,0 +1,85 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS Inc. and Linux Foundation
+ */
+
+#ifndef BABELTRACE_PLUGINS_CTF_COMMON_SRC_EVENT_RECORD_CLS_FILTER_HPP
+#define BABELTRACE_PLUGINS_CTF_COMMON_SRC_EVENT_RECORD_CLS_FILTER_HPP
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+#include "cpp-common/bt2/value.hpp"
+#include "cpp-common/bt2c/logging.hpp"
+
+#include "metadata/ctf-ir.hpp"
+
+namespace ctf {
+namespace src {
+
+/*
+ * Event record class filter.
+ *
+ * A CTF message iterator (see `MsgIter`) only creates event messages
+ * for the event records of which the class this filter keeps.
+ *
+ * A filter keeps an event record class if its name is one of the names
+ * of the filter or if its ID is one of the IDs of the filter. An empty
+ * filter keeps all the event record classes.
+ *
+ * A filter is immutable once built: a component builds it once and
+ * shares it with all its message iterators (see `SP`).
+ */
+class EventRecordClsFilter final
+{
+public:
+    using SP = std::shared_ptr<const EventRecordClsFilter>;
+
+    /*
+     * Builds an empty filter, which keeps all the event record classes.
+     */
+    explicit EventRecordClsFilter() = default;
+
+    /*
+     * Builds a filter which keeps the event record classes named one of
+     * `names` or having one of the IDs `ids`.
+     */
+    explicit EventRecordClsFilter(std::unordered_set<std::string> names,
+                                  std::unordered_set<unsigned long long> ids) noexcept;
+
+    /*
+     * Builds a filter from the optional `event-record-class-names`
+     * (array of strings) and `event-record-class-ids` (array of
+     * non-negative signed integers) parameters of `params`, already
+     * validated as such, except for the sign of the IDs.
+     *
+     * Appends a cause to the error of the current thread and throws
+     * `bt2c::Error` on error.
+     */
+    static EventRecordClsFilter fromParams(bt2::ConstMapValue params, const bt2c::Logger& logger);
+
+    /*
+     * Whether or not this filter keeps all the event record classes.
+     */
+    bool isEmpty() const noexcept
+    {
+        return _mNames.empty() && _mIds.empty();
+    }
+
+    /*
+     * Whether or not this filter keeps the event record class
+     * `eventRecordCls`.
+     */
+    bool keeps(const EventRecordCls& eventRecordCls) const noexcept;
+
+private:
+    std::unordered_set<std::string> _mNames;
+    std::unordered_set<unsigned long long> _mIds;
+};
+
+} /* namespace src */
+} /* namespace ctf */
+
+#endif /* BABELTRACE_PLUGINS_CTF_COMMON_SRC_EVENT_RECORD_CLS_FILTER_HPP */
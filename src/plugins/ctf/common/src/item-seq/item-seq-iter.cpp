@@ -479,6 +479,18 @@ ItemSeqIter::_StateHandlingReaction ItemSeqIter::_handleTryBeginReadEventRecordP
         return _StateHandlingReaction::Continue;
     }
 
+    BT_ASSERT_DBG(_mItems.eventRecordInfo._mCls);
+
+    if (_mItems.eventRecordInfo._mCls->payloadFixedLayout()) {
+        /* Update for user */
+        _mItems.scopeBegin._mScope = Scope::EventRecordPayload;
+        this->_updateForUser(_mItems.scopeBegin);
+
+        /* Next: try reading the whole payload structure field at once */
+        this->_state(_State::ReadFixedLayoutStructField);
+        return _StateHandlingReaction::Stop;
+    }
+
     return this->_handleCommonBeginReadScopeState(Scope::EventRecordPayload);
 }
 
@@ -702,6 +714,54 @@ ItemSeqIter::_StateHandlingReaction ItemSeqIter::_handleEndReadStructFieldState(
     return this->_handleCommonEndReadCompoundFieldState(_mItems.structFieldEnd);
 }
 
+ItemSeqIter::_StateHandlingReaction ItemSeqIter::_handleReadFixedLayoutStructFieldState()
+{
+    BT_ASSERT_DBG(_mCurScope.fc);
+    BT_ASSERT_DBG(_mItems.eventRecordInfo._mCls);
+
+    auto& structFc = *_mCurScope.fc;
+    auto& layout = *_mItems.eventRecordInfo._mCls->payloadFixedLayout();
+
+    /* Align head for structure field */
+    this->_alignHead(structFc);
+
+    /*
+     * Decoding the structure field at once requires all its data to be
+     * within the current buffer: otherwise, read it field by field.
+     */
+    if (layout.len > this->_remainingBufLen() || layout.len > this->_remainingPktContentLen()) {
+        CTF_SRC_ITEM_SEQ_ITER_CPPLOGT("Not enough buffered data to read fixed-layout structure "
+                                      "field at once: len-bits={}, remaining-buf-len-bits={}",
+                                      *layout.len, *this->_remainingBufLen());
+        this->_prepareToReadStructField(structFc);
+        return _StateHandlingReaction::Continue;
+    }
+
+    /* Decode all the member fields */
+    auto& item = _mItems.fixedLayoutStructField;
+    const auto structBuf = this->_bufAtHead();
+
+    item._mLayout = &layout;
+    item._mVals.resize(layout.members.size());
+
+    for (std::size_t i = 0; i < layout.members.size(); ++i) {
+        item._mVals[i] = this->_readFixedLayoutMemberVal(structBuf, layout.members[i]);
+    }
+
+    /* Set last fixed-length bit array field byte order */
+    _mLastFixedLenBitArrayFieldByteOrder = layout.members.back().byteOrder;
+
+    /* Update for user */
+    this->_setFieldItemFcAndUpdateForUser(item, structFc);
+
+    /* Mark the structure field as consumed */
+    this->_consumeAvailData(layout.len);
+
+    /* Next: end reading the scope */
+    this->_prepareToReadNextField();
+    return _StateHandlingReaction::Stop;
+}
+
 ItemSeqIter::_StateHandlingReaction
 ItemSeqIter::_handleCommonBeginReadArrayFieldState(const unsigned long long len,
                                                    const ArrayFc& arrayFc)
@@ -925,7 +985,7 @@ void ItemSeqIter::_handleCommonReadRawDataNoNextState()
     }
 
     /* Update for user */
-    _mItems.rawData._assign(begin, end);
+    _mItems.rawData._assign(begin, end, _mBuf.dataOwner());
     BT_ASSERT_DBG(len >= 1_bytes);
     this->_updateForUser(_mItems.rawData);
 
@@ -326,7 +326,10 @@ struct VarLenIntFieldVal<bt2c::Signedness::Signed> final
  *       ]
  *       [
  *         ScopeBeginItem<Scope::EventRecordPayload>
- *         StructFieldBeginItem FIELD* StructFieldEndItem
+ *         (
+ *           (StructFieldBeginItem FIELD* StructFieldEndItem) |
+ *           FixedLayoutStructFieldItem
+ *         )
  *         ScopeEndItem<Scope::EventRecordPayload>
  *       ]
  *       EventRecordEndItem
@@ -335,6 +338,11 @@ struct VarLenIntFieldVal<bt2c::Signedness::Signed> final
  * Note how an `EventRecordInfoItem` always exists, whether or not
  * there's an event record header field.
  *
+ * A single `FixedLayoutStructFieldItem` replaces the items of the whole
+ * event record payload structure field when its class has a fixed
+ * layout (see EventRecordCls::payloadFixedLayout()) and the current
+ * buffer contains all its data.
+ *
  * PACKET group
  * ────────────
  *     (
@@ -595,6 +603,7 @@ struct VarLenIntFieldVal<bt2c::Signedness::Signed> final
  *         TryBeginReadCommonEventRecordCtxScope [fillcolor = "#f39c12", fontcolor = white]
  *         TryBeginReadEventRecordHeaderScope [fillcolor = "#f39c12", fontcolor = white]
  *         TryBeginReadEventRecordPayloadScope [fillcolor = "#f39c12", fontcolor = white]
+ *         ReadFixedLayoutStructField [fillcolor = "#8e44ad", fontcolor = white]
  *         TryBeginReadSpecEventRecordCtxScope [fillcolor = "#f39c12", fontcolor = white]
  *
  *         TryBeginReadEventRecord -> TryBeginReadEventRecordHeaderScope
@@ -615,6 +624,9 @@ struct VarLenIntFieldVal<bt2c::Signedness::Signed> final
  *         EndReadSpecEventRecordCtxScope -> TryBeginReadEventRecordPayloadScope
  *         TryBeginReadEventRecordPayloadScope -> EndReadEventRecord [label = "No field"]
  *         TryBeginReadEventRecordPayloadScope -> read_event_record_payload_struct_field
+ *         TryBeginReadEventRecordPayloadScope -> ReadFixedLayoutStructField [label = "Fixed layout"]
+ *         ReadFixedLayoutStructField -> read_event_record_payload_struct_field [label = "Not enough\nbuffered data"]
+ *         ReadFixedLayoutStructField -> EndReadEventRecordPayloadScope
  *         read_event_record_payload_struct_field -> EndReadEventRecordPayloadScope
  *         EndReadEventRecordPayloadScope -> EndReadEventRecord
  *         EndReadEventRecord -> TryBeginReadEventRecord
@@ -879,6 +891,7 @@ private:
         EndReadVariantFieldWithSIntSel,
         EndReadVariantFieldWithUIntSel,
         Init,
+        ReadFixedLayoutStructField,
         ReadFixedLenBitArrayFieldBa16Be,
         ReadFixedLenBitArrayFieldBa16BeRev,
         ReadFixedLenBitArrayFieldBa16Le,
@@ -2490,6 +2503,8 @@ private:
             return this->_handleBeginReadStructFieldState();
         case _State::EndReadStructField:
             return this->_handleEndReadStructFieldState();
+        case _State::ReadFixedLayoutStructField:
+            return this->_handleReadFixedLayoutStructFieldState();
         case _State::BeginReadStaticLenArrayField:
             return this->_handleBeginReadStaticLenArrayFieldState();
         case _State::BeginReadStaticLenArrayFieldMetadataStreamUuid:
@@ -3015,6 +3030,7 @@ private:
     _StateHandlingReaction _handleSetPktInfoItemState();
     _StateHandlingReaction _handleSetEventRecordInfoItemState();
     _StateHandlingReaction _handleBeginReadStructFieldState();
+    _StateHandlingReaction _handleReadFixedLayoutStructFieldState();
     _StateHandlingReaction _handleEndReadStructFieldState();
     _StateHandlingReaction _handleBeginReadStaticLenArrayFieldState();
     _StateHandlingReaction _handleBeginReadStaticLenArrayFieldMetadataStreamUuidState();
@@ -3352,7 +3368,7 @@ private:
         }
 
         /* Update for user */
-        _mItems.rawData._assign(begin, end);
+        _mItems.rawData._assign(begin, end, _mBuf.dataOwner());
         BT_ASSERT_DBG(_mItems.rawData.len() >= 1_bytes);
         this->_updateForUser(_mItems.rawData);
 
@@ -3529,6 +3545,58 @@ private:
         return val;
     }
 
+    /*
+     * Reads the value of a `LenBitsV`-bit fixed-length integer field
+     * having the byte order `byteOrder` at `addr`.
+     */
+    template <std::size_t LenBitsV, bt2c::Signedness SignednessV>
+    static unsigned long long _readFixedLayoutMemberVal(const std::uint8_t * const addr,
+                                                        const ByteOrder byteOrder) noexcept
+    {
+        using IntT = bt2c::StdIntT<LenBitsV, SignednessV>;
+
+        return static_cast<unsigned long long>(byteOrder == ByteOrder::Big ?
+                                                   bt2c::readFixedLenIntBe<IntT>(addr) :
+                                                   bt2c::readFixedLenIntLe<IntT>(addr));
+    }
+
+    template <bt2c::Signedness SignednessV>
+    static unsigned long long _readFixedLayoutMemberVal(const std::uint8_t * const addr,
+                                                        const FixedLayout::Member& member) noexcept
+    {
+        switch (*member.len) {
+        case 8:
+            return _readFixedLayoutMemberVal<8, SignednessV>(addr, member.byteOrder);
+        case 16:
+            return _readFixedLayoutMemberVal<16, SignednessV>(addr, member.byteOrder);
+        case 32:
+            return _readFixedLayoutMemberVal<32, SignednessV>(addr, member.byteOrder);
+        case 64:
+            return _readFixedLayoutMemberVal<64, SignednessV>(addr, member.byteOrder);
+        default:
+            bt_common_abort();
+        }
+    }
+
+    /*
+     * Reads the value of the member field `member` of a fixed-layout
+     * structure field of which the data starts at `structBuf`.
+     *
+     * See `FixedLayoutStructFieldItem` to learn how to interpret the
+     * returned value.
+     */
+    static unsigned long long _readFixedLayoutMemberVal(const std::uint8_t * const structBuf,
+                                                        const FixedLayout::Member& member) noexcept
+    {
+        const auto addr = structBuf + member.offset.bytes();
+
+        if (member.signedness == bt2c::Signedness::Signed) {
+            return _readFixedLayoutMemberVal<bt2c::Signedness::Signed>(addr, member);
+        } else {
+            return _readFixedLayoutMemberVal<bt2c::Signedness::Unsigned>(addr, member);
+        }
+    }
+
     /*
      * Common fixed-length integer field state handler using `item`.
      *
@@ -4177,6 +4245,7 @@ private:
         DynLenBlobFieldEndItem dynLenBlobFieldEnd;
         StructFieldBeginItem structFieldBegin;
         StructFieldEndItem structFieldEnd;
+        FixedLayoutStructFieldItem fixedLayoutStructField;
         VariantFieldWithSIntSelBeginItem variantFieldWithSIntSelBegin;
         VariantFieldWithSIntSelEndItem variantFieldWithSIntSelEnd;
         VariantFieldWithUIntSelBeginItem variantFieldWithUIntSelBegin;
@@ -254,6 +254,11 @@ void ItemVisitor::visit(const StructFieldEndItem& item)
     this->visit(static_cast<const EndItem&>(item));
 }
 
+void ItemVisitor::visit(const FixedLayoutStructFieldItem& item)
+{
+    this->visit(static_cast<const Item&>(item));
+}
+
 void ItemVisitor::visit(const VariantFieldBeginItem& item)
 {
     this->visit(static_cast<const BeginItem&>(item));
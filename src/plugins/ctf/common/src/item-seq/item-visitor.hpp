@@ -27,6 +27,7 @@ class EndItem;
 class EventRecordBeginItem;
 class EventRecordEndItem;
 class EventRecordInfoItem;
+class FixedLayoutStructFieldItem;
 class FixedLenBitArrayFieldItem;
 class FixedLenBitMapFieldItem;
 class FixedLenBoolFieldItem;
@@ -98,6 +99,7 @@ public:
     virtual void visit(const EventRecordBeginItem&);
     virtual void visit(const EventRecordEndItem&);
     virtual void visit(const EventRecordInfoItem&);
+    virtual void visit(const FixedLayoutStructFieldItem&);
     virtual void visit(const FixedLenBitArrayFieldItem&);
     virtual void visit(const FixedLenBitMapFieldItem&);
     virtual void visit(const FixedLenBoolFieldItem&);
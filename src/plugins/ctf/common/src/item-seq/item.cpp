@@ -427,6 +427,16 @@ void StructFieldEndItem::accept(ItemVisitor& visitor) const
     visitor.visit(*this);
 }
 
+FixedLayoutStructFieldItem::FixedLayoutStructFieldItem() noexcept :
+    Item {Type::FixedLayoutStructField}
+{
+}
+
+void FixedLayoutStructFieldItem::accept(ItemVisitor& visitor) const
+{
+    visitor.visit(*this);
+}
+
 VariantFieldBeginItem::VariantFieldBeginItem(const Type type) noexcept : BeginItem {type}
 {
 }
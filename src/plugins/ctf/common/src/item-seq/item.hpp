@@ -8,6 +8,8 @@
 #define BABELTRACE_PLUGINS_CTF_COMMON_SRC_ITEM_SEQ_ITEM_HPP
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "common/assert.h"
 #include "cpp-common/bt2c/aliases.hpp"
@@ -69,6 +71,7 @@ private:
             IntSel                      = 1ULL << 28,
             BoolSel                     = 1ULL << 29,
             OptionalField               = 1ULL << 30,
+            FixedLayoutStructField      = 1ULL << 31,
         };
     };
 
@@ -183,6 +186,9 @@ public:
         (StructFieldEnd,                    _TypeTraits::StructField |
                                             _TypeTraits::End),
 
+        /* `FixedLayoutStructFieldItem` */
+        (FixedLayoutStructField,            _TypeTraits::FixedLayoutStructField),
+
         /* `StaticLenArrayFieldBeginItem` */
         (StaticLenArrayFieldBegin,          _TypeTraits::StaticLenField |
                                             _TypeTraits::ArrayField |
@@ -646,6 +652,14 @@ public:
         return _mType == Type::StructFieldEnd;
     }
 
+    /*
+     * True if this item is a fixed-layout structure field item.
+     */
+    bool isFixedLayoutStructField() const noexcept
+    {
+        return _mType == Type::FixedLayoutStructField;
+    }
+
     /*
      * True if this item is an array field beginning/end item.
      */
@@ -1295,6 +1309,11 @@ public:
      */
     const StructFieldEndItem& asStructFieldEnd() const noexcept;
 
+    /*
+     * Returns this item as a fixed-layout structure field item.
+     */
+    const FixedLayoutStructFieldItem& asFixedLayoutStructField() const noexcept;
+
     /*
      * Returns this item as a metadata stream Uuid item.
      */
@@ -2274,15 +2293,34 @@ public:
         return bt2c::DataLen::fromBytes(_mData.size());
     }
 
+    /*
+     * Owner of the raw data of this item, or `nullptr` if the raw data
+     * is only valid until the next item.
+     *
+     * Keeping a copy of the returned shared pointer keeps the raw data
+     * of this item valid (see Buf::dataOwner()).
+     */
+    const std::shared_ptr<const void>& dataOwner() const noexcept
+    {
+        return _mDataOwner;
+    }
+
     void accept(ItemVisitor& visitor) const override;
 
 private:
-    void _assign(const std::uint8_t * const begin, const std::uint8_t * const end) noexcept
+    void _assign(const std::uint8_t * const begin, const std::uint8_t * const end,
+                 const std::shared_ptr<const void>& dataOwner) noexcept
     {
         _mData = bt2c::ConstBytes {begin, end};
+
+        /* Only update the owner (atomic reference count) on change */
+        if (_mDataOwner != dataOwner) {
+            _mDataOwner = dataOwner;
+        }
     }
 
     bt2c::ConstBytes _mData;
+    std::shared_ptr<const void> _mDataOwner;
 };
 
 /*
@@ -2739,6 +2777,62 @@ public:
     void accept(ItemVisitor& visitor) const override;
 };
 
+/*
+ * Fixed-layout structure field item.
+ *
+ * This item replaces a whole `StructFieldBeginItem`, member field
+ * items, `StructFieldEndItem` subsequence when the item sequence
+ * iterator decodes a structure field of which the class has a fixed
+ * layout (see `FixedLayout`) at once.
+ *
+ * vals()[i] is the decoded value of the member field of which the
+ * class is `layout().members[i].fc`:
+ *
+ * Fixed-length signed integer field:
+ *     Two's complement value (cast it to `long long`).
+ *
+ * Fixed-length floating point number field:
+ *     IEEE 754 binary32 or binary64 bits.
+ *
+ * Any other field:
+ *     Unsigned integer value.
+ */
+class FixedLayoutStructFieldItem final : public Item, public FieldItem
+{
+    friend class ItemSeqIter;
+
+private:
+    explicit FixedLayoutStructFieldItem() noexcept;
+
+public:
+    const StructFc& cls() const noexcept
+    {
+        return FieldItem::cls().asStruct();
+    }
+
+    /*
+     * Fixed layout of the class of this structure field.
+     */
+    const FixedLayout& layout() const noexcept
+    {
+        return *_mLayout;
+    }
+
+    /*
+     * Decoded member field values (as many as `layout().members`).
+     */
+    const std::vector<unsigned long long>& vals() const noexcept
+    {
+        return _mVals;
+    }
+
+    void accept(ItemVisitor& visitor) const override;
+
+private:
+    const FixedLayout *_mLayout = nullptr;
+    std::vector<unsigned long long> _mVals;
+};
+
 /*
  * Abstract variant field beginning item base class.
  */
@@ -3415,6 +3509,11 @@ inline const StructFieldEndItem& Item::asStructFieldEnd() const noexcept
     return static_cast<const StructFieldEndItem&>(*this);
 }
 
+inline const FixedLayoutStructFieldItem& Item::asFixedLayoutStructField() const noexcept
+{
+    return static_cast<const FixedLayoutStructFieldItem&>(*this);
+}
+
 inline const MetadataStreamUuidItem& Item::asMetadataStreamUuid() const noexcept
 {
     return static_cast<const MetadataStreamUuidItem&>(*this);
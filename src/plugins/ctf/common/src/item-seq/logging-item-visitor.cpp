@@ -463,6 +463,16 @@ void LoggingItemVisitor::visit(const StructFieldBeginItem& item)
     this->_log(item, ss);
 }
 
+void LoggingItemVisitor::visit(const FixedLayoutStructFieldItem& item)
+{
+    std::ostringstream ss;
+
+    appendItemMinAlignField(ss, item);
+    appendField(ss, "member-count", item.cls().size());
+    appendDataLenBitsField(ss, item.layout().len);
+    this->_log(item, ss);
+}
+
 namespace {
 
 void appendVariantFieldBeginItemSelOptIndexField(std::ostringstream& ss,
@@ -56,6 +56,7 @@ public:
     void visit(const DynLenBlobFieldBeginItem&) override;
     void visit(const DynLenStrFieldBeginItem&) override;
     void visit(const EventRecordInfoItem&) override;
+    void visit(const FixedLayoutStructFieldItem&) override;
     void visit(const FixedLenBitArrayFieldItem&) override;
     void visit(const FixedLenBoolFieldItem&) override;
     void visit(const FixedLenFloatFieldItem&) override;
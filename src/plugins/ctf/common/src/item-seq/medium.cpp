@@ -17,11 +17,19 @@ Buf::Buf(const std::uint8_t * const addr, const bt2c::DataLen size) noexcept :
     BT_ASSERT_DBG(!size.hasExtraBits());
 }
 
+Buf::Buf(const std::uint8_t * const addr, const bt2c::DataLen size,
+         std::shared_ptr<const void> dataOwner) noexcept :
+    _mAddr {addr},
+    _mSize {size}, _mDataOwner {std::move(dataOwner)}
+{
+    BT_ASSERT_DBG(!size.hasExtraBits());
+}
+
 Buf Buf::slice(const bt2c::DataLen offset) const noexcept
 {
     BT_ASSERT_DBG(offset <= _mSize);
     BT_ASSERT_DBG(!offset.hasExtraBits());
-    return Buf {_mAddr + offset.bytes(), _mSize - offset};
+    return Buf {_mAddr + offset.bytes(), _mSize - offset, _mDataOwner};
 }
 
 } /* namespace src */
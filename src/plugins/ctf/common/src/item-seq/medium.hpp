@@ -16,7 +16,7 @@ namespace ctf {
 namespace src {
 
 /*
- * Data buffer: address and size.
+ * Data buffer: address, size, and optional data owner.
  */
 class Buf final
 {
@@ -40,6 +40,19 @@ public:
      */
     explicit Buf(const std::uint8_t *addr, bt2c::DataLen size) noexcept;
 
+    /*
+     * Builds a buffer at the address `addr` and having the size `size`,
+     * the bytes at `addr` remaining valid as long as some shared
+     * pointer to `dataOwner` exists.
+     *
+     * This makes it possible for a user of the buffer to borrow its
+     * bytes beyond the next call to Medium::buf() (see `dataOwner()`).
+     *
+     * Same preconditions as the constructor above.
+     */
+    explicit Buf(const std::uint8_t *addr, bt2c::DataLen size,
+                 std::shared_ptr<const void> dataOwner) noexcept;
+
     /*
      * Address of this buffer.
      *
@@ -68,9 +81,22 @@ public:
      */
     Buf slice(bt2c::DataLen offset) const noexcept;
 
+    /*
+     * Owner of the data of this buffer, or `nullptr` if the bytes are
+     * only valid until the next call to Medium::buf().
+     *
+     * Keeping a copy of the returned shared pointer keeps the bytes of
+     * this buffer valid.
+     */
+    const std::shared_ptr<const void>& dataOwner() const noexcept
+    {
+        return _mDataOwner;
+    }
+
 private:
     const std::uint8_t *_mAddr = nullptr;
     bt2c::DataLen _mSize = bt2c::DataLen::fromBits(0);
+    std::shared_ptr<const void> _mDataOwner;
 };
 
 class NoData final : public std::exception
@@ -106,7 +132,8 @@ public:
      *
      * The returned buffer is to be read only and borrowed: it remains
      * owned by this medium. Calling this method invalidates the
-     * previously returned buffer by the same medium.
+     * previously returned buffer by the same medium, unless said
+     * buffer has a data owner (see Buf::dataOwner()).
      *
      * `offset.hasExtraBits()` must be false.
      *
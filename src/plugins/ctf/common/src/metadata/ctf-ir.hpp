@@ -13,6 +13,7 @@
 
 #include "cpp-common/bt2/trace-ir.hpp"
 #include "cpp-common/bt2c/observable.hpp"
+#include "cpp-common/bt2c/std-int.hpp"
 #include "cpp-common/bt2c/text-loc.hpp"
 #include "cpp-common/vendor/wise-enum/wise_enum.h"
 
@@ -383,6 +384,47 @@ struct CtfIrMixins;
  */
 using FcSet = std::set<ir::Fc<internal::CtfIrMixins> *>;
 
+/*
+ * Fixed layout of a structure field class.
+ *
+ * A structure field class has a fixed layout when all its member
+ * classes are byte-aligned 8-bit, 16-bit, 32-bit, or 64-bit
+ * fixed-length bit array, bit map, boolean, integer, or floating point
+ * number field classes having a natural bit order, no role, and no key
+ * value saving index.
+ *
+ * The offset of each member field from the beginning of such a
+ * structure field is then constant, so that a data stream decoder may
+ * decode all the member fields at once instead of going through its
+ * regular, per-field state machine.
+ */
+struct FixedLayout final
+{
+    struct Member final
+    {
+        /* Class of the member field */
+        const ir::Fc<internal::CtfIrMixins> *fc;
+
+        /* Offset of the member field within the structure field */
+        bt2c::DataLen offset;
+
+        /* Length of the member field (8, 16, 32, or 64 bits) */
+        bt2c::DataLen len;
+
+        /* Byte order of the member field */
+        ir::ByteOrder byteOrder;
+
+        /* Signedness of the decoded value */
+        bt2c::Signedness signedness;
+    };
+
+    /* Members, in structure field class order */
+    std::vector<Member> members;
+
+    /* Length of a structure field */
+    bt2c::DataLen len = bt2c::DataLen::fromBits(0);
+};
+
 namespace internal {
 
 /*
@@ -716,6 +758,36 @@ private:
     FcSet _mKeyFcs;
 };
 
+/*
+ * Event record class user mixin.
+ */
+class EventRecordClsMixin
+{
+public:
+    explicit EventRecordClsMixin() noexcept = default;
+
+    /*
+     * Fixed layout of the payload field class, if it has one.
+     */
+    const bt2s::optional<FixedLayout>& payloadFixedLayout() const noexcept
+    {
+        return _mPayloadFixedLayout;
+    }
+
+    /*
+     * Sets the fixed layout of the payload field class to
+     * `payloadFixedLayout`.
+     */
+    void payloadFixedLayout(FixedLayout payloadFixedLayout)
+    {
+        _mPayloadFixedLayout = std::move(payloadFixedLayout);
+    }
+
+private:
+    /* Fixed layout of the payload field class, if any */
+    bt2s::optional<FixedLayout> _mPayloadFixedLayout;
+};
+
 /*
  * Trace class user mixin.
  */
@@ -799,6 +871,7 @@ struct CtfIrMixins final : public ir::DefUserMixins
     using DynLenArrayFc = DependentFcMixin;
     using VariantFc = DependentFcMixin;
     using OptionalFc = DependentFcMixin;
+    using EventRecordCls = EventRecordClsMixin;
     using TraceCls = TraceClsMixin;
 };
 
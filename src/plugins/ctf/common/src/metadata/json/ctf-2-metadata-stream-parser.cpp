@@ -30,8 +30,8 @@ namespace src {
 
 Ctf2MetadataStreamParser::Ctf2MetadataStreamParser(
     const bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp, const ClkClsCfg& clkClsCfg,
-    const bt2c::Logger& parentLogger) :
-    MetadataStreamParser {selfComp, clkClsCfg},
+    const bt2c::Logger& parentLogger, const bool skipEventRecordFields) :
+    MetadataStreamParser {selfComp, clkClsCfg, skipEventRecordFields},
     _mLogger {parentLogger, "PLUGIN/CTF/CTF-2-META-STREAM-PARSER"}, _mFragmentValReq {_mLogger},
     _mDefClkOffsetVal {bt2c::call([] {
         bt2c::JsonObjVal::Container entries;
@@ -49,9 +49,10 @@ Ctf2MetadataStreamParser::Ctf2MetadataStreamParser(
 MetadataStreamParser::ParseRet
 Ctf2MetadataStreamParser::parse(const bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
                                 const ClkClsCfg& clkClsCfg, const bt2c::ConstBytes buffer,
-                                const bt2c::Logger& parentLogger)
+                                const bt2c::Logger& parentLogger,
+                                const bool skipEventRecordFields)
 {
-    Ctf2MetadataStreamParser parser {selfComp, clkClsCfg, parentLogger};
+    Ctf2MetadataStreamParser parser {selfComp, clkClsCfg, parentLogger, skipEventRecordFields};
 
     parser.parseSection(buffer);
 
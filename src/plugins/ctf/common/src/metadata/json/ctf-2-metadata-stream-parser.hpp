@@ -39,7 +39,8 @@ public:
      * parseSection() to finalize the current trace class.
      */
     explicit Ctf2MetadataStreamParser(bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
-                                      const ClkClsCfg& clkClsCfg, const bt2c::Logger& parentLogger);
+                                      const ClkClsCfg& clkClsCfg, const bt2c::Logger& parentLogger,
+                                      bool skipEventRecordFields = false);
 
     /*
      * Parses the whole CTF 2 metadata stream in `buffer` and returns
@@ -49,7 +50,7 @@ public:
      */
     static ParseRet parse(bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
                           const ClkClsCfg& clkClsCfg, bt2c::ConstBytes buffer,
-                          const bt2c::Logger& parentLogger);
+                          const bt2c::Logger& parentLogger, bool skipEventRecordFields = false);
 
 private:
     void _parseSection(bt2c::ConstBytes buffer) override;
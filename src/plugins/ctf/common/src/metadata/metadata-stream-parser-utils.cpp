@@ -27,37 +27,43 @@ MetadataStreamMajorVersion getMetadataStreamMajorVersion(const bt2c::ConstBytes
 std::unique_ptr<MetadataStreamParser>
 createMetadataStreamParser(const MetadataStreamMajorVersion majorVersion,
                            const bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
-                           const ClkClsCfg& clkClsCfg, const bt2c::Logger& parentLogger)
+                           const ClkClsCfg& clkClsCfg, const bt2c::Logger& parentLogger,
+                           const bool skipEventRecordFields)
 {
     if (majorVersion == MetadataStreamMajorVersion::V1) {
-        return bt2s::make_unique<Ctf1MetadataStreamParser>(selfComp, clkClsCfg, parentLogger);
+        return bt2s::make_unique<Ctf1MetadataStreamParser>(selfComp, clkClsCfg, parentLogger,
+                                                          skipEventRecordFields);
     } else {
         BT_ASSERT(majorVersion == MetadataStreamMajorVersion::V2);
-        return bt2s::make_unique<Ctf2MetadataStreamParser>(selfComp, clkClsCfg, parentLogger);
+        return bt2s::make_unique<Ctf2MetadataStreamParser>(selfComp, clkClsCfg, parentLogger,
+                                                          skipEventRecordFields);
     }
 }
 
 std::unique_ptr<MetadataStreamParser>
 createMetadataStreamParser(const bt2c::ConstBytes buffer,
                            const bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
-                           const ClkClsCfg& clkClsCfg, const bt2c::Logger& parentLogger)
+                           const ClkClsCfg& clkClsCfg, const bt2c::Logger& parentLogger,
+                           const bool skipEventRecordFields)
 {
     return createMetadataStreamParser(getMetadataStreamMajorVersion(buffer), selfComp, clkClsCfg,
-                                      parentLogger);
+                                      parentLogger, skipEventRecordFields);
 }
 
 MetadataStreamParser::ParseRet
 parseMetadataStream(const bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
                     const ClkClsCfg& clkClsCfg, const bt2c::ConstBytes buffer,
-                    const bt2c::Logger& parentLogger)
+                    const bt2c::Logger& parentLogger, const bool skipEventRecordFields)
 {
     const auto majorVersion = getMetadataStreamMajorVersion(buffer);
 
     if (majorVersion == MetadataStreamMajorVersion::V1) {
-        return Ctf1MetadataStreamParser::parse(selfComp, clkClsCfg, buffer, parentLogger);
+        return Ctf1MetadataStreamParser::parse(selfComp, clkClsCfg, buffer, parentLogger,
+                                               skipEventRecordFields);
     } else {
         BT_ASSERT(majorVersion == MetadataStreamMajorVersion::V2);
-        return Ctf2MetadataStreamParser::parse(selfComp, clkClsCfg, buffer, parentLogger);
+        return Ctf2MetadataStreamParser::parse(selfComp, clkClsCfg, buffer, parentLogger,
+                                               skipEventRecordFields);
     }
 }
 
@@ -34,7 +34,8 @@ MetadataStreamMajorVersion getMetadataStreamMajorVersion(bt2c::ConstBytes buffer
 std::unique_ptr<MetadataStreamParser>
 createMetadataStreamParser(MetadataStreamMajorVersion majorVersion,
                            bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
-                           const ClkClsCfg& clkClsCfg, const bt2c::Logger& parentLogger);
+                           const ClkClsCfg& clkClsCfg, const bt2c::Logger& parentLogger,
+                           bool skipEventRecordFields = false);
 
 /*
  * Creates and returns a CTF metadata stream parser of which the
@@ -47,7 +48,8 @@ createMetadataStreamParser(MetadataStreamMajorVersion majorVersion,
 std::unique_ptr<MetadataStreamParser>
 createMetadataStreamParser(bt2c::ConstBytes buffer,
                            bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
-                           const ClkClsCfg& clkClsCfg, const bt2c::Logger& parentLogger);
+                           const ClkClsCfg& clkClsCfg, const bt2c::Logger& parentLogger,
+                           bool skipEventRecordFields = false);
 
 /*
  * Parses the metadata stream in `buffer` using a parser of which the
@@ -60,7 +62,7 @@ createMetadataStreamParser(bt2c::ConstBytes buffer,
 MetadataStreamParser::ParseRet
 parseMetadataStream(bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
                     const ClkClsCfg& clkClsCfg, bt2c::ConstBytes buffer,
-                    const bt2c::Logger& parentLogger);
+                    const bt2c::Logger& parentLogger, bool skipEventRecordFields = false);
 
 } /* namespace src */
 } /* namespace ctf */
@@ -7,6 +7,7 @@
 #include <cstring>
 
 #include "common/assert.h"
+#include "cpp-common/bt2c/align.hpp"
 #include "cpp-common/bt2c/call.hpp"
 
 #include "metadata-stream-parser.hpp"
@@ -494,6 +495,121 @@ void setSavedKeyValIndexes(TraceCls& traceCls)
     SavedKeyValIndexesSetter {traceCls};
 }
 
+/*
+ * Returns whether or not an instance of `fc` may be part of a
+ * structure field having a fixed layout (see `FixedLayout`).
+ */
+bool isFixedLayoutMemberFc(const Fc& fc) noexcept
+{
+    switch (fc.deepType()) {
+    case FcDeepType::FixedLenBitArrayBa8:
+    case FcDeepType::FixedLenBitArrayBa16Be:
+    case FcDeepType::FixedLenBitArrayBa32Be:
+    case FcDeepType::FixedLenBitArrayBa64Be:
+    case FcDeepType::FixedLenBitArrayBa16Le:
+    case FcDeepType::FixedLenBitArrayBa32Le:
+    case FcDeepType::FixedLenBitArrayBa64Le:
+    case FcDeepType::FixedLenBitMapBa8:
+    case FcDeepType::FixedLenBitMapBa16Be:
+    case FcDeepType::FixedLenBitMapBa32Be:
+    case FcDeepType::FixedLenBitMapBa64Be:
+    case FcDeepType::FixedLenBitMapBa16Le:
+    case FcDeepType::FixedLenBitMapBa32Le:
+    case FcDeepType::FixedLenBitMapBa64Le:
+    case FcDeepType::FixedLenBoolBa8:
+    case FcDeepType::FixedLenBoolBa16Be:
+    case FcDeepType::FixedLenBoolBa32Be:
+    case FcDeepType::FixedLenBoolBa64Be:
+    case FcDeepType::FixedLenBoolBa16Le:
+    case FcDeepType::FixedLenBoolBa32Le:
+    case FcDeepType::FixedLenBoolBa64Le:
+    case FcDeepType::FixedLenFloatBa32Be:
+    case FcDeepType::FixedLenFloatBa64Be:
+    case FcDeepType::FixedLenFloatBa32Le:
+    case FcDeepType::FixedLenFloatBa64Le:
+    case FcDeepType::FixedLenUIntBa8:
+    case FcDeepType::FixedLenUIntBa16Be:
+    case FcDeepType::FixedLenUIntBa32Be:
+    case FcDeepType::FixedLenUIntBa64Be:
+    case FcDeepType::FixedLenUIntBa16Le:
+    case FcDeepType::FixedLenUIntBa32Le:
+    case FcDeepType::FixedLenUIntBa64Le:
+    case FcDeepType::FixedLenSIntBa8:
+    case FcDeepType::FixedLenSIntBa16Be:
+    case FcDeepType::FixedLenSIntBa32Be:
+    case FcDeepType::FixedLenSIntBa64Be:
+    case FcDeepType::FixedLenSIntBa16Le:
+    case FcDeepType::FixedLenSIntBa32Le:
+    case FcDeepType::FixedLenSIntBa64Le:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/*
+ * Returns the fixed layout of `structFc`, or `bt2s::nullopt` if it
+ * doesn't have one.
+ */
+bt2s::optional<FixedLayout> fixedLayoutOfStructFc(const StructFc& structFc)
+{
+    if (structFc.isEmpty()) {
+        return bt2s::nullopt;
+    }
+
+    FixedLayout layout;
+    auto offset = 0_bits;
+
+    for (auto& memberCls : structFc) {
+        auto& fc = memberCls.fc();
+
+        if (!isFixedLayoutMemberFc(fc)) {
+            return bt2s::nullopt;
+        }
+
+        /*
+         * The alignment of `structFc` is at least the one of any of its
+         * member classes, therefore aligning relative to the beginning
+         * of the structure field is enough.
+         */
+        BT_ASSERT_DBG(fc.align() <= structFc.align());
+        offset = bt2c::DataLen::fromBits(bt2c::align(*offset, fc.align()));
+
+        auto& bitArrayFc = fc.asFixedLenBitArray();
+
+        layout.members.push_back(FixedLayout::Member {
+            &fc, offset, bitArrayFc.len(), bitArrayFc.byteOrder(),
+            fc.isFixedLenSInt() ? bt2c::Signedness::Signed : bt2c::Signedness::Unsigned});
+        offset += bitArrayFc.len();
+    }
+
+    layout.len = offset;
+    return layout;
+}
+
+/*
+ * Sets the payload fixed layout of each event record class of
+ * `traceCls` which doesn't have a libbabeltrace2 class yet and of which
+ * the payload field class has a fixed layout.
+ *
+ * Call this after setSavedKeyValIndexes() as the latter may make some
+ * payload member classes key field classes.
+ */
+void setPayloadFixedLayouts(TraceCls& traceCls)
+{
+    for (auto& dataStreamCls : traceCls) {
+        for (auto& eventRecordCls : *dataStreamCls) {
+            if (eventRecordCls->libCls() || !eventRecordCls->payloadFc()) {
+                continue;
+            }
+
+            if (auto layout = fixedLayoutOfStructFc(*eventRecordCls->payloadFc())) {
+                eventRecordCls->payloadFixedLayout(std::move(*layout));
+            }
+        }
+    }
+}
+
 /*
  * Visits a field class recursively to check whether or not it contains
  * an unsigned integer field class having a given role.
@@ -1605,9 +1721,11 @@ class LibTraceClsFromTraceClsTranslator final
 {
 public:
     explicit LibTraceClsFromTraceClsTranslator(TraceCls& traceCls,
-                                               const bt2::SelfComponent selfComp) :
+                                               const bt2::SelfComponent selfComp,
+                                               const bool skipEventRecordFields) :
         _mTraceCls {&traceCls},
-        _mSelfComp {selfComp}, _mMipVersion {selfComp.graphMipVersion()}
+        _mSelfComp {selfComp}, _mMipVersion {selfComp.graphMipVersion()},
+        _mSkipEventRecordFields {skipEventRecordFields}
     {
         /* Translate whole trace class */
         this->_translate();
@@ -1757,6 +1875,11 @@ private:
         /* Set user attributes */
         trySetLibUserAttrs(eventRecordCls);
 
+        if (_mSkipEventRecordFields) {
+            /* No event record fields */
+            return;
+        }
+
         /* Translate specific context field class, if any */
         if (eventRecordCls.specCtxFc()) {
             libEventRecordCls->specificContextFieldClass(
@@ -1919,7 +2042,7 @@ private:
             }
 
             /* Translate common event record context field class, if any */
-            if (dataStreamCls.commonEventRecordCtxFc()) {
+            if (dataStreamCls.commonEventRecordCtxFc() && !_mSkipEventRecordFields) {
                 libDataStreamCls->commonEventContextFieldClass(
                     *this->_translate(*dataStreamCls.commonEventRecordCtxFc()));
             }
@@ -1964,6 +2087,12 @@ private:
 
     /* Effective MIP version */
     unsigned long long _mMipVersion;
+
+    /*
+     * Whether or not to skip the event record field classes (event
+     * common context, specific context, and payload).
+     */
+    bool _mSkipEventRecordFields;
 };
 
 /*
@@ -2010,9 +2139,9 @@ const char * const MetadataStreamParser::logLevelDebugName = "debug";
 
 MetadataStreamParser::MetadataStreamParser(
     const bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
-    const ClkClsCfg& clkClsCfg) noexcept :
+    const ClkClsCfg& clkClsCfg, const bool skipEventRecordFields) noexcept :
     _mClkClsCfg(clkClsCfg),
-    _mSelfComp {selfComp}
+    _mSelfComp {selfComp}, _mSkipEventRecordFields {skipEventRecordFields}
 {
 }
 
@@ -2081,6 +2210,12 @@ void MetadataStreamParser::_finalizeTraceCls()
      */
     setSavedKeyValIndexes(*_mTraceCls);
 
+    /*
+     * Set the payload fixed layouts of event record classes so that
+     * data stream decoders may decode such payload fields at once.
+     */
+    setPayloadFixedLayouts(*_mTraceCls);
+
     /* Adjust clock classes, if needed */
     for (const auto& dataStreamCls : *_mTraceCls) {
         const auto clkCls = dataStreamCls->defClkCls();
@@ -2105,7 +2240,7 @@ void MetadataStreamParser::_finalizeTraceCls()
 
     /* Translates CTF IR objects to their trace IR equivalents */
     if (_mSelfComp) {
-        LibTraceClsFromTraceClsTranslator {*_mTraceCls, *_mSelfComp};
+        LibTraceClsFromTraceClsTranslator {*_mTraceCls, *_mSelfComp, _mSkipEventRecordFields};
     }
 }
 
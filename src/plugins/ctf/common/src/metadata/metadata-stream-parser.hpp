@@ -46,8 +46,15 @@ public:
     };
 
 protected:
+    /*
+     * If `skipEventRecordFields` is true, then the translated trace IR
+     * stream and event classes have no event common context, specific
+     * context, and payload field classes: a message iterator then
+     * fast-forwards those scopes instead of creating fields.
+     */
     explicit MetadataStreamParser(bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
-                                  const ClkClsCfg& clkClsCfg) noexcept;
+                                  const ClkClsCfg& clkClsCfg,
+                                  bool skipEventRecordFields) noexcept;
 
 public:
     virtual ~MetadataStreamParser() = default;
@@ -130,7 +137,8 @@ private:
      *   that the cycle part is less than the frequency.
      *
      * • If `_mSelfComp` exists, then translates the contained objects
-     *   to their trace IR equivalents.
+     *   to their trace IR equivalents, without the event record field
+     *   classes if `_mSkipEventRecordFields` is true.
      */
     void _finalizeTraceCls();
 
@@ -163,6 +171,12 @@ private:
 
     /* Self component, used to finalize `*_mTraceCls` */
     bt2::OptionalBorrowedObject<bt2::SelfComponent> _mSelfComp;
+
+    /*
+     * Whether or not to skip the event record field classes when
+     * translating `*_mTraceCls`.
+     */
+    bool _mSkipEventRecordFields;
 };
 
 } /* namespace src */
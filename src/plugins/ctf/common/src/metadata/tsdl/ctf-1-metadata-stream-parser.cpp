@@ -691,8 +691,8 @@ void Ctf1MetadataStreamParser::_tryTranslateEventRecordCls(ctf_event_class& orig
 
 Ctf1MetadataStreamParser::Ctf1MetadataStreamParser(
     const bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp, const ClkClsCfg& clkClsCfg,
-    const bt2c::Logger& parentLogger) :
-    MetadataStreamParser {selfComp, clkClsCfg},
+    const bt2c::Logger& parentLogger, const bool skipEventRecordFields) :
+    MetadataStreamParser {selfComp, clkClsCfg, skipEventRecordFields},
     _mLogger {parentLogger, "PLUGIN/CTF/CTF-1-META-STREAM-PARSER"},
     _mOrigCtfIrGenerator {ctf_visitor_generate_ir_create(_mLogger)},
     _mScanner {ctf_scanner_alloc(_mLogger)}, _mStreamDecoder {_mLogger}
@@ -702,9 +702,10 @@ Ctf1MetadataStreamParser::Ctf1MetadataStreamParser(
 MetadataStreamParser::ParseRet
 Ctf1MetadataStreamParser::parse(const bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
                                 const ClkClsCfg& clkClsCfg, const bt2c::ConstBytes buffer,
-                                const bt2c::Logger& parentLogger)
+                                const bt2c::Logger& parentLogger,
+                                const bool skipEventRecordFields)
 {
-    Ctf1MetadataStreamParser parser {selfComp, clkClsCfg, parentLogger};
+    Ctf1MetadataStreamParser parser {selfComp, clkClsCfg, parentLogger, skipEventRecordFields};
 
     parser.parseSection(buffer);
     return {parser.releaseTraceCls(), parser.metadataStreamUuid(), MetadataStreamMajorVersion::V1};
@@ -104,7 +104,8 @@ public:
      * parseSection() to finalize its current trace class.
      */
     explicit Ctf1MetadataStreamParser(bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
-                                      const ClkClsCfg& clkClsCfg, const bt2c::Logger& parentLogger);
+                                      const ClkClsCfg& clkClsCfg, const bt2c::Logger& parentLogger,
+                                      bool skipEventRecordFields = false);
 
     /*
      * Parses the whole packetized or plain text CTF 1 metadata stream
@@ -114,7 +115,7 @@ public:
      */
     static ParseRet parse(bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
                           const ClkClsCfg& clkClsCfg, bt2c::ConstBytes buffer,
-                          const bt2c::Logger& parentLogger);
+                          const bt2c::Logger& parentLogger, bool skipEventRecordFields = false);
 
 private:
     void _parseSection(bt2c::ConstBytes buffer) override;
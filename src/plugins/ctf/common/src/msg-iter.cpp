@@ -6,6 +6,7 @@
  */
 
 #include <algorithm>
+#include <cstring>
 
 #include "common/assert.h"
 #include "common/common.h"
@@ -25,13 +26,38 @@ namespace src {
 
 using namespace bt2c::literals::datalen;
 
+namespace {
+
+/*
+ * Minimum length (bytes) of the data of a string or BLOB field to make
+ * said field borrow the raw data of an item instead of copying it:
+ * below this, copying is cheaper than sharing the ownership of the
+ * raw data.
+ */
+constexpr std::size_t minBorrowedDataLen = 256;
+
+/*
+ * Releases the data which a string or BLOB field borrowed, `userData`
+ * being a heap-allocated shared pointer to the owner of said data.
+ */
+void releaseBorrowedData(void * const userData) noexcept
+{
+    delete static_cast<std::shared_ptr<const void> *>(userData);
+}
+
+} /* namespace */
+
 MsgIter::MsgIter(const bt2::SelfMessageIterator selfMsgIter, const ctf::src::TraceCls& traceCls,
                  bt2s::optional<bt2c::Uuid> expectedMetadataStreamUuid, const bt2::Stream stream,
-                 Medium::UP medium, const MsgIterQuirks& quirks, const bt2c::Logger& parentLogger) :
+                 Medium::UP medium, const MsgIterQuirks& quirks, const bt2c::Logger& parentLogger,
+                 RecordedPktProvider::UP recordedPktProvider,
+                 EventRecordClsFilter::SP eventRecordClsFilter) :
     _mLogger {parentLogger, "PLUGIN/CTF/MSG-ITER"},
     _mSelfMsgIter {selfMsgIter}, _mStream {stream},
     _mExpectedMetadataStreamUuid {std::move(expectedMetadataStreamUuid)}, _mQuirks {quirks},
-    _mItemSeqIter {std::move(medium), traceCls, _mLogger}, _mUnicodeConv {_mLogger},
+    _mItemSeqIter {std::move(medium), traceCls, _mLogger},
+    _mRecordedPktProvider {std::move(recordedPktProvider)},
+    _mEventRecordClsFilter {std::move(eventRecordClsFilter)}, _mUnicodeConv {_mLogger},
     _mLoggingVisitor {"Handling item", _mLogger}
 {
     BT_CPPLOGD("Created CTF plugin message iterator: "
@@ -58,11 +84,17 @@ bt2::ConstMessage::Shared MsgIter::next()
 
     try {
         while (true) {
-            /*
-             * Get the next item from the underlying item
-             * sequence iterator.
-             */
-            if (const auto item = _mItemSeqIter.next()) {
+            /* Get the next item */
+            if (const auto item = this->_nextItem()) {
+                if (_mSkipItemsUntilEventRecordEndItem) {
+                    /* Filtered out event record: skip its items */
+                    if (item->isEventRecordEnd()) {
+                        _mSkipItemsUntilEventRecordEndItem = false;
+                    }
+
+                    continue;
+                }
+
                 /* Handle item if needed */
                 if (!_mSkipItemsUntilScopeEndItem || item->isScopeEnd()) {
                     this->_handleItem(*item);
@@ -86,6 +118,44 @@ bt2::ConstMessage::Shared MsgIter::next()
     }
 }
 
+const Item *MsgIter::_nextItem()
+{
+    if (_mRecordedPkt) {
+        if (_mRecordedPktItemIt != _mRecordedPkt->items().end()) {
+            return (_mRecordedPktItemIt++)->get();
+        }
+
+        /* Done with this recorded packet */
+        _mRecordedPkt.reset();
+    }
+
+    if (_mRecordedPktProvider && _mAtPktBegin) {
+        _mAtPktBegin = false;
+        _mRecordedPkt = _mRecordedPktProvider->take(_mLastPktEndOffset,
+                                                    _mSelfMsgIter.autoSeekNsFromOrigin());
+
+        if (_mRecordedPkt) {
+            BT_CPPLOGD("Handling recorded packet: pkt-offset-bytes={}, item-count={}",
+                       _mLastPktEndOffset.bytes(), _mRecordedPkt->items().size());
+
+            /*
+             * Make the underlying item sequence iterator skip this
+             * packet.
+             */
+            _mItemSeqIter.seekPkt(_mRecordedPkt->endOffset());
+
+            BT_ASSERT_DBG(!_mRecordedPkt->items().empty());
+            _mRecordedPktItemIt = _mRecordedPkt->items().begin();
+            return (_mRecordedPktItemIt++)->get();
+        }
+    }
+
+    /*
+     * Get the next item from the underlying item sequence iterator.
+     */
+    return _mItemSeqIter.next();
+}
+
 void MsgIter::_handleItem(const Item& item)
 {
     /* Log item details */
@@ -165,6 +235,9 @@ void MsgIter::_handleItem(const Item& item)
     case Item::Type::StructFieldEnd:
         this->_handleItem(item.asStructFieldEnd());
         break;
+    case Item::Type::FixedLayoutStructField:
+        this->_handleItem(item.asFixedLayoutStructField());
+        break;
     case Item::Type::StaticLenArrayFieldBegin:
         this->_handleItem(item.asStaticLenArrayFieldBegin());
         break;
@@ -251,7 +324,22 @@ bt2::Message::Shared MsgIter::_createPktEndMsgAndUpdateCurDefClkVal()
 void MsgIter::_handleItem(const PktEndItem&)
 {
     BT_ASSERT_DBG(!_mCurMsg);
+
+    /* Report the length of the decoded packet (profiling) */
+    const auto pktEndOffset =
+        _mRecordedPkt ? _mRecordedPkt->endOffset() : _mItemSeqIter.offset();
+
+    _mSelfMsgIter.addDecodedBytes((pktEndOffset - _mLastPktEndOffset).bytes());
+    this->_endPkt(pktEndOffset);
+}
+
+void MsgIter::_endPkt(const bt2c::DataLen pktEndOffset)
+{
     BT_ASSERT_DBG(_mCurPkt);
+    _mLastPktEndOffset = pktEndOffset;
+
+    /* Next item, if any, begins a packet at `_mLastPktEndOffset` */
+    _mAtPktBegin = true;
 
     /* Emit a packet beginning message now if required to fix a quirk */
     if (_mDelayPktBeginMsgEmission) {
@@ -582,6 +670,63 @@ void MsgIter::_handleItem(const PktInfoItem& item)
         /* No quirk to handle: emit the message now */
         this->_emitPktBeginMsg(_mPktBeginDefClkVal);
     }
+
+    /*
+     * Skip the content of this packet if the library would discard all
+     * its event messages anyway.
+     */
+    if (this->_canSkipPktContent(item)) {
+        this->_skipPktContent(item);
+    }
+}
+
+bool MsgIter::_canSkipPktContent(const PktInfoItem& item) const
+{
+    /*
+     * Only skip a packet when we know where it ends, and when no quirk
+     * to fix could make one of its event records occur after its end
+     * timestamp.
+     */
+    if (!_mPktEndDefClkVal || !item.expectedTotalLen() || _mQuirks.pktEndDefClkValZero ||
+        _mQuirks.eventRecordDefClkValGtNextPktBeginDefClkVal ||
+        _mQuirks.eventRecordDefClkValLtPktBeginDefClkVal) {
+        return false;
+    }
+
+    const auto seekNsFromOrigin = _mSelfMsgIter.autoSeekNsFromOrigin();
+
+    if (!seekNsFromOrigin) {
+        return false;
+    }
+
+    const auto defClkCls = _mStream.cls().defaultClockClass();
+
+    BT_ASSERT_DBG(defClkCls);
+
+    try {
+        return defClkCls->cyclesToNsFromOrigin(*_mPktEndDefClkVal) < *seekNsFromOrigin;
+    } catch (const bt2::OverflowError&) {
+        return false;
+    }
+}
+
+void MsgIter::_skipPktContent(const PktInfoItem& item)
+{
+    const auto pktEndOffset = _mRecordedPkt ? _mRecordedPkt->endOffset() :
+                                              _mLastPktEndOffset + *item.expectedTotalLen();
+
+    BT_CPPLOGD("Skipping packet content while automatically seeking: "
+               "pkt-offset-bytes={}, pkt-end-offset-bytes={}, end-def-clk-val={}",
+               _mLastPktEndOffset.bytes(), pktEndOffset.bytes(), *_mPktEndDefClkVal);
+
+    if (_mRecordedPkt) {
+        /* `_mItemSeqIter` is already at the beginning of the next packet */
+        _mRecordedPktItemIt = _mRecordedPkt->items().end();
+    } else {
+        _mItemSeqIter.seekPkt(pktEndOffset);
+    }
+
+    this->_endPkt(pktEndOffset);
 }
 
 bt2::Message::Shared MsgIter::_createEventMsg(const bt2::EventClass cls, const _OptUll& defClkVal)
@@ -601,6 +746,27 @@ bt2::Message::Shared MsgIter::_createEventMsg(const bt2::EventClass cls, const _
     }
 }
 
+bool MsgIter::_keepsEventRecordCls(const EventRecordCls& eventRecordCls)
+{
+    if (!_mEventRecordClsFilter || _mEventRecordClsFilter->isEmpty()) {
+        return true;
+    }
+
+    const auto it = _mKeepEventRecordCls.find(&eventRecordCls);
+
+    if (it != _mKeepEventRecordCls.end()) {
+        return it->second;
+    }
+
+    const auto keep = _mEventRecordClsFilter->keeps(eventRecordCls);
+
+    BT_CPPLOGD("Event record class filter decision: "
+               "event-record-cls-id={}, keep={}",
+               eventRecordCls.id(), keep);
+    _mKeepEventRecordCls.emplace(&eventRecordCls, keep);
+    return keep;
+}
+
 void MsgIter::_handleItem(const EventRecordInfoItem& item)
 {
     // TODO: Test having a trace with only event record headers
@@ -618,6 +784,12 @@ void MsgIter::_handleItem(const EventRecordInfoItem& item)
         _mCurDefClkVal = *item.defClkVal();
     }
 
+    /* Skip the remaining items of a filtered out event record */
+    if (!this->_keepsEventRecordCls(*item.cls())) {
+        _mSkipItemsUntilEventRecordEndItem = true;
+        return;
+    }
+
     /*
      * Set as current message.
      *
@@ -741,8 +913,21 @@ void MsgIter::_handleItem(const NullTerminatedStrFieldEndItem&)
 
 void MsgIter::_handleBlobRawDataItem(const RawDataItem& item)
 {
-    std::memcpy(&this->_stackTopCurSubField().asBlob().data()[_mCurBlobFieldDataOffset],
-                item.data().begin(), item.data().size());
+    const auto blobField = this->_stackTopCurSubField().asBlob();
+
+    if (_mCurBlobFieldDataOffset == 0 && item.dataOwner() &&
+        item.data().size() >= minBorrowedDataLen && item.data().size() == blobField.length()) {
+        /*
+         * The whole BLOB field data is in this item and some owner
+         * keeps it valid: borrow it instead of copying it.
+         */
+        blobField.borrowedData(item.data().data(), releaseBorrowedData,
+                               new std::shared_ptr<const void> {item.dataOwner()});
+    } else {
+        std::memcpy(&blobField.data()[_mCurBlobFieldDataOffset], item.data().begin(),
+                    item.data().size());
+    }
+
     _mCurBlobFieldDataOffset += item.data().size();
 }
 
@@ -756,11 +941,25 @@ void MsgIter::_handleStrRawDataItem(const RawDataItem& item)
     if (_mCurStrFieldEncoding == StrEncoding::Utf8) {
         /* Try to find the first U+0000 codepoint */
         const auto endIt = std::find(item.data().begin(), item.data().end(), 0);
+        const auto strField = this->_stackTopCurSubField().asString();
+        const auto len = static_cast<std::size_t>(endIt - item.data().begin());
+
         _mHaveNullChar = endIt != item.data().end();
 
-        /* Append to current string field */
-        this->_stackTopCurSubField().asString().append(
-            reinterpret_cast<const char *>(item.data().data()), endIt - item.data().begin());
+        if (_mHaveNullChar && item.dataOwner() && len >= minBorrowedDataLen &&
+            strField.length() == 0) {
+            /*
+             * The whole string, including its terminating null
+             * character, is in this item and some owner keeps it
+             * valid: borrow it instead of copying it.
+             */
+            strField.borrowedValue(reinterpret_cast<const char *>(item.data().data()), len,
+                                   releaseBorrowedData,
+                                   new std::shared_ptr<const void> {item.dataOwner()});
+        } else {
+            /* Append to current string field */
+            strField.append(reinterpret_cast<const char *>(item.data().data()), len);
+        }
     } else {
         /* Try to find the first U+0000 codepoint */
         auto endIt = item.data().end();
@@ -813,6 +1012,64 @@ void MsgIter::_handleItem(const StructFieldEndItem&)
     this->_stackPop();
 }
 
+void MsgIter::_handleItem(const FixedLayoutStructFieldItem& item)
+{
+    /* Only a scope root field may have a fixed layout */
+    BT_ASSERT_DBG(_mStack.empty());
+    BT_ASSERT_DBG(_mCurScopeField);
+
+    const auto& members = item.layout().members;
+    std::uint64_t libMemberIndex = 0;
+
+    for (std::size_t i = 0; i < members.size(); ++i) {
+        const auto& member = members[i];
+
+        if (!member.fc->libCls()) {
+            /* No equivalent libbabeltrace2 member field */
+            continue;
+        }
+
+        const auto field = (*_mCurScopeField)[libMemberIndex];
+        const auto val = item.vals()[i];
+
+        ++libMemberIndex;
+
+        switch (member.fc->type()) {
+        case FcType::FixedLenBitArray:
+        case FcType::FixedLenBitMap:
+            field.asBitArray().valueAsInteger(val);
+            break;
+        case FcType::FixedLenBool:
+            field.asBool().value(static_cast<bool>(val));
+            break;
+        case FcType::FixedLenUInt:
+            field.asUnsignedInteger().value(val);
+            break;
+        case FcType::FixedLenSInt:
+            field.asSignedInteger().value(static_cast<long long>(val));
+            break;
+        case FcType::FixedLenFloat:
+            if (member.len == 32_bits) {
+                const auto bits = static_cast<std::uint32_t>(val);
+                float floatVal;
+
+                std::memcpy(&floatVal, &bits, sizeof(floatVal));
+                field.asSinglePrecisionReal().value(floatVal);
+            } else {
+                double doubleVal;
+
+                BT_ASSERT_DBG(member.len == 64_bits);
+                std::memcpy(&doubleVal, &val, sizeof(doubleVal));
+                field.asDoublePrecisionReal().value(doubleVal);
+            }
+
+            break;
+        default:
+            bt_common_abort();
+        }
+    }
+}
+
 void MsgIter::_handleItem(const StaticLenArrayFieldBeginItem&)
 {
     this->_stackPush(this->_stackTopCurSubFieldAndGoToNextSubField().asArray());
@@ -9,6 +9,7 @@
 
 #include <queue>
 #include <stack>
+#include <unordered_map>
 
 #include <babeltrace2/babeltrace.h>
 
@@ -19,11 +20,13 @@
 #include "cpp-common/bt2c/aliases.hpp"
 #include "cpp-common/bt2c/unicode-conv.hpp"
 
+#include "event-record-cls-filter.hpp"
 #include "item-seq/item-seq-iter.hpp"
 #include "item-seq/item-visitor.hpp"
 #include "item-seq/logging-item-visitor.hpp"
 #include "null-cp-finder.hpp"
 #include "plugins/ctf/common/src/metadata/ctf-ir.hpp"
+#include "recorded-pkt.hpp"
 
 namespace ctf {
 namespace src {
@@ -66,6 +69,14 @@ struct MsgIterQuirks final
  *
  * A CTF message iterator may automatically fix some common quirks
  * (see `MsgIterQuirks`).
+ *
+ * A CTF message iterator may also only emit the event records of some
+ * classes (see `EventRecordClsFilter`).
+ *
+ * While the library automatically makes the libbabeltrace2 message
+ * iterator seek some time, a CTF message iterator skips the content of
+ * the packets which end before this time, only emitting their packet
+ * beginning/end and discarded item messages.
  */
 class MsgIter final
 {
@@ -77,13 +88,25 @@ public:
      *
      * `quirks` indicates which quirks to fix.
      *
+     * If `recordedPktProvider` isn't `nullptr`, then the iterator asks
+     * it for each packet before decoding it itself: when it provides a
+     * recorded packet, the iterator handles its items instead of
+     * decoding the packet.
+     *
+     * If `eventRecordClsFilter` isn't `nullptr`, then the iterator
+     * only creates event messages for the event records of which
+     * `*eventRecordClsFilter` keeps the class: it skips the items of
+     * the other event records.
+     *
      * It's guaranteed that this constructor doesn't throw
      * `bt2c::TryAgain` or a medium error.
      */
     explicit MsgIter(bt2::SelfMessageIterator selfMsgIter, const ctf::src::TraceCls& traceCls,
                      bt2s::optional<bt2c::Uuid> expectedMetadataStreamUuid, bt2::Stream stream,
                      Medium::UP medium, const MsgIterQuirks& quirks,
-                     const bt2c::Logger& parentLogger);
+                     const bt2c::Logger& parentLogger,
+                     RecordedPktProvider::UP recordedPktProvider = nullptr,
+                     EventRecordClsFilter::SP eventRecordClsFilter = nullptr);
 
     /* Disable copy/move operations */
     MsgIter(const MsgIter&) = delete;
@@ -307,6 +330,7 @@ private:
     void _handleItem(const FixedLenFloatFieldItem& item);
     void _handleItem(const FixedLenSIntFieldItem& item);
     void _handleItem(const FixedLenUIntFieldItem& item);
+    void _handleItem(const FixedLayoutStructFieldItem& item);
     void _handleItem(const MetadataStreamUuidItem& item);
     void _handleItem(const NonNullTerminatedStrFieldBeginItem& item);
     void _handleItem(const NonNullTerminatedStrFieldEndItem& item);
@@ -404,6 +428,32 @@ private:
         _mStack.pop();
     }
 
+    /*
+     * Returns whether or not `_mEventRecordClsFilter` keeps the event
+     * record class `eventRecordCls`.
+     */
+    bool _keepsEventRecordCls(const EventRecordCls& eventRecordCls);
+
+    /*
+     * Returns whether or not the library is making this iterator
+     * automatically seek a time which is after the end of the current
+     * packet described by `item`, in which case the library would
+     * discard all the event messages of said packet anyway.
+     */
+    bool _canSkipPktContent(const PktInfoItem& item) const;
+
+    /*
+     * Skips the rest of the current packet, of which the informative
+     * item is `item`, and ends it.
+     */
+    void _skipPktContent(const PktInfoItem& item);
+
+    /*
+     * Ends the current packet, which ends at the offset `pktEndOffset`
+     * within the item sequence, emitting a packet end message.
+     */
+    void _endPkt(bt2c::DataLen pktEndOffset);
+
     /*
      * Sets the current packet to `pkt`.
      */
@@ -463,6 +513,13 @@ private:
      */
     void _addMsgToQueue(bt2::ConstMessage::Shared msg);
 
+    /*
+     * Returns the next item to handle, either from the current
+     * recorded packet or from `_mItemSeqIter`, or `nullptr` if there
+     * are no more items.
+     */
+    const Item *_nextItem();
+
     /*
      * Returns one of:
      *
@@ -493,9 +550,32 @@ private:
     /* Underlying item sequence iterator to decode the data stream */
     ItemSeqIter _mItemSeqIter;
 
+    /* Provider of recorded packets, if any */
+    RecordedPktProvider::UP _mRecordedPktProvider;
+
+    /*
+     * Current recorded packet, if any, and iterator of its next item
+     * to handle.
+     */
+    RecordedPkt::UP _mRecordedPkt;
+    RecordedPkt::Items::const_iterator _mRecordedPktItemIt;
+
+    /*
+     * Whether or not the next item is the first one of a packet, that
+     * is, the beginning of a packet located at `_mLastPktEndOffset`.
+     */
+    bool _mAtPktBegin = true;
+
     /* Whether or not the iterator is ended */
     bool _mIsDone = false;
 
+    /*
+     * Offset, within the item sequence, of the end of the last packet
+     * of which the length was reported as decoded bytes to
+     * `_mSelfMsgIter`.
+     */
+    bt2c::DataLen _mLastPktEndOffset = bt2c::DataLen::fromBits(0);
+
     /*
      * Queue of already created messages.
      *
@@ -517,6 +597,21 @@ private:
      */
     bool _mSkipItemsUntilScopeEndItem = false;
 
+    /* Event record class filter (shared with the component) */
+    EventRecordClsFilter::SP _mEventRecordClsFilter;
+
+    /*
+     * Whether or not `_mEventRecordClsFilter` keeps a given event
+     * record class (cache).
+     */
+    std::unordered_map<const EventRecordCls *, bool> _mKeepEventRecordCls;
+
+    /*
+     * Whether or not to skip items until reaching the end of the
+     * current event record (filtered out).
+     */
+    bool _mSkipItemsUntilEventRecordEndItem = false;
+
     /*
      * If set: a message that we're building, that's not yet ready to be
      * returned.
@@ -0,0 +1,380 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS Inc. and Linux Foundation
+ */
+
+#include "common/assert.h"
+#include "common/common.h"
+#include "cpp-common/bt2s/make-unique.hpp"
+
+#include "item-seq/item-seq-iter.hpp"
+#include "item-seq/medium.hpp"
+#include "recorded-pkt.hpp"
+
+namespace ctf {
+namespace src {
+namespace {
+
+/*
+ * Medium offering the data of a single, entirely loaded packet.
+ *
+ * The returned buffers share the ownership of said data.
+ */
+class MemMedium final : public Medium
+{
+public:
+    explicit MemMedium(std::shared_ptr<const std::vector<std::uint8_t>> data,
+                       const bt2c::DataLen pktOffset) noexcept :
+        _mData {std::move(data)},
+        _mPktOffset {pktOffset}
+    {
+    }
+
+    Buf buf(const bt2c::DataLen offset, const bt2c::DataLen minSize) override
+    {
+        const auto dataLen = bt2c::DataLen::fromBytes(_mData->size());
+
+        if (offset < _mPktOffset || offset >= _mPktOffset + dataLen) {
+            throw NoData {};
+        }
+
+        const auto offsetInData = offset - _mPktOffset;
+        const auto remainingLen = dataLen - offsetInData;
+
+        if (remainingLen < minSize) {
+            throw NoData {};
+        }
+
+        return Buf {_mData->data() + offsetInData.bytes(), remainingLen, _mData};
+    }
+
+private:
+    std::shared_ptr<const std::vector<std::uint8_t>> _mData;
+    bt2c::DataLen _mPktOffset;
+};
+
+/*
+ * Item visitor which copies the visited item.
+ *
+ * Only the concrete item classes need a visiting method.
+ */
+class ItemCloner final : public ItemVisitor
+{
+public:
+    std::unique_ptr<const Item> clone(const Item& item)
+    {
+        item.accept(*this);
+        BT_ASSERT_DBG(_mClone);
+        return std::move(_mClone);
+    }
+
+    void visit(const Item&) override
+    {
+        /* Unknown concrete item class */
+        bt_common_abort();
+    }
+
+    void visit(const DataStreamInfoItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const DefClkValItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const DynLenArrayFieldBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const DynLenArrayFieldEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const DynLenBlobFieldBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const DynLenBlobFieldEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const DynLenStrFieldBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const DynLenStrFieldEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const EventRecordBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const EventRecordEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const EventRecordInfoItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const FixedLayoutStructFieldItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const FixedLenBitArrayFieldItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const FixedLenBitMapFieldItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const FixedLenBoolFieldItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const FixedLenFloatFieldItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const FixedLenSIntFieldItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const FixedLenUIntFieldItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const MetadataStreamUuidItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const NullTerminatedStrFieldBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const NullTerminatedStrFieldEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const OptionalFieldWithBoolSelBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const OptionalFieldWithBoolSelEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const OptionalFieldWithSIntSelBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const OptionalFieldWithSIntSelEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const OptionalFieldWithUIntSelBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const OptionalFieldWithUIntSelEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const PktBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const PktContentBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const PktContentEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const PktEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const PktInfoItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const PktMagicNumberItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const RawDataItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const ScopeBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const ScopeEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const StaticLenArrayFieldBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const StaticLenArrayFieldEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const StaticLenBlobFieldBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const StaticLenBlobFieldEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const StaticLenStrFieldBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const StaticLenStrFieldEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const StructFieldBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const StructFieldEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const VariantFieldWithSIntSelBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const VariantFieldWithSIntSelEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const VariantFieldWithUIntSelBeginItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const VariantFieldWithUIntSelEndItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const VarLenSIntFieldItem& item) override
+    {
+        this->_clone(item);
+    }
+
+    void visit(const VarLenUIntFieldItem& item) override
+    {
+        this->_clone(item);
+    }
+
+private:
+    template <typename ItemT>
+    void _clone(const ItemT& item)
+    {
+        _mClone = bt2s::make_unique<ItemT>(item);
+    }
+
+    std::unique_ptr<const Item> _mClone;
+};
+
+} /* namespace */
+
+RecordedPkt::RecordedPkt(std::vector<std::uint8_t> data) :
+    _mData {std::make_shared<const std::vector<std::uint8_t>>(std::move(data))}
+{
+}
+
+RecordedPkt::UP RecordedPkt::record(std::vector<std::uint8_t> data, const bt2c::DataLen pktOffset,
+                                    const TraceCls& traceCls, const bt2c::Logger& parentLogger)
+{
+    BT_ASSERT(!data.empty());
+
+    /*
+     * Create the recorded packet first so that its data doesn't move
+     * anymore: the raw data items point to it.
+     */
+    RecordedPkt::UP pkt {new RecordedPkt {std::move(data)}};
+    ItemSeqIter itemSeqIter {bt2s::make_unique<MemMedium>(pkt->_mData, pktOffset), traceCls,
+                             pktOffset, parentLogger};
+    ItemCloner cloner;
+
+    while (true) {
+        /*
+         * The medium isn't empty and the item sequence iterator throws
+         * when the packet data is incomplete, therefore it can't end
+         * before the packet ending item.
+         */
+        const auto item = itemSeqIter.next();
+
+        BT_ASSERT(item);
+        pkt->_mItems.emplace_back(cloner.clone(*item));
+
+        if (item->isPktEnd()) {
+            pkt->_mEndOffset = itemSeqIter.offset();
+            break;
+        }
+    }
+
+    return pkt;
+}
+
+} /* namespace src */
+} /* namespace ctf */
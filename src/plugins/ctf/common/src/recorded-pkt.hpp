@@ -0,0 +1,115 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS Inc. and Linux Foundation
+ */
+
+#ifndef BABELTRACE_PLUGINS_CTF_COMMON_SRC_RECORDED_PKT_HPP
+#define BABELTRACE_PLUGINS_CTF_COMMON_SRC_RECORDED_PKT_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "cpp-common/bt2c/data-len.hpp"
+#include "cpp-common/bt2c/logging.hpp"
+#include "cpp-common/bt2s/optional.hpp"
+
+#include "item-seq/item.hpp"
+#include "metadata/ctf-ir.hpp"
+
+namespace ctf {
+namespace src {
+
+/*
+ * Items of a single packet, recorded from an item sequence iterator,
+ * from the `PktBeginItem` item to the `PktEndItem` item.
+ *
+ * A recorded packet shares the ownership of the data of the packet
+ * with its raw data items (see RawDataItem::dataOwner()) so that their
+ * raw data remains valid as long as some owner exists.
+ *
+ * You may record a packet on some thread and replay its items on
+ * another one: a recorded packet only depends on its trace class
+ * (immutable once the metadata stream parser is done).
+ */
+class RecordedPkt final
+{
+public:
+    using UP = std::unique_ptr<RecordedPkt>;
+    using Items = std::vector<std::unique_ptr<const Item>>;
+
+    /*
+     * Decodes the single packet of which the data is `data`, located at
+     * `pktOffset` within its item sequence, using the trace class
+     * `traceCls`, and returns the corresponding recorded packet.
+     *
+     * May throw whatever ItemSeqIter::next() may throw.
+     */
+    static UP record(std::vector<std::uint8_t> data, bt2c::DataLen pktOffset,
+                     const TraceCls& traceCls, const bt2c::Logger& parentLogger);
+
+private:
+    explicit RecordedPkt(std::vector<std::uint8_t> data);
+
+public:
+    /*
+     * Recorded items, the first one being a `PktBeginItem` item and the
+     * last one a `PktEndItem` item.
+     */
+    const Items& items() const noexcept
+    {
+        return _mItems;
+    }
+
+    /*
+     * Offset of the end of this packet within its item sequence, that
+     * is, where the next packet begins.
+     */
+    bt2c::DataLen endOffset() const noexcept
+    {
+        return _mEndOffset;
+    }
+
+private:
+    std::shared_ptr<const std::vector<std::uint8_t>> _mData;
+    Items _mItems;
+    bt2c::DataLen _mEndOffset = bt2c::DataLen::fromBits(0);
+};
+
+/*
+ * Provider of packets which some other entity recorded ahead of time
+ * for a message iterator (see `MsgIter`).
+ */
+class RecordedPktProvider
+{
+public:
+    using UP = std::unique_ptr<RecordedPktProvider>;
+
+protected:
+    explicit RecordedPktProvider() noexcept = default;
+
+public:
+    virtual ~RecordedPktProvider() = default;
+
+    /*
+     * Returns the recorded packet located at `pktOffset` within the
+     * item sequence, or `nullptr` if not available, in which case the
+     * caller must decode the packet itself.
+     *
+     * The caller always asks for the packets of an item sequence in
+     * order.
+     *
+     * If `autoSeekNsFromOrigin` is set, then the caller is
+     * automatically seeking this time (nanoseconds from origin) and
+     * skips the content of the packets which end before it: the
+     * provider doesn't need to record them.
+     */
+    virtual RecordedPkt::UP take(bt2c::DataLen pktOffset,
+                                 const bt2s::optional<std::int64_t>& autoSeekNsFromOrigin) = 0;
+};
+
+} /* namespace src */
+} /* namespace ctf */
+
+#endif /* BABELTRACE_PLUGINS_CTF_COMMON_SRC_RECORDED_PKT_HPP */
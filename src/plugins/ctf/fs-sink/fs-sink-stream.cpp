@@ -16,14 +16,63 @@
 #include "fs-sink-ctf-meta.hpp"
 #include "fs-sink-stream.hpp"
 #include "fs-sink-trace.hpp"
+#include "fs-sink.hpp"
 #include "translate-trace-ir-to-ctf-ir.hpp"
 
+int fs_sink_stream_write_ring_buffer_packets(struct fs_sink_stream *stream)
+{
+    int ret = 0;
+
+    for (const fs_sink_ring_buffer_packet& packet : stream->ring_buffer.packets) {
+        ret = bt_ctfser_open_packet(&stream->ctfser);
+        if (ret) {
+            /* bt_ctfser_open_packet() logs errors */
+            goto end;
+        }
+
+        ret = bt_ctfser_write_bytes(&stream->ctfser, packet.data.data(), packet.data.size());
+        if (ret) {
+            BT_CPPLOGE_SPEC(stream->logger,
+                            "Error writing ring buffer packet: "
+                            "stream-file-name={}, packet-size-bytes={}",
+                            stream->file_name->str, packet.data.size());
+            goto end;
+        }
+
+        bt_ctfser_close_current_packet(&stream->ctfser, packet.data.size());
+    }
+
+    BT_CPPLOGI_SPEC(stream->logger,
+                    "Wrote ring buffer packets: stream-file-name={}, "
+                    "packet-count={}, size-bytes={}, evicted-packet-count={}",
+                    stream->file_name->str, stream->ring_buffer.packets.size(),
+                    stream->ring_buffer.size, stream->ring_buffer.evicted_count);
+    stream->ring_buffer.packets.clear();
+    stream->ring_buffer.size = 0;
+
+end:
+    return ret;
+}
+
 void fs_sink_stream_destroy(struct fs_sink_stream *stream)
 {
     if (!stream) {
         goto end;
     }
 
+    if (!stream->ring_buffer.packets.empty()) {
+        /*
+         * The component is being finalized before the end of the
+         * stream: no way to report an error at this point.
+         */
+        if (fs_sink_stream_write_ring_buffer_packets(stream)) {
+            BT_CPPLOGE_SPEC(stream->logger,
+                            "Failed to write ring buffer packets: "
+                            "stream-file-name={}, packet-count={}",
+                            stream->file_name->str, stream->ring_buffer.packets.size());
+        }
+    }
+
     bt_ctfser_fini(&stream->ctfser);
 
     if (stream->file_name) {
@@ -617,6 +666,63 @@ end:
     return ret;
 }
 
+/*
+ * Moves the packet which `stream` just closed to its ring buffer, and
+ * then evicts its oldest packets beyond the ring buffer bounds.
+ *
+ * The stream always keeps at least its newest packet.
+ */
+static void keep_closed_packet(struct fs_sink_stream *stream)
+{
+    const auto& cfg = stream->trace->fs_sink->ring_buffer;
+    const uint64_t size = stream->packet_state.total_size / 8;
+    const uint8_t *addr = bt_ctfser_get_closed_packet_addr(&stream->ctfser);
+    fs_sink_ring_buffer_packet packet;
+
+    if (!stream->ring_buffer.packets.empty() && cfg.max_size > 0 &&
+        stream->ring_buffer.size + size > cfg.max_size) {
+        /* Recycle the buffer of the oldest packet, which will be evicted anyway */
+        packet.data = std::move(stream->ring_buffer.packets.front().data);
+        stream->ring_buffer.size -= packet.data.size();
+        stream->ring_buffer.packets.pop_front();
+        stream->ring_buffer.evicted_count++;
+    }
+
+    packet.data.assign(addr, addr + size);
+
+    if (stream->sc->default_clock_class && stream->packet_state.end_cs != UINT64_C(-1)) {
+        packet.has_end_ns =
+            bt_clock_class_cycles_to_ns_from_origin(stream->sc->default_clock_class,
+                                                    stream->packet_state.end_cs,
+                                                    &packet.end_ns) ==
+            BT_CLOCK_CLASS_CYCLES_TO_NS_FROM_ORIGIN_STATUS_OK;
+    }
+
+    stream->ring_buffer.size += size;
+    stream->ring_buffer.packets.push_back(std::move(packet));
+
+    /* The next packet overwrites this one in the stream file */
+    bt_ctfser_discard_closed_packet(&stream->ctfser);
+
+    while (stream->ring_buffer.packets.size() > 1) {
+        const fs_sink_ring_buffer_packet& oldest = stream->ring_buffer.packets.front();
+        const fs_sink_ring_buffer_packet& newest = stream->ring_buffer.packets.back();
+        bool evict = cfg.max_size > 0 && stream->ring_buffer.size > cfg.max_size;
+
+        if (!evict && cfg.max_duration > 0 && oldest.has_end_ns && newest.has_end_ns) {
+            evict = newest.end_ns - oldest.end_ns > static_cast<int64_t>(cfg.max_duration);
+        }
+
+        if (!evict) {
+            break;
+        }
+
+        stream->ring_buffer.size -= oldest.data.size();
+        stream->ring_buffer.packets.pop_front();
+        stream->ring_buffer.evicted_count++;
+    }
+}
+
 int fs_sink_stream_close_packet(struct fs_sink_stream *stream, const bt_clock_snapshot *cs)
 {
     int ret;
@@ -642,6 +748,11 @@ int fs_sink_stream_close_packet(struct fs_sink_stream *stream, const bt_clock_sn
     /* Close packet */
     bt_ctfser_close_current_packet(&stream->ctfser, stream->packet_state.total_size / 8);
 
+    if (stream->trace->fs_sink->ring_buffer.max_size > 0 ||
+        stream->trace->fs_sink->ring_buffer.max_duration > 0) {
+        keep_closed_packet(stream);
+    }
+
     /* Partially copy current packet state to previous packet state */
     stream->prev_packet_state.end_cs = stream->packet_state.end_cs;
     stream->prev_packet_state.discarded_events_counter =
@@ -7,8 +7,10 @@
 #ifndef BABELTRACE_PLUGINS_CTF_FS_SINK_FS_SINK_STREAM_HPP
 #define BABELTRACE_PLUGINS_CTF_FS_SINK_FS_SINK_STREAM_HPP
 
+#include <deque>
 #include <glib.h>
 #include <stdint.h>
+#include <vector>
 
 #include <babeltrace2/babeltrace.h>
 
@@ -18,6 +20,19 @@
 struct fs_sink_trace;
 struct fs_sink_ctf_stream_class;
 
+/* Closed packet which a stream keeps in ring buffer mode */
+struct fs_sink_ring_buffer_packet
+{
+    /* Whole packet data */
+    std::vector<uint8_t> data;
+
+    /* True if `end_ns` is set */
+    bool has_end_ns = false;
+
+    /* End time (ns from origin) */
+    int64_t end_ns = 0;
+};
+
 struct fs_sink_stream
 {
     explicit fs_sink_stream(const bt2c::Logger& parentLogger) :
@@ -164,6 +179,19 @@ struct fs_sink_stream
         uint64_t beginning_cs = 0;
         uint64_t end_cs = 0;
     } discarded_packets_state;
+
+    /* Ring buffer mode state (see `fs_sink_comp::ring_buffer`) */
+    struct
+    {
+        /* Kept closed packets, the oldest first */
+        std::deque<fs_sink_ring_buffer_packet> packets;
+
+        /* Total size of `packets` (bytes) */
+        uint64_t size = 0;
+
+        /* Number of packets evicted so far */
+        uint64_t evicted_count = 0;
+    } ring_buffer;
 };
 
 struct fs_sink_stream *fs_sink_stream_create(struct fs_sink_trace *trace,
@@ -179,4 +207,10 @@ int fs_sink_stream_open_packet(struct fs_sink_stream *stream, const bt_clock_sna
 
 int fs_sink_stream_close_packet(struct fs_sink_stream *stream, const bt_clock_snapshot *cs);
 
+/*
+ * Writes the packets which `stream` keeps in ring buffer mode to its
+ * stream file, the oldest first, and forgets them.
+ */
+int fs_sink_stream_write_ring_buffer_packets(struct fs_sink_stream *stream);
+
 #endif /* BABELTRACE_PLUGINS_CTF_FS_SINK_FS_SINK_STREAM_HPP */
@@ -4,6 +4,7 @@
  * Copyright 2019 Philippe Proulx <pproulx@efficios.com>
  */
 
+#include <algorithm>
 #include <glib.h>
 #include <stdio.h>
 
@@ -55,8 +56,39 @@ static bt_param_validation_map_value_entry_descr fs_sink_params_descr[] = {
      bt_param_validation_value_descr::makeBool()},
     {"quiet", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
      bt_param_validation_value_descr::makeBool()},
+    {"ring-buffer-max-size", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeSignedInteger()},
+    {"ring-buffer-max-duration", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeSignedInteger()},
     BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_END};
 
+/*
+ * Sets `*val` to the value of the optional non-negative integer
+ * parameter `name` of `params`, if it exists.
+ *
+ * Returns false if the parameter is negative.
+ */
+static bool get_non_negative_int_param(struct fs_sink_comp *fs_sink, const bt_value *params,
+                                       const char *name, uint64_t *val)
+{
+    const bt_value *value = bt_value_map_borrow_entry_value_const(params, name);
+
+    if (!value) {
+        return true;
+    }
+
+    if (bt_value_integer_signed_get(value) < 0) {
+        BT_CPPLOGE_APPEND_CAUSE_SPEC(fs_sink->logger,
+                                     "Invalid `{}` parameter: expecting a non-negative integer: "
+                                     "val={}",
+                                     name, bt_value_integer_signed_get(value));
+        return false;
+    }
+
+    *val = static_cast<uint64_t>(bt_value_integer_signed_get(value));
+    return true;
+}
+
 static bt_component_class_initialize_method_status configure_component(struct fs_sink_comp *fs_sink,
                                                                        const bt_value *params)
 {
@@ -99,6 +131,24 @@ static bt_component_class_initialize_method_status configure_component(struct fs
         fs_sink->quiet = (bool) bt_value_bool_get(value);
     }
 
+    if (!get_non_negative_int_param(fs_sink, params, "ring-buffer-max-size",
+                                    &fs_sink->ring_buffer.max_size) ||
+        !get_non_negative_int_param(fs_sink, params, "ring-buffer-max-duration",
+                                    &fs_sink->ring_buffer.max_duration)) {
+        status = BT_COMPONENT_CLASS_INITIALIZE_METHOD_STATUS_ERROR;
+        goto end;
+    }
+
+    if (fs_sink->ring_buffer.max_size > 0) {
+        /*
+         * Keep artificial packets small enough so that the ring
+         * buffer of a stream without packets contains a few of them.
+         */
+        fs_sink->artificial_packet_size =
+            std::min(fs_sink->artificial_packet_size,
+                     std::max<uint64_t>(fs_sink->ring_buffer.max_size / 8, 4096));
+    }
+
     status = BT_COMPONENT_CLASS_INITIALIZE_METHOD_STATUS_OK;
 
 end:
@@ -268,16 +318,18 @@ handle_event_msg(struct fs_sink_comp *fs_sink, const bt_message *msg)
      * lazily create artificial packets.
      *
      * The size of an artificial packet is arbitrarily at least
-     * 4 MiB (it usually is greater because we close it when
+     * `fs_sink->artificial_packet_size` (4 MiB, unless in ring
+     * buffer mode; it usually is greater because we close it when
      * comes the time to write a new event and the packet's content
-     * size is >= 4 MiB), except the last one which can be smaller.
+     * size is >= this size), except the last one which can be
+     * smaller.
      */
         if (G_UNLIKELY(!stream->sc->has_packets)) {
             if (stream->packet_state.is_open &&
                 bt_ctfser_get_offset_in_current_packet_bits(&stream->ctfser) / 8 >=
-                    4 * 1024 * 1024) {
+                    fs_sink->artificial_packet_size) {
                 /*
-             * Stream's current packet is larger than 4 MiB:
+             * Stream's current packet is large enough:
              * close it. A new packet will be opened just
              * below.
              */
@@ -707,6 +759,15 @@ handle_stream_end_msg(struct fs_sink_comp *fs_sink, const bt_message *msg)
         }
     }
 
+    if (!stream->ring_buffer.packets.empty()) {
+        if (fs_sink_stream_write_ring_buffer_packets(stream)) {
+            BT_CPPLOGE_APPEND_CAUSE_SPEC(fs_sink->logger,
+                                         "Failed to write ring buffer packets.");
+            status = BT_COMPONENT_CLASS_SINK_CONSUME_METHOD_STATUS_ERROR;
+            goto end;
+        }
+    }
+
     BT_CPPLOGI_SPEC(fs_sink->logger,
                     "Closing stream file: "
                     "stream-id={}, stream-name=\"{}\", "
@@ -8,6 +8,7 @@
 #define BABELTRACE_PLUGINS_CTF_FS_SINK_FS_SINK_HPP
 
 #include <glib.h>
+#include <stdint.h>
 
 #include <babeltrace2/babeltrace.h>
 
@@ -48,6 +49,30 @@ struct fs_sink_comp
      */
     bool quiet = false;
 
+    /*
+     * Ring buffer mode: when `max_size` or `max_duration` isn't zero,
+     * each stream only keeps, in memory, its last closed packets
+     * within those bounds, and writes them to its stream file when
+     * it's destroyed (stream end message or component finalization).
+     */
+    struct
+    {
+        /*
+         * Maximum total size of the kept packets of a stream
+         * (bytes; 0 means unbounded).
+         */
+        uint64_t max_size = 0;
+
+        /*
+         * Maximum duration between the end times of the oldest and
+         * newest kept packets of a stream (ns; 0 means unbounded).
+         */
+        uint64_t max_duration = 0;
+    } ring_buffer;
+
+    /* Minimum size of an artificial packet (bytes) */
+    uint64_t artificial_packet_size = 4 * 1024 * 1024;
+
     /*
      * Hash table of `const bt_trace *` (weak) to
      * `struct fs_sink_trace *` (owned by hash table).
@@ -41,103 +41,6 @@ ctf_fs_ds_file_info::ctf_fs_ds_file_info(std::string pathParam, const bt2c::Logg
 {
 }
 
-/*
- * Return true if `offset_in_file` is in the current mapping.
- */
-
-static bool offset_ist_mapped(struct ctf_fs_ds_file *ds_file, off_t offset_in_file)
-{
-    if (!ds_file->mmap_addr)
-        return false;
-
-    return offset_in_file >= ds_file->mmap_offset_in_file &&
-           offset_in_file < (ds_file->mmap_offset_in_file + ds_file->mmap_len);
-}
-
-enum ds_file_status
-{
-    DS_FILE_STATUS_OK = 0,
-    DS_FILE_STATUS_ERROR = -1,
-    DS_FILE_STATUS_EOF = 1,
-};
-
-static ds_file_status ds_file_munmap(struct ctf_fs_ds_file *ds_file)
-{
-    BT_ASSERT(ds_file);
-
-    if (!ds_file->mmap_addr) {
-        return DS_FILE_STATUS_OK;
-    }
-
-    if (bt_munmap(ds_file->mmap_addr, ds_file->mmap_len)) {
-        BT_CPPLOGE_ERRNO_SPEC(ds_file->logger, "Cannot memory-unmap file",
-                              ": address={}, size={}, file_path=\"{}\", file={}",
-                              fmt::ptr(ds_file->mmap_addr), ds_file->mmap_len,
-                              ds_file->file ? ds_file->file->path : "NULL",
-                              ds_file->file ? fmt::ptr(ds_file->file->fp) : nullptr);
-        return DS_FILE_STATUS_ERROR;
-    }
-
-    ds_file->mmap_addr = NULL;
-
-    return DS_FILE_STATUS_OK;
-}
-
-/*
- * mmap a region of `ds_file` such that `requested_offset_in_file` is in the
- * mapping.  If the currently mmap-ed region already contains
- * `requested_offset_in_file`, the mapping is kept.
- *
- * `requested_offset_in_file` must be a valid offset in the file.
- */
-static ds_file_status ds_file_mmap(struct ctf_fs_ds_file *ds_file, off_t requested_offset_in_file)
-{
-    /* Ensure the requested offset is in the file range. */
-    BT_ASSERT(requested_offset_in_file >= 0);
-    BT_ASSERT(requested_offset_in_file < ds_file->file->size);
-
-    /*
-     * If the mapping already contains the requested range, we have nothing to
-     * do.
-     */
-    if (offset_ist_mapped(ds_file, requested_offset_in_file)) {
-        return DS_FILE_STATUS_OK;
-    }
-
-    /* Unmap old region */
-    ds_file_status status = ds_file_munmap(ds_file);
-    if (status != DS_FILE_STATUS_OK) {
-        return status;
-    }
-
-    /*
-     * Compute a mapping that has the required alignment properties and
-     * contains `requested_offset_in_file`.
-     */
-    size_t alignment = bt_mmap_get_offset_align_size(static_cast<int>(ds_file->logger.level()));
-    ds_file->mmap_offset_in_file =
-        requested_offset_in_file - (requested_offset_in_file % alignment);
-    ds_file->mmap_len =
-        MIN(ds_file->file->size - ds_file->mmap_offset_in_file, ds_file->mmap_max_len);
-
-    BT_ASSERT(ds_file->mmap_len > 0);
-    BT_ASSERT(requested_offset_in_file >= ds_file->mmap_offset_in_file);
-    BT_ASSERT(requested_offset_in_file < (ds_file->mmap_offset_in_file + ds_file->mmap_len));
-
-    ds_file->mmap_addr =
-        bt_mmap(ds_file->mmap_len, PROT_READ, MAP_PRIVATE, fileno(ds_file->file->fp.get()),
-                ds_file->mmap_offset_in_file, static_cast<int>(ds_file->logger.level()));
-    if (ds_file->mmap_addr == MAP_FAILED) {
-        BT_CPPLOGE_SPEC(ds_file->logger,
-                        "Cannot memory-map address (size {}) of file \"{}\" ({}) at offset {}: {}",
-                        ds_file->mmap_len, ds_file->file->path, fmt::ptr(ds_file->file->fp),
-                        (intmax_t) ds_file->mmap_offset_in_file, strerror(errno));
-        return DS_FILE_STATUS_ERROR;
-    }
-
-    return DS_FILE_STATUS_OK;
-}
-
 void ctf_fs_ds_index::updateOffsetsInStream()
 {
     auto offsetInStream = 0_bytes;
@@ -452,39 +355,72 @@ build_index_from_stream_file(const ctf_fs_ds_file_info& fileInfo,
     return index;
 }
 
-ctf_fs_ds_file::UP ctf_fs_ds_file_create(const char *path, const bt2c::Logger& parentLogger)
+namespace ctf {
+namespace src {
+namespace fs {
+namespace {
+
+/*
+ * Returns the configuration of the own file cache of a medium, which
+ * only keeps the last open file and the last mapping.
+ */
+FileCacheCfg ownFileCacheCfg() noexcept
 {
-    const auto offset_align = bt_mmap_get_offset_align_size(static_cast<int>(parentLogger.level()));
-    auto ds_file = bt2s::make_unique<ctf_fs_ds_file>(parentLogger, offset_align * 2048);
-
-    ds_file->file = bt2s::make_unique<ctf_fs_file>(ds_file->logger);
-    ds_file->file->path = path;
-    int ret = ctf_fs_file_open(ds_file->file.get(), "rb");
-    if (ret) {
-        return nullptr;
-    }
+    FileCacheCfg cfg;
 
-    return ds_file;
+    cfg.maxOpenFileCount = 1;
+    cfg.maxMappedLen = 0;
+    return cfg;
 }
 
-namespace ctf {
-namespace src {
-namespace fs {
+} /* namespace */
 
 Medium::Medium(const ctf_fs_ds_index& index, const bt2c::Logger& parentLogger) :
-    _mIndex(index), _mLogger {parentLogger, "PLUGIN/SRC.CTF.FS/DS-MEDIUM"}
+    _mIndex(index), _mLogger {parentLogger, "PLUGIN/SRC.CTF.FS/DS-MEDIUM"},
+    _mOwnFileCache {bt2s::make_unique<FileCache>(ownFileCacheCfg(), _mLogger)},
+    _mFileCache {_mOwnFileCache.get()}, _mCurIndexEntryIt {index.entries.end()}
+{
+    BT_ASSERT(!_mIndex.entries.empty());
+}
+
+Medium::Medium(const ctf_fs_ds_index& index, FileCache& fileCache,
+               const bt2c::Logger& parentLogger) :
+    _mIndex(index),
+    _mLogger {parentLogger, "PLUGIN/SRC.CTF.FS/DS-MEDIUM"}, _mFileCache {&fileCache},
+    _mCurIndexEntryIt {index.entries.end()}
 {
     BT_ASSERT(!_mIndex.entries.empty());
 }
 
 ctf_fs_ds_index::EntriesT::const_iterator
-Medium::_mFindIndexEntryForOffset(bt2c::DataLen offsetInStream) const noexcept
+Medium::_mFindIndexEntryForOffset(const bt2c::DataLen offsetInStream) noexcept
 {
-    return std::lower_bound(
+    const auto entryContainsOffset = [offsetInStream](const ctf_fs_ds_index_entry& entry) {
+        return offsetInStream >= entry.offsetInStream &&
+               offsetInStream < entry.offsetInStream + entry.packetSize;
+    };
+
+    /* Fast path: same packet as last time or next packet */
+    if (_mCurIndexEntryIt != _mIndex.entries.end()) {
+        if (entryContainsOffset(*_mCurIndexEntryIt)) {
+            return _mCurIndexEntryIt;
+        }
+
+        const auto nextIndexEntryIt = _mCurIndexEntryIt + 1;
+
+        if (nextIndexEntryIt != _mIndex.entries.end() && entryContainsOffset(*nextIndexEntryIt)) {
+            _mCurIndexEntryIt = nextIndexEntryIt;
+            return _mCurIndexEntryIt;
+        }
+    }
+
+    _mCurIndexEntryIt = std::lower_bound(
         _mIndex.entries.begin(), _mIndex.entries.end(), offsetInStream,
         [](const ctf_fs_ds_index_entry& entry, bt2c::DataLen offsetInStreamLambda) {
             return (entry.offsetInStream + entry.packetSize - 1_bytes) < offsetInStreamLambda;
         });
+
+    return _mCurIndexEntryIt;
 }
 
 ctf::src::Buf Medium::buf(const bt2c::DataLen requestedOffsetInStream, const bt2c::DataLen minSize)
@@ -524,24 +460,13 @@ ctf::src::Buf Medium::buf(const bt2c::DataLen requestedOffsetInStream, const bt2
 
     const ctf_fs_ds_index_entry& indexEntry = *indexEntryIt;
 
-    _mCurrentDsFile = ctf_fs_ds_file_create(indexEntry.path, _mLogger);
-    if (!_mCurrentDsFile) {
-        BT_CPPLOGE_APPEND_CAUSE_AND_THROW(bt2::Error, "Failed to create ctf_fs_ds_file");
-    }
-
     const auto fileStartInStream = indexEntry.offsetInStream - indexEntry.offsetInFile;
     const auto requestedOffsetInFile = requestedOffsetInStream - fileStartInStream;
-
-    ds_file_status status = ds_file_mmap(_mCurrentDsFile.get(), requestedOffsetInFile.bytes());
-    if (status != DS_FILE_STATUS_OK) {
-        throw bt2::Error("Failed to mmap file");
-    }
-
-    const auto startOfMappingInFile =
-        bt2c::DataLen::fromBytes(_mCurrentDsFile->mmap_offset_in_file);
+    auto mapping = _mFileCache->mapping(indexEntry.path, requestedOffsetInFile.bytes());
+    const auto startOfMappingInFile = bt2c::DataLen::fromBytes(mapping->offsetInFile());
     const auto requestedOffsetInMapping = requestedOffsetInFile - startOfMappingInFile;
     const auto exclEndOfMappingInFile =
-        startOfMappingInFile + bt2c::DataLen::fromBytes(_mCurrentDsFile->mmap_len);
+        startOfMappingInFile + bt2c::DataLen::fromBytes(mapping->len());
 
     /*
      * Find where to end the mapping.  We can map the following entries as long as
@@ -579,8 +504,7 @@ ctf::src::Buf Medium::buf(const bt2c::DataLen requestedOffsetInStream, const bt2
         endIndexEntryIt->offsetInFile + endIndexEntryIt->packetSize;
     const auto bufEndInFile = std::min(exclEndOfMappingInFile, exclEndOfEndEntryInFile);
     const auto bufLen = bufEndInFile - requestedOffsetInFile;
-    const uint8_t *bufStart =
-        (const uint8_t *) _mCurrentDsFile->mmap_addr + requestedOffsetInMapping.bytes();
+    const uint8_t *bufStart = mapping->addr() + requestedOffsetInMapping.bytes();
 
     if (bufLen < minSize) {
         BT_CPPLOGE_APPEND_CAUSE_AND_THROW(
@@ -590,7 +514,12 @@ ctf::src::Buf Medium::buf(const bt2c::DataLen requestedOffsetInStream, const bt2
             indexEntry.path, requestedOffsetInFile.bytes(), bufLen.bytes(), minSize.bytes());
     }
 
-    ctf::src::Buf buf {bufStart, bufLen};
+    /*
+     * The mapping is the data owner of the returned buffer so that its
+     * bytes remain valid as long as some user borrows them (see
+     * ctf::src::Buf::dataOwner()), even once the file cache evicts it.
+     */
+    ctf::src::Buf buf {bufStart, bufLen, std::move(mapping)};
 
     BT_CPPLOGD("CtfFsMedium::buf returns: buf-addr={}, buf-size-bytes={}\n", fmt::ptr(buf.addr()),
                buf.size().bytes());
@@ -615,11 +544,6 @@ bt2s::optional<ctf_fs_ds_index> ctf_fs_ds_file_build_index(const ctf_fs_ds_file_
     return build_index_from_stream_file(fileInfo, traceCls);
 }
 
-ctf_fs_ds_file::~ctf_fs_ds_file()
-{
-    (void) ds_file_munmap(this);
-}
-
 void ctf_fs_ds_file_group::insert_ds_file_info_sorted(ctf_fs_ds_file_info::UP ds_file_info)
 {
     /* Find the spot where to insert this ds_file_info. */
@@ -22,6 +22,7 @@
 
 #include "../common/src/item-seq/medium.hpp"
 #include "../common/src/metadata/ctf-ir.hpp"
+#include "file-cache.hpp"
 #include "file.hpp"
 
 struct ctf_fs_ds_file_info
@@ -38,38 +39,6 @@ struct ctf_fs_ds_file_info
     int64_t begin_ns = 0;
 };
 
-struct ctf_fs_ds_file
-{
-    using UP = std::unique_ptr<ctf_fs_ds_file>;
-
-    explicit ctf_fs_ds_file(const bt2c::Logger& parentLogger, const size_t mmapMaxLenParam) :
-        logger {parentLogger, "PLUGIN/SRC.CTF.FS/DS"}, mmap_max_len {mmapMaxLenParam}
-    {
-    }
-
-    ctf_fs_ds_file(const ctf_fs_ds_file&) = delete;
-    ctf_fs_ds_file& operator=(const ctf_fs_ds_file&) = delete;
-    ~ctf_fs_ds_file();
-
-    bt2c::Logger logger;
-
-    ctf_fs_file::UP file;
-
-    void *mmap_addr = nullptr;
-
-    /*
-     * Max length of chunk to mmap() when updating the current mapping.
-     * This value must be page-aligned.
-     */
-    size_t mmap_max_len = 0;
-
-    /* Length of the current mapping. Never exceeds the file's length. */
-    size_t mmap_len = 0;
-
-    /* Offset in the file where the current mapping starts. */
-    off_t mmap_offset_in_file = 0;
-};
-
 struct ctf_fs_ds_index_entry
 {
     ctf_fs_ds_index_entry(const bt2c::CStringView pathParam, const bt2c::DataLen offsetInFileParam,
@@ -148,9 +117,6 @@ struct ctf_fs_ds_file_group
     /*
      * This is an _ordered_ array of data stream file infos which
      * belong to this group (a single stream instance).
-     *
-     * You can call ctf_fs_ds_file_create() with one of those paths
-     * and the trace IR stream below.
      */
     std::vector<ctf_fs_ds_file_info::UP> ds_file_infos;
 
@@ -167,8 +133,6 @@ struct ctf_fs_ds_file_group
     ctf_fs_ds_index index;
 };
 
-ctf_fs_ds_file::UP ctf_fs_ds_file_create(const char *path, const bt2c::Logger& parentLogger);
-
 bt2s::optional<ctf_fs_ds_index> ctf_fs_ds_file_build_index(const ctf_fs_ds_file_info& file_info,
                                                            const ctf::src::TraceCls& traceCls);
 
@@ -176,10 +140,28 @@ namespace ctf {
 namespace src {
 namespace fs {
 
+/*
+ * Medium of the data stream which `index` indexes, possibly spanning
+ * multiple data stream files.
+ *
+ * A medium gets the memory mappings of the data stream files through a
+ * file cache (see `FileCache`).
+ */
 struct Medium : public ctf::src::Medium
 {
+    /*
+     * Builds a medium having its own file cache, which only keeps the
+     * last open file and the last mapping.
+     */
     explicit Medium(const ctf_fs_ds_index& index, const bt2c::Logger& parentLogger);
 
+    /*
+     * Builds a medium using the file cache `fileCache`, which must
+     * exist as long as this medium exists.
+     */
+    explicit Medium(const ctf_fs_ds_index& index, FileCache& fileCache,
+                    const bt2c::Logger& parentLogger);
+
     ~Medium() = default;
     Medium(const Medium&) = delete;
     Medium& operator=(const Medium&) = delete;
@@ -187,12 +169,25 @@ struct Medium : public ctf::src::Medium
     ctf::src::Buf buf(bt2c::DataLen offset, bt2c::DataLen minSize) override;
 
 private:
+    /*
+     * Returns the index entry containing the offset `offsetInStream`,
+     * trying the entry of the previous call and the one following it
+     * before searching the whole index.
+     */
     ctf_fs_ds_index::EntriesT::const_iterator
-    _mFindIndexEntryForOffset(bt2c::DataLen offsetInStream) const noexcept;
+    _mFindIndexEntryForOffset(bt2c::DataLen offsetInStream) noexcept;
 
     const ctf_fs_ds_index& _mIndex;
     bt2c::Logger _mLogger;
-    ctf_fs_ds_file::UP _mCurrentDsFile;
+
+    /* Own file cache, if any */
+    std::unique_ptr<FileCache> _mOwnFileCache;
+
+    /* File cache to use (`_mOwnFileCache` or a shared one) */
+    FileCache *_mFileCache;
+
+    /* Index entry which _mFindIndexEntryForOffset() last returned */
+    ctf_fs_ds_index::EntriesT::const_iterator _mCurIndexEntryIt;
 };
 
 } /* namespace fs */
@@ -0,0 +1,186 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS Inc. and Linux Foundation
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include "common/assert.h"
+#include "compat/mman.h" /* IWYU pragma: keep */
+#include "cpp-common/bt2/exc.hpp"
+#include "cpp-common/bt2s/make-unique.hpp"
+#include "cpp-common/vendor/fmt/format.h"
+
+#include "file-cache.hpp"
+
+namespace ctf {
+namespace src {
+namespace fs {
+
+FileMapping::FileMapping(void * const addr, const std::size_t len,
+                         const unsigned long long offsetInFile,
+                         std::shared_ptr<LiveLen> liveLen) noexcept :
+    _mAddr {addr},
+    _mLen {len}, _mOffsetInFile {offsetInFile}, _mLiveLen {std::move(liveLen)}
+{
+    *_mLiveLen += _mLen;
+}
+
+FileMapping::~FileMapping()
+{
+    (void) bt_munmap(_mAddr, _mLen);
+    *_mLiveLen -= _mLen;
+}
+
+namespace {
+
+int mmapFlags(const bool populate) noexcept
+{
+#ifdef MAP_POPULATE
+    if (populate) {
+        return MAP_PRIVATE | MAP_POPULATE;
+    }
+#else
+    (void) populate;
+#endif
+
+    return MAP_PRIVATE;
+}
+
+} /* namespace */
+
+FileCache::FileCache(const FileCacheCfg& cfg, const bt2c::Logger& parentLogger) :
+    _mLogger {parentLogger, "PLUGIN/SRC.CTF.FS/FILE-CACHE"},
+    _mMaxOpenFileCount {cfg.maxOpenFileCount},
+    _mMaxMappedLen {cfg.mapWholeFiles ? std::numeric_limits<unsigned long long>::max() :
+                                        cfg.maxMappedLen},
+    _mMapWholeFiles {cfg.mapWholeFiles}, _mMmapFlags {mmapFlags(cfg.populateMappings)},
+    _mMappingOffsetAlign {bt_mmap_get_offset_align_size(static_cast<int>(_mLogger.level()))},
+    _mMaxMappingLen {cfg.mapWholeFiles ? std::numeric_limits<std::size_t>::max() :
+                                         _mMappingOffsetAlign * 2048},
+    _mLiveMappedLen {std::make_shared<FileMapping::LiveLen>(0)}
+{
+    BT_ASSERT(cfg.maxOpenFileCount > 0);
+
+    BT_CPPLOGI("Created file cache: max-open-file-count={}, max-mapped-len-bytes={}, "
+               "map-whole-files={}, populate-mappings={}",
+               _mMaxOpenFileCount, _mMaxMappedLen, _mMapWholeFiles, cfg.populateMappings);
+}
+
+ctf_fs_file& FileCache::_file(const bt2c::CStringView path)
+{
+    const auto it = std::find_if(_mFiles.begin(), _mFiles.end(), [path](const ctf_fs_file::UP& file) {
+        return file->path == path.data();
+    });
+
+    if (it != _mFiles.end()) {
+        /* Hit: make it the most recently used */
+        _mFiles.splice(_mFiles.begin(), _mFiles, it);
+        return *_mFiles.front();
+    }
+
+    /* Miss: close the least recently used file if needed */
+    if (_mFiles.size() == _mMaxOpenFileCount) {
+        BT_CPPLOGD("Closing least recently used file: path=\"{}\"", _mFiles.back()->path);
+        _mFiles.pop_back();
+    }
+
+    auto file = bt2s::make_unique<ctf_fs_file>(_mLogger);
+
+    file->path = path.data();
+
+    if (ctf_fs_file_open(file.get(), "rb")) {
+        BT_CPPLOGE_APPEND_CAUSE_AND_THROW(bt2::Error, "Failed to open data stream file: path=\"{}\"",
+                                          path);
+    }
+
+    _mFiles.emplace_front(std::move(file));
+    return *_mFiles.front();
+}
+
+void FileCache::_evictMappings(const unsigned long long maxMappedLen) noexcept
+{
+    while (_mLiveMappedLen->load() > maxMappedLen && !_mMappings.empty()) {
+        const auto& mapping = *_mMappings.back().mapping;
+
+        /*
+         * If some other owner keeps this mapping alive, then evicting
+         * it doesn't decrease the live length: keep evicting.
+         */
+        BT_CPPLOGD("Evicting least recently used mapping: path=\"{}\", "
+                   "offset-in-file-bytes={}, len-bytes={}, other-owner-count={}",
+                   _mMappings.back().path, mapping.offsetInFile(), mapping.len(),
+                   _mMappings.back().mapping.use_count() - 1);
+        _mMappings.pop_back();
+    }
+}
+
+std::shared_ptr<const FileMapping> FileCache::mapping(const bt2c::CStringView path,
+                                                      const unsigned long long offsetInFile)
+{
+    const std::lock_guard<std::mutex> lock {_mMutex};
+
+    {
+        const auto it = std::find_if(_mMappings.begin(), _mMappings.end(),
+                                     [path, offsetInFile](const _Mapping& mapping) {
+                                         return mapping.mapping->contains(offsetInFile) &&
+                                                mapping.path == path.data();
+                                     });
+
+        if (it != _mMappings.end()) {
+            /* Hit: make it the most recently used */
+            _mMappings.splice(_mMappings.begin(), _mMappings, it);
+            return _mMappings.front().mapping;
+        }
+    }
+
+    /* Miss: map a new region which has the required alignment */
+    auto& file = this->_file(path);
+
+    BT_ASSERT(offsetInFile < static_cast<unsigned long long>(file.size));
+
+    const auto mappingOffsetInFile =
+        _mMapWholeFiles ? 0ULL : offsetInFile - (offsetInFile % _mMappingOffsetAlign);
+    const auto mappingLen = static_cast<std::size_t>(
+        std::min(static_cast<unsigned long long>(file.size) - mappingOffsetInFile,
+                 static_cast<unsigned long long>(_mMaxMappingLen)));
+
+    BT_ASSERT(mappingLen > 0);
+
+    const auto addr =
+        bt_mmap(mappingLen, PROT_READ, _mMmapFlags, fileno(file.fp.get()),
+                static_cast<off_t>(mappingOffsetInFile), static_cast<int>(_mLogger.level()));
+
+    if (addr == MAP_FAILED) {
+        BT_CPPLOGE_ERRNO_APPEND_CAUSE_AND_THROW(
+            bt2::Error, "Cannot memory-map region of data stream file",
+            ": path=\"{}\", offset-in-file-bytes={}, len-bytes={}", path, mappingOffsetInFile,
+            mappingLen);
+    }
+
+    /* Make room before the new mapping counts */
+    this->_evictMappings(_mMaxMappedLen >= mappingLen ? _mMaxMappedLen - mappingLen : 0);
+
+    auto mapping = std::make_shared<const FileMapping>(addr, mappingLen, mappingOffsetInFile,
+                                                       _mLiveMappedLen);
+
+    BT_CPPLOGD("Mapped region of data stream file: path=\"{}\", "
+               "offset-in-file-bytes={}, len-bytes={}",
+               path, mappingOffsetInFile, mappingLen);
+
+    _mMappings.emplace_front(_Mapping {path.data(), mapping});
+    return mapping;
+}
+
+std::size_t FileCache::openFileCount()
+{
+    const std::lock_guard<std::mutex> lock {_mMutex};
+
+    return _mFiles.size();
+}
+
+} /* namespace fs */
+} /* namespace src */
+} /* namespace ctf */
@@ -0,0 +1,241 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS Inc. and Linux Foundation
+ */
+
+#ifndef BABELTRACE_PLUGINS_CTF_FS_SRC_FILE_CACHE_HPP
+#define BABELTRACE_PLUGINS_CTF_FS_SRC_FILE_CACHE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "cpp-common/bt2c/c-string-view.hpp"
+#include "cpp-common/bt2c/logging.hpp"
+
+#include "file.hpp"
+
+namespace ctf {
+namespace src {
+namespace fs {
+
+/*
+ * Read-only memory mapping of a region of a data stream file.
+ *
+ * Unmaps the region on destruction.
+ *
+ * A mapping adds its length to a shared live length on construction and
+ * subtracts it on destruction, so that its cache (see `FileCache`)
+ * keeps counting it after evicting it.
+ */
+class FileMapping final
+{
+public:
+    /* Total length of the live mappings of a cache (bytes) */
+    using LiveLen = std::atomic<unsigned long long>;
+
+    explicit FileMapping(void *addr, std::size_t len, unsigned long long offsetInFile,
+                         std::shared_ptr<LiveLen> liveLen) noexcept;
+    ~FileMapping();
+
+    FileMapping(const FileMapping&) = delete;
+    FileMapping& operator=(const FileMapping&) = delete;
+
+    /*
+     * Address of the first mapped byte.
+     */
+    const std::uint8_t *addr() const noexcept
+    {
+        return static_cast<const std::uint8_t *>(_mAddr);
+    }
+
+    /*
+     * Length of this mapping (bytes).
+     */
+    std::size_t len() const noexcept
+    {
+        return _mLen;
+    }
+
+    /*
+     * Offset, within its file, of the first mapped byte (bytes).
+     */
+    unsigned long long offsetInFile() const noexcept
+    {
+        return _mOffsetInFile;
+    }
+
+    /*
+     * Whether or not this mapping contains the byte at the offset
+     * `offsetInFile` within its file.
+     */
+    bool contains(const unsigned long long offsetInFile) const noexcept
+    {
+        return offsetInFile >= _mOffsetInFile && offsetInFile < _mOffsetInFile + _mLen;
+    }
+
+private:
+    void *_mAddr;
+    std::size_t _mLen;
+    unsigned long long _mOffsetInFile;
+    std::shared_ptr<LiveLen> _mLiveLen;
+};
+
+/*
+ * Configuration of a file cache (see `FileCache`).
+ */
+struct FileCacheCfg final
+{
+    /* Maximum number of open files (greater than zero) */
+    std::size_t maxOpenFileCount = 64;
+
+    /*
+     * Maximum number of mapped bytes, including the bytes of evicted
+     * mappings which some other owner keeps alive (see `FileCache`).
+     *
+     * Doesn't apply when `mapWholeFiles` is true.
+     */
+    unsigned long long maxMappedLen = 256ULL * 1024 * 1024;
+
+    /*
+     * Whether or not to map whole data stream files at once instead of
+     * windows of a few megabytes.
+     *
+     * This avoids any remapping when reading a data stream file
+     * sequentially, but requires an address space as large as the sum
+     * of the sizes of all the data stream files: only enable it on a
+     * 64-bit host.
+     */
+    bool mapWholeFiles = false;
+
+    /*
+     * Whether or not to prefault the pages of the mappings
+     * (`MAP_POPULATE`), if the host supports it.
+     */
+    bool populateMappings = false;
+};
+
+/*
+ * Cache of open data stream files and of memory mappings of regions of
+ * them.
+ *
+ * A cache keeps at most a given number of open files and maps at most
+ * a given number of bytes, evicting the least recently used ones.
+ *
+ * A cache only drops its own reference to an evicted mapping: the
+ * mapping remains valid as long as some other owner (a medium buffer or
+ * a string/BLOB field which borrows its bytes, for example) exists.
+ *
+ * The maximum number of mapped bytes applies to all the live mappings
+ * of a cache, including such evicted ones. When they alone exceed the
+ * maximum, a cache evicts all its mappings but the new one: the limit
+ * is exceeded until their other owners release them.
+ *
+ * A cache is thread-safe, so that all the message iterators of a
+ * component, and the worker threads of their parallel packet decoders
+ * (see `ParallelPktDecoder`), may share a single one.
+ */
+class FileCache final
+{
+public:
+    /*
+     * Builds a cache configured by `cfg`.
+     */
+    explicit FileCache(const FileCacheCfg& cfg, const bt2c::Logger& parentLogger);
+
+    FileCache(const FileCache&) = delete;
+    FileCache& operator=(const FileCache&) = delete;
+
+    /*
+     * Returns a memory mapping of a region of the data stream file
+     * `path` which contains the byte at the offset `offsetInFile`,
+     * mapping it if needed.
+     *
+     * `offsetInFile` must be less than the size of the file.
+     *
+     * Appends a cause to the error of the current thread and throws
+     * `bt2::Error` on error.
+     */
+    std::shared_ptr<const FileMapping> mapping(bt2c::CStringView path,
+                                               unsigned long long offsetInFile);
+
+    /*
+     * Number of open files.
+     */
+    std::size_t openFileCount();
+
+    /*
+     * Total length of the live mappings of this cache, including
+     * evicted ones which some other owner keeps alive (bytes).
+     */
+    unsigned long long mappedLen() const noexcept
+    {
+        return _mLiveMappedLen->load();
+    }
+
+private:
+    /* Mapping entry */
+    struct _Mapping final
+    {
+        std::string path;
+        std::shared_ptr<const FileMapping> mapping;
+    };
+
+    /*
+     * Returns the open file `path`, opening it if needed.
+     *
+     * `_mMutex` must be locked.
+     */
+    ctf_fs_file& _file(bt2c::CStringView path);
+
+    /*
+     * Evicts the least recently used mappings until the live mappings
+     * of this cache have at most `maxMappedLen` bytes or until this
+     * cache holds no mapping.
+     *
+     * `_mMutex` must be locked.
+     */
+    void _evictMappings(unsigned long long maxMappedLen) noexcept;
+
+    bt2c::Logger _mLogger;
+    std::size_t _mMaxOpenFileCount;
+    unsigned long long _mMaxMappedLen;
+
+    /* Whether or not to map whole files (see `FileCacheCfg`) */
+    bool _mMapWholeFiles;
+
+    /* Flags of bt_mmap() */
+    int _mMmapFlags;
+
+    /*
+     * Offset alignment and maximum length of a mapping (bytes).
+     *
+     * `_mMaxMappingLen` is the maximum `std::size_t` value when mapping
+     * whole files.
+     */
+    std::size_t _mMappingOffsetAlign;
+    std::size_t _mMaxMappingLen;
+
+    /* Open files, the most recently used first */
+    std::list<ctf_fs_file::UP> _mFiles;
+
+    /* Mappings, the most recently used first */
+    std::list<_Mapping> _mMappings;
+
+    /* Total length of the live mappings, shared with them (bytes) */
+    std::shared_ptr<FileMapping::LiveLen> _mLiveMappedLen;
+
+    /* Protects `_mFiles` and `_mMappings` */
+    std::mutex _mMutex;
+};
+
+} /* namespace fs */
+} /* namespace src */
+} /* namespace ctf */
+
+#endif /* BABELTRACE_PLUGINS_CTF_FS_SRC_FILE_CACHE_HPP */
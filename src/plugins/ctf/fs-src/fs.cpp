@@ -32,6 +32,7 @@
 #include "file.hpp"
 #include "fs.hpp"
 #include "metadata.hpp"
+#include "parallel-pkt-decoder.hpp"
 #include "query.hpp"
 
 using namespace bt2c::literals::datalen;
@@ -119,12 +120,29 @@ ctf_fs_iterator_next(bt_self_message_iterator *iterator, bt_message_array_const
 static void instantiateMsgIter(ctf_fs_msg_iter_data *msg_iter_data)
 {
     ctf_fs_ds_file_group *ds_file_group = msg_iter_data->port_data->ds_file_group;
+    const auto decodingThreadCount = msg_iter_data->port_data->ctf_fs->decodingThreadCount;
+    RecordedPktProvider::UP recordedPktProvider;
 
-    Medium::UP medium = bt2s::make_unique<fs::Medium>(ds_file_group->index, msg_iter_data->logger);
+    /*
+     * Reset the message iterator first so that any previous packet
+     * decoder stops before we create a new one.
+     */
+    msg_iter_data->msgIter.reset();
+
+    if (decodingThreadCount > 0) {
+        recordedPktProvider = bt2s::make_unique<fs::ParallelPktDecoder>(
+            ds_file_group->index, *ds_file_group->ctf_fs_trace->cls(), decodingThreadCount,
+            msg_iter_data->port_data->ctf_fs->fileCache, msg_iter_data->logger);
+    }
+
+    Medium::UP medium = bt2s::make_unique<fs::Medium>(
+        ds_file_group->index, msg_iter_data->port_data->ctf_fs->fileCache, msg_iter_data->logger);
     msg_iter_data->msgIter.emplace(msg_iter_data->selfMsgIter, *ds_file_group->ctf_fs_trace->cls(),
                                    ds_file_group->ctf_fs_trace->metadataStreamUuid(),
                                    *ds_file_group->stream, std::move(medium),
-                                   msg_iter_data->port_data->ctf_fs->quirks, msg_iter_data->logger);
+                                   msg_iter_data->port_data->ctf_fs->quirks, msg_iter_data->logger,
+                                   std::move(recordedPktProvider),
+                                   msg_iter_data->port_data->ctf_fs->eventRecordClsFilter);
 }
 
 bt_message_iterator_class_seek_beginning_method_status
@@ -492,10 +510,12 @@ static void set_trace_name(const bt2::Trace trace, const char *name_suffix)
 
 static ctf_fs_trace::UP
 ctf_fs_trace_create(const char *path, const char *name, const ctf::src::ClkClsCfg& clkClsCfg,
+                    const bool skipEventRecordFields,
                     const bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
                     const bt2c::Logger& logger)
 {
-    auto ctf_fs_trace = bt2s::make_unique<struct ctf_fs_trace>(clkClsCfg, selfComp, logger);
+    auto ctf_fs_trace = bt2s::make_unique<struct ctf_fs_trace>(clkClsCfg, skipEventRecordFields,
+                                                               selfComp, logger);
     const auto metadataPath = fmt::format("{}" G_DIR_SEPARATOR_S CTF_FS_METADATA_FILENAME, path);
 
     ctf_fs_trace->path = path;
@@ -557,8 +577,9 @@ static int ctf_fs_component_create_ctf_fs_trace_one_path(
         return -1;
     }
 
-    ctf_fs_trace::UP ctf_fs_trace = ctf_fs_trace_create(
-        norm_path->str, trace_name, ctf_fs->clkClsCfg, selfComp, ctf_fs->logger);
+    ctf_fs_trace::UP ctf_fs_trace =
+        ctf_fs_trace_create(norm_path->str, trace_name, ctf_fs->clkClsCfg,
+                            ctf_fs->skipEventRecordFields, selfComp, ctf_fs->logger);
     if (!ctf_fs_trace) {
         BT_CPPLOGE_APPEND_CAUSE_SPEC(ctf_fs->logger, "Cannot create trace for `{}`.",
                                      norm_path->str);
@@ -1414,6 +1435,12 @@ static void create_streams_for_trace(struct ctf_fs_trace *ctf_fs_trace)
 static const bt_param_validation_value_descr inputs_elem_descr =
     bt_param_validation_value_descr::makeString();
 
+static const bt_param_validation_value_descr event_record_class_names_elem_descr =
+    bt_param_validation_value_descr::makeString();
+
+static const bt_param_validation_value_descr event_record_class_ids_elem_descr =
+    bt_param_validation_value_descr::makeSignedInteger();
+
 static bt_param_validation_map_value_entry_descr fs_params_entries_descr[] = {
     {"inputs", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_MANDATORY,
      bt_param_validation_value_descr::makeArray(1, BT_PARAM_VALIDATION_INFINITE,
@@ -1426,6 +1453,20 @@ static bt_param_validation_map_value_entry_descr fs_params_entries_descr[] = {
      bt_param_validation_value_descr::makeSignedInteger()},
     {"force-clock-class-origin-unix-epoch", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
      bt_param_validation_value_descr::makeBool()},
+    {"skip-event-record-fields", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeBool()},
+    {"decoding-thread-count", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeSignedInteger()},
+    {"event-record-class-names", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeArray(1, BT_PARAM_VALIDATION_INFINITE,
+                                                event_record_class_names_elem_descr)},
+    {"event-record-class-ids", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeArray(1, BT_PARAM_VALIDATION_INFINITE,
+                                                event_record_class_ids_elem_descr)},
+    {"map-whole-files", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeBool()},
+    {"populate-mappings", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeBool()},
     BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_END};
 
 ctf::src::fs::Parameters read_src_fs_parameters(const bt2::ConstMapValue params,
@@ -1463,6 +1504,46 @@ ctf::src::fs::Parameters read_src_fs_parameters(const bt2::ConstMapValue params,
         parameters.traceName = traceName->asString().value().str();
     }
 
+    /* skip-event-record-fields parameter */
+    if (const auto skipEventRecordFields = params["skip-event-record-fields"]) {
+        parameters.skipEventRecordFields = skipEventRecordFields->asBool().value();
+    }
+
+    /* decoding-thread-count parameter */
+    if (const auto decodingThreadCount = params["decoding-thread-count"]) {
+        const auto val = decodingThreadCount->asSignedInteger().value();
+
+        if (val < 0 || val > 256) {
+            BT_CPPLOGE_APPEND_CAUSE_AND_THROW_SPEC(
+                logger, bt2c::Error,
+                "Invalid `decoding-thread-count` parameter: expecting a value in [0, 256]: val={}",
+                val);
+        }
+
+        parameters.decodingThreadCount = static_cast<unsigned int>(val);
+    }
+
+    /* event-record-class-names and event-record-class-ids parameters */
+    parameters.eventRecordClsFilter = std::make_shared<const ctf::src::EventRecordClsFilter>(
+        ctf::src::EventRecordClsFilter::fromParams(params, logger));
+
+    /* map-whole-files parameter */
+    if (const auto mapWholeFiles = params["map-whole-files"]) {
+        if (mapWholeFiles->asBool().value()) {
+            if (sizeof(void *) >= 8) {
+                parameters.fileCacheCfg.mapWholeFiles = true;
+            } else {
+                BT_CPPLOGW_SPEC(logger, "Ignoring `map-whole-files` parameter on this host: "
+                                        "address space is too small.");
+            }
+        }
+    }
+
+    /* populate-mappings parameter */
+    if (const auto populateMappings = params["populate-mappings"]) {
+        parameters.fileCacheCfg.populateMappings = populateMappings->asBool().value();
+    }
+
     return parameters;
 }
 
@@ -1471,7 +1552,12 @@ static ctf_fs_component::UP ctf_fs_create(const bt2::ConstMapValue params,
 {
     const bt2c::Logger logger {selfSrcComp, "PLUGIN/SRC.CTF.FS/COMP"};
     const auto parameters = read_src_fs_parameters(params, logger);
-    auto ctf_fs = bt2s::make_unique<ctf_fs_component>(parameters.clkClsCfg, logger);
+    auto ctf_fs = bt2s::make_unique<ctf_fs_component>(parameters.clkClsCfg,
+                                                      parameters.fileCacheCfg, logger);
+
+    ctf_fs->skipEventRecordFields = parameters.skipEventRecordFields;
+    ctf_fs->decodingThreadCount = parameters.decodingThreadCount;
+    ctf_fs->eventRecordClsFilter = parameters.eventRecordClsFilter;
 
     if (ctf_fs_component_create_ctf_fs_trace(ctf_fs.get(), parameters.inputs,
                                              parameters.traceName ? parameters.traceName->c_str() :
@@ -1499,7 +1585,8 @@ ctf_fs_get_supported_mip_versions(bt_self_component_class_source *selfCompClsSrc
                                    static_cast<bt2::LoggingLevel>(logLevel),
                                    "PLUGIN/SRC.CTF.FS/COMP"};
         const auto parameters = read_src_fs_parameters(bt2::ConstMapValue {params}, logger);
-        auto ctf_fs = bt2s::make_unique<ctf_fs_component>(parameters.clkClsCfg, logger);
+        auto ctf_fs = bt2s::make_unique<ctf_fs_component>(parameters.clkClsCfg,
+                                                          parameters.fileCacheCfg, logger);
 
         if (ctf_fs_component_create_ctf_fs_trace(
                 ctf_fs.get(), parameters.inputs,
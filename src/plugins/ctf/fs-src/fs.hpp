@@ -30,10 +30,12 @@ struct ctf_fs_trace
     using UP = std::unique_ptr<ctf_fs_trace>;
 
     explicit ctf_fs_trace(const ctf::src::ClkClsCfg& clkClsCfg,
+                          const bool skipEventRecordFields,
                           const bt2::OptionalBorrowedObject<bt2::SelfComponent> selfComp,
                           const bt2c::Logger& parentLogger) :
         _mLogger {parentLogger, "PLUGIN/SRC.CTF.FS/TRACE"},
-        _mClkClsCfg {clkClsCfg}, _mSelfComp {selfComp}
+        _mClkClsCfg {clkClsCfg}, _mSkipEventRecordFields {skipEventRecordFields},
+        _mSelfComp {selfComp}
     {
     }
 
@@ -58,7 +60,8 @@ struct ctf_fs_trace
 
     void parseMetadata(const bt2c::ConstBytes buffer)
     {
-        _mParseRet = ctf::src::parseMetadataStream(_mSelfComp, _mClkClsCfg, buffer, _mLogger);
+        _mParseRet = ctf::src::parseMetadataStream(_mSelfComp, _mClkClsCfg, buffer, _mLogger,
+                                                   _mSkipEventRecordFields);
     }
 
     bt2::Trace::Shared trace;
@@ -73,6 +76,7 @@ struct ctf_fs_trace
 private:
     bt2c::Logger _mLogger;
     ctf::src::ClkClsCfg _mClkClsCfg;
+    bool _mSkipEventRecordFields;
     bt2::OptionalBorrowedObject<bt2::SelfComponent> _mSelfComp;
     bt2s::optional<ctf::src::MetadataStreamParser::ParseRet> _mParseRet;
 };
@@ -93,9 +97,10 @@ struct ctf_fs_component
     using UP = std::unique_ptr<ctf_fs_component>;
 
     explicit ctf_fs_component(const ctf::src::ClkClsCfg& clkClsCfgParam,
-                              const bt2c::Logger& parentLogger) noexcept :
+                              const ctf::src::fs::FileCacheCfg& fileCacheCfg,
+                              const bt2c::Logger& parentLogger) :
         logger {parentLogger, "PLUGIN/SRC.CTF.FS/COMP"},
-        clkClsCfg {clkClsCfgParam}
+        clkClsCfg {clkClsCfgParam}, fileCache {fileCacheCfg, logger}
     {
     }
 
@@ -107,6 +112,33 @@ struct ctf_fs_component
 
     ctf::src::ClkClsCfg clkClsCfg;
     ctf::src::MsgIterQuirks quirks;
+
+    /*
+     * Whether or not the event classes have no event record field
+     * classes (`skip-event-record-fields` parameter).
+     */
+    bool skipEventRecordFields = false;
+
+    /*
+     * Number of worker threads which decode the packets of a data
+     * stream ahead of its message iterator, or zero to decode them
+     * only within the message iterator (`decoding-thread-count`
+     * parameter).
+     */
+    unsigned int decodingThreadCount = 0;
+
+    /*
+     * Event record class filter of the message iterators
+     * (`event-record-class-names` and `event-record-class-ids`
+     * parameters).
+     */
+    ctf::src::EventRecordClsFilter::SP eventRecordClsFilter;
+
+    /*
+     * Open data stream files and memory mappings which all the message
+     * iterators of this component share.
+     */
+    ctf::src::fs::FileCache fileCache;
 };
 
 struct ctf_fs_msg_iter_data
@@ -195,6 +227,10 @@ struct Parameters
     bt2::ConstArrayValue inputs;
     bt2s::optional<std::string> traceName;
     ClkClsCfg clkClsCfg;
+    bool skipEventRecordFields = false;
+    unsigned int decodingThreadCount = 0;
+    EventRecordClsFilter::SP eventRecordClsFilter;
+    FileCacheCfg fileCacheCfg;
 };
 
 } /* namespace fs */
@@ -0,0 +1,252 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS Inc. and Linux Foundation
+ */
+
+#include <algorithm>
+#include <system_error>
+
+#include <babeltrace2/babeltrace.h>
+
+#include "common/assert.h"
+
+#include "parallel-pkt-decoder.hpp"
+
+namespace ctf {
+namespace src {
+namespace fs {
+
+using namespace bt2c::literals::datalen;
+
+ParallelPktDecoder::ParallelPktDecoder(const ctf_fs_ds_index& index, const TraceCls& traceCls,
+                                       const unsigned int threadCount, FileCache& fileCache,
+                                       const bt2c::Logger& parentLogger) :
+    _mLogger {parentLogger, "PLUGIN/SRC.CTF.FS/PARALLEL-PKT-DECODER"},
+    _mIndex {index}, _mTraceCls {traceCls}, _mFileCache {&fileCache}, _mMaxJobCount {threadCount * 2},
+    _mNextIndexEntryIt {index.entries.begin()}
+{
+    BT_ASSERT(threadCount > 0);
+
+    /* Initial jobs */
+    this->_addJobs();
+
+    /* No need for more worker threads than packets */
+    const auto actualThreadCount =
+        std::min(static_cast<std::size_t>(threadCount), _mIndex.entries.size());
+
+    _mThreads.reserve(actualThreadCount);
+
+    for (std::size_t i = 0; i < actualThreadCount; ++i) {
+        try {
+            _mThreads.emplace_back(&ParallelPktDecoder::_work, this);
+        } catch (const std::system_error& exc) {
+            /* Continue with what we have */
+            BT_CPPLOGW("Cannot create packet decoding worker thread: "
+                       "thread-count={}, msg=\"{}\"",
+                       _mThreads.size(), exc.what());
+            break;
+        }
+    }
+
+    BT_CPPLOGI("Created parallel packet decoder: "
+               "pkt-count={}, thread-count={}, max-job-count={}",
+               _mIndex.entries.size(), _mThreads.size(), _mMaxJobCount);
+}
+
+ParallelPktDecoder::~ParallelPktDecoder()
+{
+    {
+        const std::lock_guard<std::mutex> lock {_mMutex};
+
+        _mStop = true;
+    }
+
+    _mNewJobCond.notify_all();
+
+    for (auto& thread : _mThreads) {
+        thread.join();
+    }
+}
+
+void ParallelPktDecoder::_addJobs()
+{
+    while (_mJobs.size() < _mMaxJobCount && _mNextIndexEntryIt != _mIndex.entries.end()) {
+        _mJobs.emplace_back(*_mNextIndexEntryIt);
+        ++_mNextIndexEntryIt;
+    }
+
+    this->_markSkippedJobsDone();
+}
+
+bool ParallelPktDecoder::_willSkipPkt(const ctf_fs_ds_index_entry& indexEntry) const noexcept
+{
+    /*
+     * The message iterator also checks the actual packet end time and
+     * its quirks: if it doesn't skip this packet after all, then it
+     * decodes it itself.
+     */
+    return _mAutoSeekNsFromOrigin && indexEntry.timestamp_end_ns < *_mAutoSeekNsFromOrigin;
+}
+
+void ParallelPktDecoder::_markSkippedJobsDone() noexcept
+{
+    if (!_mAutoSeekNsFromOrigin) {
+        return;
+    }
+
+    for (auto& job : _mJobs) {
+        if (!job.isStarted && this->_willSkipPkt(*job.indexEntry)) {
+            BT_CPPLOGD("Not decoding packet to skip while automatically seeking: "
+                       "offset-in-file-bytes={}, ts-end-ns={}, seek-ns-from-origin={}",
+                       job.indexEntry->offsetInFile.bytes(), job.indexEntry->timestamp_end_ns,
+                       *_mAutoSeekNsFromOrigin);
+            job.isStarted = true;
+            job.isDone = true;
+        }
+    }
+}
+
+RecordedPkt::UP ParallelPktDecoder::take(const bt2c::DataLen pktOffset,
+                                         const bt2s::optional<std::int64_t>& autoSeekNsFromOrigin)
+{
+    if (_mThreads.empty()) {
+        /* No worker thread: nothing will ever be ready */
+        return nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock {_mMutex};
+
+    if (autoSeekNsFromOrigin != _mAutoSeekNsFromOrigin) {
+        _mAutoSeekNsFromOrigin = autoSeekNsFromOrigin;
+        this->_markSkippedJobsDone();
+    }
+
+    if (_mJobs.empty() || _mJobs.front().indexEntry->offsetInStream != pktOffset) {
+        /*
+         * Not the packet of the next job: this only happens if the
+         * message iterator doesn't follow the index.
+         */
+        BT_CPPLOGD("No decoding job for packet: pkt-offset-bytes={}", pktOffset.bytes());
+        return nullptr;
+    }
+
+    /* Wait for the job of this packet */
+    _mJobDoneCond.wait(lock, [this] {
+        return _mJobs.front().isDone;
+    });
+
+    auto pkt = std::move(_mJobs.front().pkt);
+
+    _mJobs.pop_front();
+
+    /* Replace the job we just removed */
+    this->_addJobs();
+    lock.unlock();
+    _mNewJobCond.notify_one();
+
+    if (!pkt) {
+        BT_CPPLOGD("No packet decoded by a worker thread: pkt-offset-bytes={}",
+                   pktOffset.bytes());
+    }
+
+    return pkt;
+}
+
+void ParallelPktDecoder::_work()
+{
+    const bt2c::Logger logger {_mLogger, "PLUGIN/SRC.CTF.FS/PARALLEL-PKT-DECODER/WORKER"};
+
+    while (true) {
+        _Job *job = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock {_mMutex};
+
+            _mNewJobCond.wait(lock, [this, &job] {
+                if (_mStop) {
+                    return true;
+                }
+
+                /* Find the first job to start */
+                for (auto& candidateJob : _mJobs) {
+                    if (!candidateJob.isStarted) {
+                        job = &candidateJob;
+                        return true;
+                    }
+                }
+
+                return false;
+            });
+
+            if (_mStop) {
+                return;
+            }
+
+            BT_ASSERT(job);
+            job->isStarted = true;
+        }
+
+        /*
+         * Decode the packet without holding the lock: `std::deque`
+         * doesn't invalidate a reference to an element when adding to
+         * its end or removing another element from its beginning, and
+         * take() only removes a job once it's done.
+         */
+        RecordedPkt::UP pkt;
+
+        try {
+            pkt = this->_recordPkt(*job->indexEntry, logger);
+        } catch (const std::exception& exc) {
+            /*
+             * The message iterator will decode this packet itself and
+             * report the error, if any, in its own thread.
+             */
+            BT_CPPLOGD_SPEC(logger, "Failed to decode packet: offset-in-file-bytes={}, msg=\"{}\"",
+                            job->indexEntry->offsetInFile.bytes(), exc.what());
+            bt_current_thread_clear_error();
+        }
+
+        {
+            const std::lock_guard<std::mutex> lock {_mMutex};
+
+            job->pkt = std::move(pkt);
+            job->isDone = true;
+        }
+
+        _mJobDoneCond.notify_one();
+    }
+}
+
+RecordedPkt::UP ParallelPktDecoder::_recordPkt(const ctf_fs_ds_index_entry& indexEntry,
+                                               const bt2c::Logger& logger) const
+{
+    BT_CPPLOGD_SPEC(logger, "Decoding packet: path=\"{}\", offset-in-file-bytes={}, len-bytes={}",
+                    indexEntry.path, indexEntry.offsetInFile.bytes(),
+                    indexEntry.packetSize.bytes());
+
+    /* Read the whole packet data through a medium offering only it */
+    ctf_fs_ds_index tempIndex;
+
+    tempIndex.entries.emplace_back(indexEntry);
+
+    Medium medium {tempIndex, *_mFileCache, logger};
+    const auto pktEndOffset = indexEntry.offsetInStream + indexEntry.packetSize;
+    auto offset = indexEntry.offsetInStream;
+    std::vector<std::uint8_t> data;
+
+    data.reserve(indexEntry.packetSize.bytes());
+
+    while (offset < pktEndOffset) {
+        const auto buf = medium.buf(offset, 1_bytes);
+
+        data.insert(data.end(), buf.addr(), buf.addr() + buf.size().bytes());
+        offset += buf.size();
+    }
+
+    return RecordedPkt::record(std::move(data), indexEntry.offsetInStream, _mTraceCls, logger);
+}
+
+} /* namespace fs */
+} /* namespace src */
+} /* namespace ctf */
@@ -0,0 +1,173 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS Inc. and Linux Foundation
+ */
+
+#ifndef BABELTRACE_PLUGINS_CTF_FS_SRC_PARALLEL_PKT_DECODER_HPP
+#define BABELTRACE_PLUGINS_CTF_FS_SRC_PARALLEL_PKT_DECODER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "cpp-common/bt2c/logging.hpp"
+
+#include "../common/src/metadata/ctf-ir.hpp"
+#include "../common/src/recorded-pkt.hpp"
+#include "data-stream-file.hpp"
+
+namespace ctf {
+namespace src {
+namespace fs {
+
+/*
+ * Recorded packet provider which decodes the packets of a data stream
+ * ahead of time on worker threads.
+ *
+ * While a message iterator handles the items of packet N, the worker
+ * threads decode the next packets (N + 1, N + 2, and so on), as found
+ * in the index of the data stream, each one independently.
+ *
+ * A worker thread only decodes a packet into items (see
+ * `RecordedPkt`): the message iterator still creates all the
+ * libbabeltrace2 objects on its own thread and keeps the state which
+ * spans packets (default clock value, discarded event record and
+ * packet counters, quirks).
+ *
+ * If a worker thread fails to decode a packet, then take() returns
+ * `nullptr` for it so that the message iterator decodes it itself,
+ * reporting any error as usual.
+ *
+ * While the message iterator automatically seeks a time, the worker
+ * threads don't decode the packets which, according to the index, end
+ * before this time: take() returns `nullptr` for them and the message
+ * iterator skips their content. The worker threads may still fully
+ * decode the few packets of which the jobs started before the first
+ * call to take() which reveals the seek time.
+ */
+class ParallelPktDecoder final : public RecordedPktProvider
+{
+public:
+    /*
+     * Builds a parallel packet decoder to decode the packets of the
+     * data stream indexed by `index` with `threadCount` worker threads
+     * using the trace class `traceCls`, reading the data stream files
+     * through `fileCache`.
+     *
+     * `threadCount` must be greater than zero.
+     */
+    explicit ParallelPktDecoder(const ctf_fs_ds_index& index, const TraceCls& traceCls,
+                                unsigned int threadCount, FileCache& fileCache,
+                                const bt2c::Logger& parentLogger);
+
+    ~ParallelPktDecoder();
+    ParallelPktDecoder(const ParallelPktDecoder&) = delete;
+    ParallelPktDecoder& operator=(const ParallelPktDecoder&) = delete;
+
+    RecordedPkt::UP take(bt2c::DataLen pktOffset,
+                         const bt2s::optional<std::int64_t>& autoSeekNsFromOrigin) override;
+
+private:
+    /* Decoding job of a single packet */
+    struct _Job final
+    {
+        explicit _Job(const ctf_fs_ds_index_entry& indexEntryParam) noexcept :
+            indexEntry {&indexEntryParam}
+        {
+        }
+
+        /* Index entry of the packet to decode */
+        const ctf_fs_ds_index_entry *indexEntry;
+
+        /* Whether or not some worker thread started this job */
+        bool isStarted = false;
+
+        /* Whether or not this job is done */
+        bool isDone = false;
+
+        /* Recorded packet, or `nullptr` on error (once done) */
+        RecordedPkt::UP pkt;
+    };
+
+    /*
+     * Adds jobs to `_mJobs` until it contains `_mMaxJobCount` jobs or
+     * until there are no more index entries.
+     *
+     * `_mMutex` must be locked.
+     */
+    void _addJobs();
+
+    /*
+     * Whether or not the message iterator will skip the content of the
+     * packet of which the index entry is `indexEntry`, considering
+     * `_mAutoSeekNsFromOrigin`.
+     *
+     * `_mMutex` must be locked.
+     */
+    bool _willSkipPkt(const ctf_fs_ds_index_entry& indexEntry) const noexcept;
+
+    /*
+     * Marks the jobs of `_mJobs` which no worker thread started and of
+     * which the message iterator will skip the packet content as done,
+     * without any recorded packet.
+     *
+     * `_mMutex` must be locked.
+     */
+    void _markSkippedJobsDone() noexcept;
+
+    /*
+     * Function of a worker thread.
+     */
+    void _work();
+
+    /*
+     * Reads and decodes the packet of which the index entry is
+     * `indexEntry`, returning the corresponding recorded packet.
+     */
+    RecordedPkt::UP _recordPkt(const ctf_fs_ds_index_entry& indexEntry,
+                               const bt2c::Logger& logger) const;
+
+    bt2c::Logger _mLogger;
+    const ctf_fs_ds_index& _mIndex;
+    const TraceCls& _mTraceCls;
+    FileCache *_mFileCache;
+
+    /* Maximum number of jobs in `_mJobs` */
+    std::size_t _mMaxJobCount;
+
+    /* Index entry of the next job to add */
+    ctf_fs_ds_index::EntriesT::const_iterator _mNextIndexEntryIt;
+
+    /* Jobs, in packet order, the first one being the next to take */
+    std::deque<_Job> _mJobs;
+
+    /* Whether or not the worker threads must stop */
+    bool _mStop = false;
+
+    /* Time which the message iterator is automatically seeking, if any */
+    bt2s::optional<std::int64_t> _mAutoSeekNsFromOrigin;
+
+    /*
+     * Protects `_mJobs` (including the jobs themselves), `_mStop`, and
+     * `_mAutoSeekNsFromOrigin`.
+     */
+    std::mutex _mMutex;
+
+    /* Signaled when there's a new job to start or to stop */
+    std::condition_variable _mNewJobCond;
+
+    /* Signaled when a job is done */
+    std::condition_variable _mJobDoneCond;
+
+    /* Worker threads */
+    std::vector<std::thread> _mThreads;
+};
+
+} /* namespace fs */
+} /* namespace src */
+} /* namespace ctf */
+
+#endif /* BABELTRACE_PLUGINS_CTF_FS_SRC_PARALLEL_PKT_DECODER_HPP */
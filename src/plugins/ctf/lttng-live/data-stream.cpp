@@ -141,7 +141,8 @@ lttng_live_stream_iterator_create_msg_iter(lttng_live_stream_iterator *liveStrea
     liveStreamIter->msg_iter.emplace(liveMsgIter->selfMsgIter, *ctfTc,
                                      liveStreamIter->trace->metadata->metadataStreamUuid(),
                                      *liveStreamIter->stream, std::move(medium),
-                                     ctf::src::MsgIterQuirks {}, liveStreamIter->logger);
+                                     ctf::src::MsgIterQuirks {}, liveStreamIter->logger, nullptr,
+                                     liveMsgIter->lttng_live_comp->params.eventRecordClsFilter);
     return LTTNG_LIVE_ITERATOR_STATUS_OK;
 }
 
@@ -210,6 +211,7 @@ lttng_live_stream_iterator_create(struct lttng_live_session *session, uint64_t c
 
     const auto ret = stream_iter.get();
     trace->stream_iterators.emplace_back(std::move(stream_iter));
+    trace->stream_iters_without_msg.push_back(ret);
 
     /* Track the number of active stream iterator. */
     session->lttng_live_msg_iter->active_stream_iter++;
@@ -83,7 +83,8 @@ static struct lttng_live_trace *lttng_live_create_trace(struct lttng_live_sessio
     BT_CPPLOGD_SPEC(session->logger, "Creating live trace: session-id={}, trace-id={}", session->id,
                     trace_id);
 
-    auto trace = bt2s::make_unique<lttng_live_trace>(session->logger);
+    auto trace =
+        bt2s::make_unique<lttng_live_trace>(session->logger, session->selfComp.graphMipVersion());
 
     trace->session = session;
     trace->id = trace_id;
@@ -948,32 +949,90 @@ handle_late_message(struct lttng_live_msg_iter *lttng_live_msg_iter,
     return LTTNG_LIVE_ITERATOR_STATUS_OK;
 }
 
+/*
+ * Prefetches, with a single round trip to the relay daemon, the next
+ * index of each stream iterator of `live_trace` without a current
+ * message which needs one.
+ */
+static enum lttng_live_iterator_status
+prefetch_next_indexes_for_trace(struct lttng_live_msg_iter *lttng_live_msg_iter,
+                                struct lttng_live_trace *live_trace)
+{
+    std::vector<lttng_live_stream_iterator *> stream_iters;
+
+    if (live_trace->metadata_stream_state == LTTNG_LIVE_METADATA_STREAM_STATE_NEEDED ||
+        live_trace->session->new_streams_needed) {
+        /* Those stream iterators need an update before any new index */
+        return LTTNG_LIVE_ITERATOR_STATUS_OK;
+    }
+
+    for (const auto stream_iter : live_trace->stream_iters_without_msg) {
+        if ((stream_iter->state == LTTNG_LIVE_STREAM_ACTIVE_NO_DATA ||
+             stream_iter->state == LTTNG_LIVE_STREAM_QUIESCENT_NO_DATA) &&
+            !stream_iter->has_stream_hung_up && !stream_iter->prefetched_index_reply) {
+            stream_iters.push_back(stream_iter);
+        }
+    }
+
+    if (stream_iters.size() < 2) {
+        /* Nothing to gain over requesting it on demand */
+        return LTTNG_LIVE_ITERATOR_STATUS_OK;
+    }
+
+    return lttng_live_prefetch_next_indexes(lttng_live_msg_iter, stream_iters);
+}
+
 static enum lttng_live_iterator_status
 next_stream_iterator_for_trace(struct lttng_live_msg_iter *lttng_live_msg_iter,
                                struct lttng_live_trace *live_trace,
                                struct lttng_live_stream_iterator **youngest_trace_stream_iter)
 {
-    struct lttng_live_stream_iterator *youngest_candidate_stream_iter = NULL;
-    int64_t youngest_candidate_msg_ts = INT64_MAX;
-    uint64_t stream_iter_idx;
-
     BT_ASSERT_DBG(live_trace);
 
     BT_CPPLOGD_SPEC(lttng_live_msg_iter->logger,
                     "Finding the next stream iterator for trace: "
-                    "trace-id={}",
-                    live_trace->id);
+                    "trace-id={}, ready-stream-iter-count={}, stream-iter-without-msg-count={}",
+                    live_trace->id, live_trace->ready_stream_iters.len(),
+                    live_trace->stream_iters_without_msg.size());
+
     /*
-     * Update the current message of every stream iterators of this trace.
-     * The current msg of every stream must have a timestamp equal or
-     * larger than the last message returned by this iterator. We must
-     * ensure monotonicity.
+     * Request the next index of all the stream iterators which need one
+     * at once instead of one at a time below.
      */
-    stream_iter_idx = 0;
-    while (stream_iter_idx < live_trace->stream_iterators.size()) {
+    {
+        const auto status = prefetch_next_indexes_for_trace(lttng_live_msg_iter, live_trace);
+
+        if (status != LTTNG_LIVE_ITERATOR_STATUS_OK) {
+            return status;
+        }
+    }
+
+    /*
+     * Update the current message of every stream iterator of this trace
+     * which doesn't have one, moving it to the heap of ready stream
+     * iterators. The current msg of every stream must have a timestamp
+     * equal or larger than the last message returned by this iterator.
+     * We must ensure monotonicity.
+     *
+     * The other stream iterators of this trace already have a current
+     * message within `live_trace->ready_stream_iters`.
+     *
+     * If a stream iterator has no message yet (`AGAIN` status), then
+     * carry on with the other ones so that they have a current message
+     * on the next call, and return `AGAIN` at the end.
+     */
+    std::vector<lttng_live_stream_iterator *> stream_iters_to_retry;
+
+    while (!live_trace->stream_iters_without_msg.empty()) {
         bool stream_iter_is_ended = false;
-        lttng_live_stream_iterator *stream_iter =
-            live_trace->stream_iterators[stream_iter_idx].get();
+        bool stream_iter_must_retry = false;
+        lttng_live_stream_iterator *stream_iter = live_trace->stream_iters_without_msg.back();
+
+        /*
+         * Remove it now: getting the next message of `stream_iter`
+         * may add new stream iterators to this trace.
+         */
+        live_trace->stream_iters_without_msg.pop_back();
 
         /*
          * If there is no current message for this stream, go fetch
@@ -991,7 +1050,19 @@ next_stream_iterator_for_trace(struct lttng_live_msg_iter *lttng_live_msg_iter,
                 break;
             }
 
+            if (stream_iter_status == LTTNG_LIVE_ITERATOR_STATUS_AGAIN) {
+                /* Still without a current message: try again later */
+                stream_iters_to_retry.push_back(stream_iter);
+                stream_iter_must_retry = true;
+                break;
+            }
+
             if (stream_iter_status != LTTNG_LIVE_ITERATOR_STATUS_OK) {
+                /* Still without a current message */
+                live_trace->stream_iters_without_msg.push_back(stream_iter);
+                live_trace->stream_iters_without_msg.insert(
+                    live_trace->stream_iters_without_msg.end(), stream_iters_to_retry.begin(),
+                    stream_iters_to_retry.end());
                 return stream_iter_status;
             }
 
@@ -1033,70 +1104,47 @@ next_stream_iterator_for_trace(struct lttng_live_msg_iter *lttng_live_msg_iter,
                                                  fmt::ptr(lttng_live_msg_iter), stream_iter->name,
                                                  curr_msg_ts_ns,
                                                  lttng_live_msg_iter->last_msg_ts_ns);
+                    live_trace->stream_iters_without_msg.push_back(stream_iter);
+                    live_trace->stream_iters_without_msg.insert(
+                        live_trace->stream_iters_without_msg.end(), stream_iters_to_retry.begin(),
+                        stream_iters_to_retry.end());
                     return LTTNG_LIVE_ITERATOR_STATUS_ERROR;
                 }
             }
         }
 
-        BT_ASSERT_DBG(stream_iter != youngest_candidate_stream_iter);
+        if (stream_iter_must_retry) {
+            continue;
+        }
 
         if (!stream_iter_is_ended) {
-            if (G_UNLIKELY(youngest_candidate_stream_iter == NULL) ||
-                stream_iter->current_msg_ts_ns < youngest_candidate_msg_ts) {
-                /*
-                 * Update the current best candidate message
-                 * for the stream iterator of this live trace
-                 * to be forwarded downstream.
-                 */
-                youngest_candidate_msg_ts = stream_iter->current_msg_ts_ns;
-                youngest_candidate_stream_iter = stream_iter;
-            } else if (stream_iter->current_msg_ts_ns == youngest_candidate_msg_ts) {
-                /*
-                 * Order the messages in an arbitrary but
-                 * deterministic way.
-                 */
-                BT_ASSERT_DBG(stream_iter != youngest_candidate_stream_iter);
-                int ret = lttng_live_msg_iter->msgComparator.compare(
-                    *stream_iter->current_msg, *youngest_candidate_stream_iter->current_msg);
-                if (ret < 0) {
-                    /*
-                     * The `youngest_candidate_stream_iter->current_msg`
-                     * should go first. Update the next
-                     * iterator and the current timestamp.
-                     */
-                    youngest_candidate_msg_ts = stream_iter->current_msg_ts_ns;
-                    youngest_candidate_stream_iter = stream_iter;
-                } else if (ret == 0) {
-                    /*
-                     * Unable to pick which one should go
-                     * first.
-                     */
-                    BT_CPPLOGW_SPEC(
-                        lttng_live_msg_iter->logger,
-                        "Cannot deterministically pick next live stream message iterator because they have identical next messages: "
-                        "stream-iter-addr={}"
-                        "stream-iter-addr={}",
-                        fmt::ptr(stream_iter), fmt::ptr(youngest_candidate_stream_iter));
-                }
-            }
-
-            stream_iter_idx++;
+            /*
+             * Insert into the heap: the comparator orders messages
+             * having the same timestamp in an arbitrary but
+             * deterministic way.
+             */
+            live_trace->ready_stream_iters.insert(stream_iter);
         } else {
             /*
-             * The live stream iterator has ended. That
-             * iterator is removed from the array, but
-             * there is no need to increment
-             * stream_iter_idx as
-             * g_ptr_array_remove_index_fast replaces the
-             * removed element with the array's last
-             * element.
+             * The live stream iterator has ended: remove it from
+             * the array.
              */
-            bt2c::vectorFastRemove(live_trace->stream_iterators, stream_iter_idx);
+            for (std::size_t i = 0; i < live_trace->stream_iterators.size(); ++i) {
+                if (live_trace->stream_iterators[i].get() == stream_iter) {
+                    bt2c::vectorFastRemove(live_trace->stream_iterators, i);
+                    break;
+                }
+            }
         }
     }
 
-    if (youngest_candidate_stream_iter) {
-        *youngest_trace_stream_iter = youngest_candidate_stream_iter;
+    if (!stream_iters_to_retry.empty()) {
+        live_trace->stream_iters_without_msg = std::move(stream_iters_to_retry);
+        return LTTNG_LIVE_ITERATOR_STATUS_AGAIN;
+    }
+
+    if (!live_trace->ready_stream_iters.isEmpty()) {
+        *youngest_trace_stream_iter = live_trace->ready_stream_iters.top();
         return LTTNG_LIVE_ITERATOR_STATUS_OK;
     } else {
         /*
@@ -1115,6 +1163,7 @@ next_stream_iterator_for_session(struct lttng_live_msg_iter *lttng_live_msg_iter
 {
     enum lttng_live_iterator_status stream_iter_status;
     uint64_t trace_idx = 0;
+    bool some_trace_must_retry = false;
     int64_t youngest_candidate_msg_ts = INT64_MAX;
     struct lttng_live_stream_iterator *youngest_candidate_stream_iter = NULL;
 
@@ -1146,6 +1195,14 @@ next_stream_iterator_for_session(struct lttng_live_msg_iter *lttng_live_msg_iter
              * ENDed. Remove the trace from this session.
              */
             trace_is_ended = true;
+        } else if (stream_iter_status == LTTNG_LIVE_ITERATOR_STATUS_AGAIN) {
+            /*
+             * Carry on with the other traces so that their stream
+             * iterators have a current message on the next call.
+             */
+            some_trace_must_retry = true;
+            trace_idx++;
+            continue;
         } else if (stream_iter_status != LTTNG_LIVE_ITERATOR_STATUS_OK) {
             return stream_iter_status;
         }
@@ -1192,6 +1249,11 @@ next_stream_iterator_for_session(struct lttng_live_msg_iter *lttng_live_msg_iter
             bt2c::vectorFastRemove(session->traces, trace_idx);
         }
     }
+
+    if (some_trace_must_retry) {
+        return LTTNG_LIVE_ITERATOR_STATUS_AGAIN;
+    }
+
     if (youngest_candidate_stream_iter) {
         *youngest_session_stream_iter = youngest_candidate_stream_iter;
         return LTTNG_LIVE_ITERATOR_STATUS_OK;
@@ -1299,10 +1361,13 @@ lttng_live_msg_iter_next(bt_self_message_iterator *self_msg_it, bt_message_array
          * kernel). Each viewer session can have multiple traces, for example,
          * 64bit UST viewer sessions could have multiple per-pid traces.
          *
-         * We iterate over the streams of each traces to update and see what is
-         * their next message's timestamp. From those timestamps, we select the
-         * message with the smallest timestamp as the best candidate message
-         * for that trace and do the same thing across all the sessions.
+         * Each trace keeps its stream iterators having a current message
+         * in a priority heap, the youngest one on top. For each trace, we
+         * only get the next message of the stream iterators without a
+         * current message (new ones and the one of which we just sent the
+         * current message downstream), insert them into the heap, and the
+         * top of the heap is the best candidate message for that trace. We
+         * do the same thing across all the sessions.
          *
          * We then compare the timestamp of best candidate message of all the
          * sessions to pick the message with the smallest timestamp and we
@@ -1312,6 +1377,7 @@ lttng_live_msg_iter_next(bt_self_message_iterator *self_msg_it, bt_message_array
             struct lttng_live_stream_iterator *youngest_stream_iter = NULL,
                                               *candidate_stream_iter = NULL;
             int64_t youngest_msg_ts_ns = INT64_MAX;
+            bool some_session_must_retry = false;
 
             uint64_t session_idx = 0;
             while (session_idx < lttng_live_msg_iter->sessions.size()) {
@@ -1342,6 +1408,17 @@ lttng_live_msg_iter_next(bt_self_message_iterator *self_msg_it, bt_message_array
                     continue;
                 }
 
+                if (stream_iter_status == LTTNG_LIVE_ITERATOR_STATUS_AGAIN) {
+                    /*
+                     * Carry on with the other sessions so that
+                     * their stream iterators have a current message
+                     * on the next call.
+                     */
+                    some_session_must_retry = true;
+                    session_idx++;
+                    continue;
+                }
+
                 if (stream_iter_status != LTTNG_LIVE_ITERATOR_STATUS_OK) {
                     goto return_status;
                 }
@@ -1388,7 +1465,7 @@ lttng_live_msg_iter_next(bt_self_message_iterator *self_msg_it, bt_message_array
                 session_idx++;
             }
 
-            if (!youngest_stream_iter) {
+            if (some_session_must_retry || !youngest_stream_iter) {
                 stream_iter_status = LTTNG_LIVE_ITERATOR_STATUS_AGAIN;
                 goto return_status;
             }
@@ -1410,6 +1487,18 @@ lttng_live_msg_iter_next(bt_self_message_iterator *self_msg_it, bt_message_array
             lttng_live_msg_iter->last_msg_ts_ns = youngest_msg_ts_ns;
             youngest_stream_iter->current_msg_ts_ns = INT64_MAX;
 
+            /*
+             * `youngest_stream_iter` is the top of the heap of its
+             * trace: it's now without a current message.
+             */
+            {
+                lttng_live_trace *trace = youngest_stream_iter->trace;
+
+                BT_ASSERT_DBG(trace->ready_stream_iters.top() == youngest_stream_iter);
+                trace->ready_stream_iters.removeTop();
+                trace->stream_iters_without_msg.push_back(youngest_stream_iter);
+            }
+
             stream_iter_status = LTTNG_LIVE_ITERATOR_STATUS_OK;
         }
 
@@ -1732,11 +1821,23 @@ static const char *sess_not_found_action_choices[] = {
     SESS_NOT_FOUND_ACTION_END_STR,
 };
 
+static const bt_param_validation_value_descr event_record_class_names_elem_descr =
+    bt_param_validation_value_descr::makeString();
+
+static const bt_param_validation_value_descr event_record_class_ids_elem_descr =
+    bt_param_validation_value_descr::makeSignedInteger();
+
 static struct bt_param_validation_map_value_entry_descr params_descr[] = {
     {INPUTS_PARAM, BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_MANDATORY,
      bt_param_validation_value_descr::makeArray(1, 1, inputs_elem_descr)},
     {SESS_NOT_FOUND_ACTION_PARAM, BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
      bt_param_validation_value_descr::makeString(sess_not_found_action_choices)},
+    {"event-record-class-names", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeArray(1, BT_PARAM_VALIDATION_INFINITE,
+                                                event_record_class_names_elem_descr)},
+    {"event-record-class-ids", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeArray(1, BT_PARAM_VALIDATION_INFINITE,
+                                                event_record_class_ids_elem_descr)},
     BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_END};
 
 static bt_component_class_initialize_method_status
@@ -1779,6 +1880,12 @@ lttng_live_component_create(const bt_value *params, bt_self_component_source *se
         lttng_live->params.sess_not_found_act = SESSION_NOT_FOUND_ACTION_CONTINUE;
     }
 
+    auto eventRecordClsFilter =
+        ctf::src::EventRecordClsFilter::fromParams(bt2::ConstMapValue {params}, lttng_live->logger);
+
+    lttng_live->params.eventRecordClsFilter =
+        std::make_shared<const ctf::src::EventRecordClsFilter>(std::move(eventRecordClsFilter));
+
     component = std::move(lttng_live);
     return BT_COMPONENT_CLASS_INITIALIZE_METHOD_STATUS_OK;
 }
@@ -17,12 +17,14 @@
 #include <babeltrace2/babeltrace.h>
 
 #include "cpp-common/bt2/message.hpp"
+#include "cpp-common/bt2c/prio-heap.hpp"
 #include "cpp-common/vendor/fmt/format.h" /* IWYU pragma: keep */
 
 #include "plugins/common/muxing/muxing.hpp"
 
 #include "../common/src/metadata/metadata-stream-parser-utils.hpp"
 #include "../common/src/msg-iter.hpp"
+#include "lttng-viewer-abi.hpp"
 #include "viewer-connection.hpp"
 
 /*
@@ -160,6 +162,16 @@ struct lttng_live_stream_iterator
     };
 
     bt2s::optional<CurPktInfo> curPktInfo;
+
+    /*
+     * Reply to a GET_NEXT_INDEX command for this stream which the
+     * viewer connection received ahead of time (see
+     * lttng_live_prefetch_next_indexes()), if any.
+     *
+     * lttng_live_get_next_index() consumes it instead of sending a
+     * new command.
+     */
+    bt2s::optional<lttng_viewer_index> prefetched_index_reply;
 };
 
 struct lttng_live_metadata
@@ -230,12 +242,41 @@ enum lttng_live_metadata_stream_state
     LTTNG_LIVE_METADATA_STREAM_STATE_CLOSED,
 };
 
+/*
+ * Comparator of `lttng_live_trace::ready_stream_iters`: the youngest
+ * current message, in a deterministic order when two current messages
+ * have the same timestamp, goes first.
+ */
+class lttng_live_stream_iterator_comparator final
+{
+public:
+    explicit lttng_live_stream_iterator_comparator(const std::uint64_t graphMipVersion) :
+        _mMsgComparator {graphMipVersion}
+    {
+    }
+
+    bool operator()(const lttng_live_stream_iterator *streamIterA,
+                    const lttng_live_stream_iterator *streamIterB) const noexcept
+    {
+        if (streamIterA->current_msg_ts_ns != streamIterB->current_msg_ts_ns) {
+            return streamIterA->current_msg_ts_ns > streamIterB->current_msg_ts_ns;
+        }
+
+        return _mMsgComparator.compare(*streamIterA->current_msg, *streamIterB->current_msg) > 0;
+    }
+
+private:
+    muxing::MessageComparator _mMsgComparator;
+};
+
 struct lttng_live_trace
 {
     using UP = std::unique_ptr<lttng_live_trace>;
 
-    explicit lttng_live_trace(const bt2c::Logger& parentLogger) :
-        logger {parentLogger, "PLUGIN/SRC.CTF.LTTNG-LIVE/TRACE"}
+    explicit lttng_live_trace(const bt2c::Logger& parentLogger,
+                              const std::uint64_t graphMipVersion) :
+        logger {parentLogger, "PLUGIN/SRC.CTF.LTTNG-LIVE/TRACE"},
+        ready_stream_iters {lttng_live_stream_iterator_comparator {graphMipVersion}}
     {
     }
 
@@ -255,6 +296,25 @@ struct lttng_live_trace
 
     std::vector<lttng_live_stream_iterator::UP> stream_iterators;
 
+    /*
+     * Stream iterators of `stream_iterators` having a current message,
+     * the youngest one first (weak).
+     *
+     * Each stream iterator of `stream_iterators` is either within
+     * `ready_stream_iters` or within `stream_iters_without_msg`, so
+     * that finding the youngest message of this trace doesn't require
+     * visiting all the stream iterators.
+     */
+    bt2c::PrioHeap<lttng_live_stream_iterator *, lttng_live_stream_iterator_comparator>
+        ready_stream_iters;
+
+    /*
+     * Stream iterators of `stream_iterators` without a current message:
+     * new ones and the one of which the current message was just sent
+     * downstream (weak).
+     */
+    std::vector<lttng_live_stream_iterator *> stream_iters_without_msg;
+
     enum lttng_live_metadata_stream_state metadata_stream_state =
         LTTNG_LIVE_METADATA_STREAM_STATE_NEEDED;
 };
@@ -322,6 +382,7 @@ struct lttng_live_component
     {
         std::string url;
         enum session_not_found_action sess_not_found_act = SESSION_NOT_FOUND_ACTION_CONTINUE;
+        ctf::src::EventRecordClsFilter::SP eventRecordClsFilter;
     } params;
 
     size_t max_query_size = 0;
@@ -475,6 +536,18 @@ enum lttng_live_iterator_status
 lttng_live_get_next_index(struct lttng_live_msg_iter *lttng_live_msg_iter,
                           struct lttng_live_stream_iterator *stream, struct packet_index *index);
 
+/*
+ * Sends a GET_NEXT_INDEX command for each stream of `streams` at once,
+ * and then receives all the replies, keeping each one as the prefetched
+ * index reply of its stream for its next lttng_live_get_next_index()
+ * call.
+ *
+ * None of `streams` may already have a prefetched index reply.
+ */
+enum lttng_live_iterator_status
+lttng_live_prefetch_next_indexes(struct lttng_live_msg_iter *lttng_live_msg_iter,
+                                 const std::vector<lttng_live_stream_iterator *>& streams);
+
 bool lttng_live_graph_is_canceled(struct lttng_live_msg_iter *msg_iter);
 
 void lttng_live_stream_iterator_set_state(struct lttng_live_stream_iterator *stream_iter,
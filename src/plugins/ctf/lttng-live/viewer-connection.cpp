@@ -1066,45 +1066,56 @@ enum lttng_live_iterator_status
 lttng_live_get_next_index(struct lttng_live_msg_iter *lttng_live_msg_iter,
                           struct lttng_live_stream_iterator *stream, struct packet_index *index)
 {
-    struct lttng_viewer_cmd cmd;
-    struct lttng_viewer_get_next_index rq;
-    enum lttng_live_viewer_status viewer_status;
     struct lttng_viewer_index rp;
     live_viewer_connection *viewer_connection = lttng_live_msg_iter->viewer_connection.get();
     struct lttng_live_trace *trace = stream->trace;
-    const size_t cmd_buf_len = sizeof(cmd) + sizeof(rq);
-    char cmd_buf[cmd_buf_len];
     uint32_t flags, rp_status;
 
-    BT_CPPLOGD_SPEC(viewer_connection->logger,
-                    "Requesting next index for stream: cmd={}, "
-                    "viewer-stream-id={}",
-                    LTTNG_VIEWER_GET_NEXT_INDEX, stream->viewer_stream_id);
-    cmd.cmd = htobe32(LTTNG_VIEWER_GET_NEXT_INDEX);
-    cmd.data_size = htobe64((uint64_t) sizeof(rq));
-    cmd.cmd_version = htobe32(0);
+    if (stream->prefetched_index_reply) {
+        /* Already received with lttng_live_prefetch_next_indexes() */
+        BT_CPPLOGD_SPEC(viewer_connection->logger,
+                        "Using prefetched next index reply for stream: "
+                        "viewer-stream-id={}",
+                        stream->viewer_stream_id);
+        rp = *stream->prefetched_index_reply;
+        stream->prefetched_index_reply.reset();
+    } else {
+        struct lttng_viewer_cmd cmd;
+        struct lttng_viewer_get_next_index rq;
+        const size_t cmd_buf_len = sizeof(cmd) + sizeof(rq);
+        char cmd_buf[cmd_buf_len];
+        enum lttng_live_viewer_status viewer_status;
 
-    memset(&rq, 0, sizeof(rq));
-    rq.stream_id = htobe64(stream->viewer_stream_id);
+        BT_CPPLOGD_SPEC(viewer_connection->logger,
+                        "Requesting next index for stream: cmd={}, "
+                        "viewer-stream-id={}",
+                        LTTNG_VIEWER_GET_NEXT_INDEX, stream->viewer_stream_id);
+        cmd.cmd = htobe32(LTTNG_VIEWER_GET_NEXT_INDEX);
+        cmd.data_size = htobe64((uint64_t) sizeof(rq));
+        cmd.cmd_version = htobe32(0);
 
-    /*
-     * Merge the cmd and connection request to prevent a write-write
-     * sequence on the TCP socket. Otherwise, a delayed ACK will prevent the
-     * second write to be performed quickly in presence of Nagle's algorithm.
-     */
-    memcpy(cmd_buf, &cmd, sizeof(cmd));
-    memcpy(cmd_buf + sizeof(cmd), &rq, sizeof(rq));
+        memset(&rq, 0, sizeof(rq));
+        rq.stream_id = htobe64(stream->viewer_stream_id);
 
-    viewer_status = lttng_live_send(viewer_connection, &cmd_buf, cmd_buf_len);
-    if (viewer_status != LTTNG_LIVE_VIEWER_STATUS_OK) {
-        viewer_handle_send_status(viewer_status, "get next index command");
-        return viewer_status_to_live_iterator_status(viewer_status);
-    }
+        /*
+         * Merge the cmd and connection request to prevent a write-write
+         * sequence on the TCP socket. Otherwise, a delayed ACK will prevent the
+         * second write to be performed quickly in presence of Nagle's algorithm.
+         */
+        memcpy(cmd_buf, &cmd, sizeof(cmd));
+        memcpy(cmd_buf + sizeof(cmd), &rq, sizeof(rq));
 
-    viewer_status = lttng_live_recv(viewer_connection, &rp, sizeof(rp));
-    if (viewer_status != LTTNG_LIVE_VIEWER_STATUS_OK) {
-        viewer_handle_recv_status(viewer_status, "get next index reply");
-        return viewer_status_to_live_iterator_status(viewer_status);
+        viewer_status = lttng_live_send(viewer_connection, &cmd_buf, cmd_buf_len);
+        if (viewer_status != LTTNG_LIVE_VIEWER_STATUS_OK) {
+            viewer_handle_send_status(viewer_status, "get next index command");
+            return viewer_status_to_live_iterator_status(viewer_status);
+        }
+
+        viewer_status = lttng_live_recv(viewer_connection, &rp, sizeof(rp));
+        if (viewer_status != LTTNG_LIVE_VIEWER_STATUS_OK) {
+            viewer_handle_recv_status(viewer_status, "get next index reply");
+            return viewer_status_to_live_iterator_status(viewer_status);
+        }
     }
 
     flags = be32toh(rp.flags);
@@ -1187,6 +1198,70 @@ lttng_live_get_next_index(struct lttng_live_msg_iter *lttng_live_msg_iter,
     }
 }
 
+enum lttng_live_iterator_status
+lttng_live_prefetch_next_indexes(struct lttng_live_msg_iter *lttng_live_msg_iter,
+                                 const std::vector<lttng_live_stream_iterator *>& streams)
+{
+    live_viewer_connection *viewer_connection = lttng_live_msg_iter->viewer_connection.get();
+    const size_t one_cmd_buf_len =
+        sizeof(struct lttng_viewer_cmd) + sizeof(struct lttng_viewer_get_next_index);
+    std::vector<char> cmd_buf(one_cmd_buf_len * streams.size());
+    enum lttng_live_viewer_status viewer_status;
+
+    BT_CPPLOGD_SPEC(viewer_connection->logger,
+                    "Requesting next index for streams at once: cmd={}, stream-count={}",
+                    LTTNG_VIEWER_GET_NEXT_INDEX, streams.size());
+
+    /*
+     * Write all the commands in a single buffer: the relay daemon
+     * handles the commands of a viewer connection in order, replying
+     * to each one in turn, so that we only wait for a single round trip
+     * instead of one per stream.
+     */
+    for (std::size_t i = 0; i < streams.size(); ++i) {
+        struct lttng_viewer_cmd cmd;
+        struct lttng_viewer_get_next_index rq;
+        char *one_cmd_buf = cmd_buf.data() + i * one_cmd_buf_len;
+
+        BT_ASSERT(!streams[i]->prefetched_index_reply);
+        cmd.cmd = htobe32(LTTNG_VIEWER_GET_NEXT_INDEX);
+        cmd.data_size = htobe64((uint64_t) sizeof(rq));
+        cmd.cmd_version = htobe32(0);
+        memset(&rq, 0, sizeof(rq));
+        rq.stream_id = htobe64(streams[i]->viewer_stream_id);
+        memcpy(one_cmd_buf, &cmd, sizeof(cmd));
+        memcpy(one_cmd_buf + sizeof(cmd), &rq, sizeof(rq));
+    }
+
+    viewer_status = lttng_live_send(viewer_connection, cmd_buf.data(), cmd_buf.size());
+    if (viewer_status != LTTNG_LIVE_VIEWER_STATUS_OK) {
+        viewer_handle_send_status(viewer_status, "get next index commands");
+        return viewer_status_to_live_iterator_status(viewer_status);
+    }
+
+    /*
+     * Receive all the replies, even if we stop using some of the
+     * streams in the meantime, to keep the connection in sync.
+     */
+    for (const auto stream : streams) {
+        struct lttng_viewer_index rp;
+
+        viewer_status = lttng_live_recv(viewer_connection, &rp, sizeof(rp));
+        if (viewer_status != LTTNG_LIVE_VIEWER_STATUS_OK) {
+            viewer_handle_recv_status(viewer_status, "get next index reply");
+            return viewer_status_to_live_iterator_status(viewer_status);
+        }
+
+        BT_CPPLOGD_SPEC(viewer_connection->logger,
+                        "Received prefetched next index reply: viewer-stream-id={}, response={}",
+                        stream->viewer_stream_id,
+                        static_cast<lttng_viewer_next_index_return_code>(be32toh(rp.status)));
+        stream->prefetched_index_reply = rp;
+    }
+
+    return LTTNG_LIVE_ITERATOR_STATUS_OK;
+}
+
 lttng_live_get_stream_bytes_status
 lttng_live_get_stream_bytes(struct lttng_live_msg_iter *lttng_live_msg_iter,
                             struct lttng_live_stream_iterator *stream, uint8_t *buf,
@@ -42,6 +42,23 @@ details_supported_mip_versions(
 	return (int) bt_integer_range_set_unsigned_add_range(supported_versions, 0, 1);
 }
 
+void details_destroy_details_trace(struct details_trace *details_trace)
+{
+	if (!details_trace) {
+		goto end;
+	}
+
+	if (details_trace->ec_headers) {
+		g_hash_table_destroy(details_trace->ec_headers);
+		details_trace->ec_headers = NULL;
+	}
+
+	g_free(details_trace);
+
+end:
+	return;
+}
+
 void details_destroy_details_trace_class_meta(
 		struct details_trace_class_meta *details_tc_meta)
 {
@@ -179,7 +196,8 @@ struct details_comp *create_details_comp(
 	}
 
 	details_comp->traces = g_hash_table_new_full(g_direct_hash,
-		g_direct_equal, NULL, g_free);
+		g_direct_equal, NULL,
+		(GDestroyNotify) details_destroy_details_trace);
 	if (!details_comp->traces) {
 		goto error;
 	}
@@ -487,10 +505,21 @@ details_consume(bt_self_component_sink *comp)
 			goto end;
 		}
 
-		/* Print output buffer to standard output and flush */
+		/* Write output buffer to standard output */
 		if (details_comp->str->len > 0) {
-			printf("%s", details_comp->str->str);
-			fflush(stdout);
+			/*
+			 * If this component printed at least one
+			 * character so far, and we're not in compact
+			 * mode, then write a newline first to visually
+			 * separate message blocks.
+			 */
+			if (details_comp->printed_something &&
+					!details_comp->cfg.compact) {
+				putchar('\n');
+			}
+
+			fwrite(details_comp->str->str, 1,
+				details_comp->str->len, stdout);
 			details_comp->printed_something = true;
 		}
 
@@ -501,5 +530,7 @@ details_consume(bt_self_component_sink *comp)
 	status = BT_COMPONENT_CLASS_SINK_CONSUME_METHOD_STATUS_OK;
 
 end:
+	/* Flush once for all the messages of this batch */
+	fflush(stdout);
 	return status;
 }
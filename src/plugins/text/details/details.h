@@ -54,6 +54,20 @@ struct details_trace {
 	 * listener ID.
 	 */
 	bt_listener_id trace_destruction_listener_id;
+
+	/*
+	 * `const bt_event_class *` (weak) -> `GString *` (owned by this)
+	 *
+	 * Pre-rendered part of the event messages of a given event
+	 * class which only depends on this class (see
+	 * write_event_message()), rendered once when first
+	 * encountering it.
+	 *
+	 * It is safe to keep the event class addresses as long as the
+	 * trace exists because the trace keeps its class, which keeps
+	 * its stream classes and their event classes.
+	 */
+	GHashTable *ec_headers;
 };
 
 /* A `sink.text.details` component */
@@ -136,6 +150,22 @@ struct details_comp {
 	GHashTable *traces;
 	uint32_t next_unique_trace_id;
 
+	/*
+	 * Last trace (weak) and its entry in `traces` above (weak), to
+	 * avoid looking up `traces` for consecutive messages of the
+	 * same trace. Both are reset when this trace is destroyed.
+	 */
+	const bt_trace *last_trace;
+	struct details_trace *last_details_trace;
+
+	/*
+	 * Last event class (weak) of an event message for which the
+	 * metadata objects are written, to avoid looking up `meta`
+	 * for consecutive event messages of the same class. Reset when
+	 * any trace class is destroyed.
+	 */
+	const bt_event_class *last_written_ec;
+
 	/* Upstream message iterator */
 	bt_message_iterator *msg_iter;
 
@@ -174,4 +204,6 @@ void details_destroy_details_trace_class_meta(
 
 struct details_trace_class_meta *details_create_details_trace_class_meta(void);
 
+void details_destroy_details_trace(struct details_trace *details_trace);
+
 #endif /* BABELTRACE_PLUGINS_TEXT_DETAILS_DETAILS_H */
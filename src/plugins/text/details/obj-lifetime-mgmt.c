@@ -10,7 +10,6 @@
 
 #include "common/common.h"
 #include "common/assert.h"
-#include "compat/glib.h"
 
 #include "details.h"
 #include "write.h"
@@ -24,6 +23,9 @@ void trace_class_destruction_listener(const bt_trace_class *tc, void *data)
 	BT_ASSERT(details_comp);
 	BT_ASSERT(details_comp->meta);
 
+	/* The last written event class could belong to `tc` */
+	details_comp->last_written_ec = NULL;
+
 	/* Remove from hash table, which also destroys the value */
 	g_hash_table_remove(details_comp->meta, tc);
 }
@@ -144,10 +146,21 @@ void trace_destruction_listener(const bt_trace *trace, void *data)
 	BT_ASSERT(details_comp);
 	BT_ASSERT(details_comp->traces);
 
+	if (details_comp->last_trace == trace) {
+		details_comp->last_trace = NULL;
+		details_comp->last_details_trace = NULL;
+	}
+
 	/* Remove from hash table, which also destroys the value */
 	g_hash_table_remove(details_comp->traces, trace);
 }
 
+static
+void destroy_gstring(GString *str)
+{
+	g_string_free(str, TRUE);
+}
+
 static
 struct details_trace *create_details_trace(uint64_t unique_id)
 {
@@ -159,35 +172,44 @@ struct details_trace *create_details_trace(uint64_t unique_id)
 
 	details_trace->unique_id = unique_id;
 	details_trace->trace_destruction_listener_id = UINT64_C(-1);
+	details_trace->ec_headers = g_hash_table_new_full(g_direct_hash,
+		g_direct_equal, NULL, (GDestroyNotify) destroy_gstring);
+	if (!details_trace->ec_headers) {
+		details_destroy_details_trace(details_trace);
+		details_trace = NULL;
+	}
 
 end:
 	return details_trace;
 }
 
-
-int details_trace_unique_id(struct details_write_ctx *ctx,
-		const bt_trace *trace, uint64_t *unique_id)
+struct details_trace *details_borrow_details_trace(
+		struct details_write_ctx *ctx, const bt_trace *trace)
 {
-	int ret = 0;
-	struct details_trace *details_trace = NULL;
+	struct details_comp *details_comp = ctx->details_comp;
+	struct details_trace *details_trace;
 
-	BT_ASSERT_DBG(unique_id);
-	BT_ASSERT_DBG(ctx->details_comp->traces);
-	if (!bt_g_hash_table_contains(ctx->details_comp->traces,
-			trace)) {
+	if (trace == details_comp->last_trace) {
+		details_trace = details_comp->last_details_trace;
+		goto end;
+	}
+
+	BT_ASSERT_DBG(details_comp->traces);
+	details_trace = g_hash_table_lookup(details_comp->traces, trace);
+	if (!details_trace) {
 		/* Not found: create one */
-		*unique_id = ctx->details_comp->next_unique_trace_id;
-		details_trace = create_details_trace(*unique_id);
+		details_trace = create_details_trace(
+			details_comp->next_unique_trace_id);
 		if (!details_trace) {
 			goto error;
 		}
 
-		ctx->details_comp->next_unique_trace_id++;
+		details_comp->next_unique_trace_id++;
 
 		/* Register trace destruction listener if there's none */
 		if (bt_trace_add_destruction_listener(trace,
 				trace_destruction_listener,
-				ctx->details_comp,
+				details_comp,
 				&details_trace->trace_destruction_listener_id)) {
 			goto error;
 		}
@@ -195,25 +217,38 @@ int details_trace_unique_id(struct details_write_ctx *ctx,
 		BT_ASSERT(details_trace->trace_destruction_listener_id !=
 			UINT64_C(-1));
 
-		/* Move to hash table */
-		g_hash_table_insert(ctx->details_comp->traces, (gpointer) trace,
+		/* Insert into hash table (becomes the owner) */
+		g_hash_table_insert(details_comp->traces, (gpointer) trace,
 			details_trace);
-		details_trace = NULL;
-	} else {
-		/* Found */
-		details_trace = g_hash_table_lookup(
-			ctx->details_comp->traces, trace);
-		*unique_id = details_trace->unique_id;
-		details_trace = NULL;
 	}
 
+	details_comp->last_trace = trace;
+	details_comp->last_details_trace = details_trace;
 	goto end;
 
 error:
-	ret = -1;
+	details_destroy_details_trace(details_trace);
+	details_trace = NULL;
 
 end:
-	g_free(details_trace);
+	return details_trace;
+}
+
+int details_trace_unique_id(struct details_write_ctx *ctx,
+		const bt_trace *trace, uint64_t *unique_id)
+{
+	int ret = 0;
+	struct details_trace *details_trace;
 
+	BT_ASSERT_DBG(unique_id);
+	details_trace = details_borrow_details_trace(ctx, trace);
+	if (!details_trace) {
+		ret = -1;
+		goto end;
+	}
+
+	*unique_id = details_trace->unique_id;
+
+end:
 	return ret;
 }
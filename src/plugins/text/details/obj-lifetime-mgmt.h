@@ -40,6 +40,13 @@ bool details_need_to_write_trace_class(struct details_write_ctx *ctx,
 int details_did_write_trace_class(struct details_write_ctx *ctx,
 		const bt_trace_class *tc);
 
+/*
+ * Returns the entry of `trace` in the `traces` hash table of the
+ * component, creating it (with a new unique ID) if none exists.
+ */
+struct details_trace *details_borrow_details_trace(
+		struct details_write_ctx *ctx, const bt_trace *trace);
+
 /*
  * Writes the unique trace ID of `trace` to `*unique_id`, allocating a
  * new unique ID if none exists.
@@ -50,63 +50,72 @@ void decr_indent(struct details_write_ctx *ctx)
 	decr_indent_by(ctx, 2);
 }
 
+/*
+ * Writes the digits of `value` in base `base` to `buf`, inserting `sep`
+ * between groups of `digits_per_group` digits from the right unless
+ * `sep` is the null character, and null-terminates the result.
+ *
+ * This is what sprintf() followed by bt_common_sep_digits() would
+ * write, without parsing a format string and without moving the
+ * digits afterwards.
+ */
 static inline
-void format_uint(char *buf, uint64_t value, unsigned int base)
+void format_digits(char *buf, uint64_t value, unsigned int base,
+		unsigned int digits_per_group, char sep)
 {
-	const char *spec = "%" PRIu64;
-	char *buf_start = buf;
-	unsigned int digits_per_group = 3;
-	char sep = ',';
-	bool sep_digits = true;
+	/* Enough for 64 binary digits and their separators */
+	char tmp[128];
+	char *wr = tmp + sizeof(tmp);
+	unsigned int digit_count = 0;
+	size_t len;
+
+	do {
+		if (sep != '\0' && digit_count > 0 &&
+				digit_count % digits_per_group == 0) {
+			*--wr = sep;
+		}
 
+		*--wr = "0123456789abcdef"[value % base];
+		value /= base;
+		digit_count++;
+	} while (value > 0);
+
+	len = tmp + sizeof(tmp) - wr;
+	memcpy(buf, wr, len);
+	buf[len] = '\0';
+}
+
+static inline
+void format_uint(char *buf, uint64_t value, unsigned int base)
+{
 	switch (base) {
 	case 2:
 	case 16:
 		/* TODO: Support binary format */
-		spec = "%" PRIx64;
-		strcpy(buf, "0x");
-		buf_start = buf + 2;
-		digits_per_group = 4;
-		sep = ':';
+		buf[0] = '0';
+		buf[1] = 'x';
+		format_digits(buf + 2, value, 16, 4, ':');
 		break;
 	case 8:
-		spec = "%" PRIo64;
-		strcpy(buf, "0");
-		buf_start = buf + 1;
-		sep = ':';
+		buf[0] = '0';
+		format_digits(buf + 1, value, 8, 3, ':');
 		break;
 	case 10:
-		if (value <= 9999) {
-			/*
-			 * Do not insert digit separators for numbers
-			 * under 10,000 as it looks weird.
-			 */
-			sep_digits = false;
-		}
-
+		/*
+		 * Do not insert digit separators for numbers under
+		 * 10,000 as it looks weird.
+		 */
+		format_digits(buf, value, 10, 3, value <= 9999 ? '\0' : ',');
 		break;
 	default:
 		bt_common_abort();
 	}
-
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wformat-nonliteral"
-	sprintf(buf_start, spec, value);
-#pragma GCC diagnostic pop
-
-	if (sep_digits) {
-		bt_common_sep_digits(buf_start, digits_per_group, sep);
-	}
 }
 
 static inline
 void format_int(char *buf, int64_t value, unsigned int base)
 {
-	const char *spec = "%" PRIu64;
 	char *buf_start = buf;
-	unsigned int digits_per_group = 3;
-	char sep = ',';
-	bool sep_digits = true;
 	uint64_t abs_value = value < 0 ? (uint64_t) -value : (uint64_t) value;
 
 	if (value < 0) {
@@ -118,41 +127,25 @@ void format_int(char *buf, int64_t value, unsigned int base)
 	case 2:
 	case 16:
 		/* TODO: Support binary format */
-		spec = "%" PRIx64;
-		strcpy(buf_start, "0x");
-		buf_start += 2;
-		digits_per_group = 4;
-		sep = ':';
+		buf_start[0] = '0';
+		buf_start[1] = 'x';
+		format_digits(buf_start + 2, abs_value, 16, 4, ':');
 		break;
 	case 8:
-		spec = "%" PRIo64;
-		strcpy(buf_start, "0");
-		buf_start++;
-		sep = ':';
+		buf_start[0] = '0';
+		format_digits(buf_start + 1, abs_value, 8, 3, ':');
 		break;
 	case 10:
-		if (value >= -9999 && value <= 9999) {
-			/*
-			 * Do not insert digit separators for numbers
-			 * over -10,000 and under 10,000 as it looks
-			 * weird.
-			 */
-			sep_digits = false;
-		}
-
+		/*
+		 * Do not insert digit separators for numbers over
+		 * -10,000 and under 10,000 as it looks weird.
+		 */
+		format_digits(buf_start, abs_value, 10, 3,
+			value >= -9999 && value <= 9999 ? '\0' : ',');
 		break;
 	default:
 		bt_common_abort();
 	}
-
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wformat-nonliteral"
-	sprintf(buf_start, spec, abs_value);
-#pragma GCC diagnostic pop
-
-	if (sep_digits) {
-		bt_common_sep_digits(buf_start, digits_per_group, sep);
-	}
 }
 
 static inline
@@ -2280,6 +2273,84 @@ void write_root_field(struct details_write_ctx *ctx, const char *name,
 	write_nl(ctx);
 }
 
+/*
+ * Writes the part of an event message which only depends on its class
+ * `ec`: object type name, event class name and ID, and what follows
+ * until the fields.
+ */
+static
+void render_event_class_header(struct details_write_ctx *ctx,
+		const bt_event_class *ec)
+{
+	const char *ec_name;
+
+	write_obj_type_name(ctx, "Event");
+	ec_name = bt_event_class_get_name(ec);
+	if (ec_name) {
+		g_string_append_printf(ctx->str, " `%s%s%s`",
+			color_fg_green(ctx), ec_name, color_reset(ctx));
+	}
+
+	g_string_append(ctx->str, " (");
+
+	if (!ctx->details_comp->cfg.compact) {
+		g_string_append(ctx->str, "Class ID ");
+	}
+
+	write_uint_prop_value(ctx, bt_event_class_get_id(ec));
+	g_string_append(ctx->str, ")");
+
+	if (ctx->details_comp->cfg.compact) {
+		write_nl(ctx);
+	} else {
+		g_string_append(ctx->str, ":\n");
+	}
+}
+
+/*
+ * Writes the part of an event message which only depends on its class
+ * `ec`, which belongs to the class of `trace`, rendering it once with
+ * render_event_class_header() when first encountering `ec`.
+ */
+static
+int write_event_class_header(struct details_write_ctx *ctx,
+		const bt_trace *trace, const bt_event_class *ec)
+{
+	int ret = 0;
+	struct details_trace *details_trace;
+	GString *header;
+
+	details_trace = details_borrow_details_trace(ctx, trace);
+	if (!details_trace) {
+		ret = -1;
+		goto end;
+	}
+
+	header = g_hash_table_lookup(details_trace->ec_headers, ec);
+	if (!header) {
+		struct details_write_ctx header_ctx = *ctx;
+
+		header = g_string_new(NULL);
+		if (!header) {
+			ret = -1;
+			goto end;
+		}
+
+		header_ctx.str = header;
+		header_ctx.indent_level = 0;
+		render_event_class_header(&header_ctx, ec);
+
+		/* Move to hash table */
+		g_hash_table_insert(details_trace->ec_headers, (gpointer) ec,
+			header);
+	}
+
+	g_string_append_len(ctx->str, header->str, header->len);
+
+end:
+	return ret;
+}
+
 static
 int write_event_message(struct details_write_ctx *ctx,
 		const bt_message *msg)
@@ -2290,12 +2361,15 @@ int write_event_message(struct details_write_ctx *ctx,
 	const bt_event_class *ec = bt_event_borrow_class_const(event);
 	const bt_stream_class *sc = bt_event_class_borrow_stream_class_const(ec);
 	const bt_trace_class *tc = bt_stream_class_borrow_trace_class_const(sc);
-	const char *ec_name;
 	const bt_field *field;
 
-	ret = try_write_meta(ctx, tc, sc, ec);
-	if (ret) {
-		goto end;
+	if (ec != ctx->details_comp->last_written_ec) {
+		ret = try_write_meta(ctx, tc, sc, ec);
+		if (ret) {
+			goto end;
+		}
+
+		ctx->details_comp->last_written_ec = ec;
 	}
 
 	if (!ctx->details_comp->cfg.with_data) {
@@ -2324,29 +2398,17 @@ int write_event_message(struct details_write_ctx *ctx,
 	}
 
 	/* Write object's basic properties */
-	write_obj_type_name(ctx, "Event");
-	ec_name = bt_event_class_get_name(ec);
-	if (ec_name) {
-		g_string_append_printf(ctx->str, " `%s%s%s`",
-			color_fg_green(ctx), ec_name, color_reset(ctx));
-	}
-
-	g_string_append(ctx->str, " (");
-
-	if (!ctx->details_comp->cfg.compact) {
-		g_string_append(ctx->str, "Class ID ");
+	ret = write_event_class_header(ctx, bt_stream_borrow_trace_const(stream),
+		ec);
+	if (ret) {
+		goto end;
 	}
 
-	write_uint_prop_value(ctx, bt_event_class_get_id(ec));
-	g_string_append(ctx->str, ")");
-
 	if (ctx->details_comp->cfg.compact) {
-		write_nl(ctx);
 		goto end;
 	}
 
 	/* Write fields */
-	g_string_append(ctx->str, ":\n");
 	incr_indent(ctx);
 	field = bt_event_borrow_common_context_field_const(event);
 	if (field) {
@@ -2955,17 +3017,5 @@ int details_write_message(struct details_comp *details_comp,
 		bt_common_abort();
 	}
 
-	/*
-	 * If this component printed at least one character so far, and
-	 * we're not in compact mode, and there's something in the
-	 * output buffer for this message, then prepend a newline to the
-	 * output buffer to visually separate message blocks.
-	 */
-	if (details_comp->printed_something && !details_comp->cfg.compact &&
-			details_comp->str->len > 0) {
-		/* TODO: Optimize this */
-		g_string_prepend_c(details_comp->str, '\n');
-	}
-
 	return ret;
 }
@@ -15,12 +15,13 @@
 #include <stdbool.h>
 #include <string.h>
 #include <ctype.h>
+#include <errno.h>
 #include <stdio.h>
+#include <unistd.h>
 #include "common/common.h"
 #include "common/assert.h"
 #include <babeltrace2/babeltrace.h>
 #include "compat/utc.h"
-#include "compat/stdio.h"
 #include <glib.h>
 #include "plugins/common/param-validation/param-validation.h"
 
@@ -29,6 +30,9 @@
 #define NSEC_PER_SEC 1000000000ULL
 #define USEC_PER_SEC 1000000UL
 
+/* Initial size of the input buffer of a message iterator (bytes) */
+#define INPUT_BUF_INIT_SIZE (1024 * 1024)
+
 struct dmesg_component;
 
 struct dmesg_msg_iter {
@@ -37,8 +41,23 @@ struct dmesg_msg_iter {
 	/* Weak */
 	bt_self_message_iterator *self_msg_iter;
 
-	char *linebuf;
-	size_t linebuf_len;
+	/*
+	 * Input buffer: the bytes from the offset `buf_begin` to the
+	 * offset `buf_end` are read from `fp`, but not consumed yet.
+	 *
+	 * The message iterator reads large blocks of the input file
+	 * directly from its descriptor into this buffer, growing it
+	 * when a single line doesn't fit, and then splits lines within
+	 * it.
+	 */
+	char *buf;
+	size_t buf_size;
+	size_t buf_begin;
+	size_t buf_end;
+
+	/* True if `buf` contains the last bytes of `fp` */
+	bool eof;
+
 	FILE *fp;
 	bt_message *tmp_event_msg;
 	uint64_t last_clock_value;
@@ -454,67 +473,154 @@ void dmesg_finalize(bt_self_component_source *self_comp)
 		bt_self_component_source_as_self_component(self_comp)));
 }
 
+/*
+ * Skips the whitespaces at `*p` (not beyond `end`), like scanf() does
+ * for a conversion specification, and then parses an unsigned decimal
+ * integer, advancing `*p` after it.
+ *
+ * Returns false if there's no digit.
+ */
 static
-bt_message *create_init_event_msg_from_line(
-		struct dmesg_msg_iter *msg_iter,
-		const char *line, const char **new_start)
+bool parse_uint(const char **p, const char *end, uint64_t *val)
 {
-	bt_event *event;
-	bt_message *msg = NULL;
-	bool has_timestamp = false;
-	unsigned long sec, usec, msec;
-	unsigned int year, mon, mday, hour, min;
-	uint64_t ts = 0;
-	int ret = 0;
-	struct dmesg_component *dmesg_comp = msg_iter->dmesg_comp;
+	const char *ch = *p;
 
-	*new_start = line;
+	while (ch < end && isspace((unsigned char) *ch)) {
+		ch++;
+	}
 
-	if (dmesg_comp->params.no_timestamp) {
-		goto skip_ts;
+	if (ch == end || !isdigit((unsigned char) *ch)) {
+		return false;
 	}
 
-	/* Extract time from input line */
-	if (sscanf(line, "[%lu.%lu] ", &sec, &usec) == 2) {
-		ts = (uint64_t) sec * USEC_PER_SEC + (uint64_t) usec;
+	*val = 0;
+
+	for (; ch < end && isdigit((unsigned char) *ch); ch++) {
+		*val = *val * 10 + (uint64_t) (*ch - '0');
+	}
+
+	*p = ch;
+	return true;
+}
+
+/*
+ * Advances `*p` (not beyond `end`) after the character `c`.
+ *
+ * Returns false if `*p` doesn't point to `c`.
+ */
+static
+bool parse_char(const char **p, const char *end, char c)
+{
+	if (*p == end || **p != c) {
+		return false;
+	}
+
+	(*p)++;
+	return true;
+}
+
+/*
+ * Parses the timestamp at the beginning of the line `line` of length
+ * `len`, either `[SEC.USEC]` or `[YEAR-MON-MDAY HOUR:MIN:SEC.MSEC]`,
+ * setting `*ts` to its value (ns).
+ *
+ * Returns false if the line doesn't start with a timestamp.
+ */
+static
+bool parse_line_timestamp(const char *line, size_t len, uint64_t *ts)
+{
+	const char *end = line + len;
+	const char *p = line;
+	uint64_t sec, usec, msec;
+	uint64_t year, mon, mday, hour, min;
+
+	if (parse_char(&p, end, '[') &&
+			parse_uint(&p, end, &sec) &&
+			parse_char(&p, end, '.') &&
+			parse_uint(&p, end, &usec)) {
+		*ts = sec * USEC_PER_SEC + usec;
 
 		/*
 		 * The clock class we use has a 1 GHz frequency: convert
 		 * from µs to ns.
 		 */
-		ts *= NSEC_PER_USEC;
-		has_timestamp = true;
-	} else if (sscanf(line, "[%u-%u-%u %u:%u:%lu.%lu] ",
-			&year, &mon, &mday, &hour, &min,
-			&sec, &msec) == 7) {
+		*ts *= NSEC_PER_USEC;
+		return true;
+	}
+
+	p = line;
+
+	if (parse_char(&p, end, '[') &&
+			parse_uint(&p, end, &year) &&
+			parse_char(&p, end, '-') &&
+			parse_uint(&p, end, &mon) &&
+			parse_char(&p, end, '-') &&
+			parse_uint(&p, end, &mday) &&
+			parse_uint(&p, end, &hour) &&
+			parse_char(&p, end, ':') &&
+			parse_uint(&p, end, &min) &&
+			parse_char(&p, end, ':') &&
+			parse_uint(&p, end, &sec) &&
+			parse_char(&p, end, '.') &&
+			parse_uint(&p, end, &msec)) {
 		time_t ep_sec;
 		struct tm ti;
 
 		memset(&ti, 0, sizeof(ti));
-		ti.tm_year = year - 1900;	/* From 1900 */
-		ti.tm_mon = mon - 1;		/* 0 to 11 */
-		ti.tm_mday = mday;
-		ti.tm_hour = hour;
-		ti.tm_min = min;
-		ti.tm_sec = sec;
+		ti.tm_year = (int) year - 1900;	/* From 1900 */
+		ti.tm_mon = (int) mon - 1;	/* 0 to 11 */
+		ti.tm_mday = (int) mday;
+		ti.tm_hour = (int) hour;
+		ti.tm_min = (int) min;
+		ti.tm_sec = (int) sec;
 
 		ep_sec = bt_timegm(&ti);
 		if (ep_sec != (time_t) -1) {
-			ts = (uint64_t) ep_sec * NSEC_PER_SEC
-				+ (uint64_t) msec * NSEC_PER_MSEC;
+			*ts = (uint64_t) ep_sec * NSEC_PER_SEC
+				+ msec * NSEC_PER_MSEC;
+		} else {
+			*ts = 0;
 		}
 
-		has_timestamp = true;
+		return true;
 	}
 
-	if (has_timestamp) {
-		/* Set new start for the message portion of the line */
-		*new_start = strchr(line, ']');
-		BT_ASSERT_DBG(*new_start);
-		(*new_start)++;
+	return false;
+}
+
+static
+bt_message *create_init_event_msg_from_line(
+		struct dmesg_msg_iter *msg_iter,
+		const char *line, size_t len, const char **new_start)
+{
+	bt_event *event;
+	bt_message *msg = NULL;
+	bool has_timestamp = false;
+	uint64_t ts = 0;
+	int ret = 0;
+	struct dmesg_component *dmesg_comp = msg_iter->dmesg_comp;
+
+	*new_start = line;
 
-		if ((*new_start)[0] == ' ') {
-			(*new_start)++;
+	if (dmesg_comp->params.no_timestamp) {
+		goto skip_ts;
+	}
+
+	/* Extract time from input line */
+	if (parse_line_timestamp(line, len, &ts)) {
+		const char *closing_bracket = memchr(line, ']', len);
+
+		if (closing_bracket) {
+			has_timestamp = true;
+
+			/* Set new start for the message portion of the line */
+			*new_start = closing_bracket + 1;
+
+			if (*new_start < line + len && (*new_start)[0] == ' ') {
+				(*new_start)++;
+			}
+		} else {
+			ts = 0;
 		}
 	}
 
@@ -559,11 +665,11 @@ end:
 
 static
 int fill_event_payload_from_line(struct dmesg_component *dmesg_comp,
-		const char *line, bt_event *event)
+		const char *line, size_t len, bt_event *event)
 {
 	bt_field *ep_field = NULL;
 	bt_field *str_field = NULL;
-	size_t len;
+	const char *nul;
 	int ret;
 
 	ep_field = bt_event_borrow_payload_field(event);
@@ -576,8 +682,13 @@ int fill_event_payload_from_line(struct dmesg_component *dmesg_comp,
 		goto error;
 	}
 
-	len = strlen(line);
-	if (line[len - 1] == '\n') {
+	/* The payload ends at the first null character, if any */
+	nul = memchr(line, '\0', len);
+	if (nul) {
+		len = nul - line;
+	}
+
+	if (len > 0 && line[len - 1] == '\n') {
 		/* Do not include the newline character in the payload */
 		len--;
 	}
@@ -601,7 +712,8 @@ end:
 
 static
 bt_message *create_msg_from_line(
-		struct dmesg_msg_iter *dmesg_msg_iter, const char *line)
+		struct dmesg_msg_iter *dmesg_msg_iter, const char *line,
+		size_t len)
 {
 	struct dmesg_component *dmesg_comp = dmesg_msg_iter->dmesg_comp;
 	bt_event *event = NULL;
@@ -610,7 +722,7 @@ bt_message *create_msg_from_line(
 	int ret;
 
 	msg = create_init_event_msg_from_line(dmesg_msg_iter,
-		line, &new_start);
+		line, len, &new_start);
 	if (!msg) {
 		BT_COMP_LOGE_APPEND_CAUSE(dmesg_comp->self_comp,
 			"Cannot create and initialize event message from line.");
@@ -619,7 +731,8 @@ bt_message *create_msg_from_line(
 
 	event = bt_message_event_borrow_event(msg);
 	BT_ASSERT_DBG(event);
-	ret = fill_event_payload_from_line(dmesg_comp, new_start, event);
+	ret = fill_event_payload_from_line(dmesg_comp, new_start,
+		len - (new_start - line), event);
 	if (ret) {
 		BT_COMP_LOGE_APPEND_CAUSE(dmesg_comp->self_comp,
 			"Cannot fill event payload field from line: ret=%d", ret);
@@ -654,7 +767,7 @@ void destroy_dmesg_msg_iter(struct dmesg_msg_iter *dmesg_msg_iter)
 	}
 
 	bt_message_put_ref(dmesg_msg_iter->tmp_event_msg);
-	free(dmesg_msg_iter->linebuf);
+	g_free(dmesg_msg_iter->buf);
 	g_free(dmesg_msg_iter);
 }
 
@@ -696,6 +809,16 @@ bt_message_iterator_class_initialize_method_status dmesg_msg_iter_init(
 		}
 	}
 
+	dmesg_msg_iter->buf_size = INPUT_BUF_INIT_SIZE;
+	dmesg_msg_iter->buf = g_malloc(dmesg_msg_iter->buf_size);
+	if (!dmesg_msg_iter->buf) {
+		BT_COMP_LOGE_APPEND_CAUSE(self_comp,
+			"Failed to allocate input buffer: size=%zu",
+			dmesg_msg_iter->buf_size);
+		status = BT_MESSAGE_ITERATOR_CLASS_INITIALIZE_METHOD_STATUS_MEMORY_ERROR;
+		goto error;
+	}
+
 	bt_self_message_iterator_set_data(self_msg_iter,
 		dmesg_msg_iter);
 
@@ -717,12 +840,102 @@ void dmesg_msg_iter_finalize(
 		priv_msg_iter));
 }
 
+/*
+ * Sets `*line` and `*len` to the next line of the input of
+ * `dmesg_msg_iter`, including its newline character, if any, reading
+ * the next block of the input file if needed.
+ *
+ * `*line` remains valid until the next call.
+ *
+ * Returns 1 if there's no more line, 0 on success, or a negative value
+ * on error.
+ */
+static
+int read_line(struct dmesg_msg_iter *dmesg_msg_iter, const char **line,
+		size_t *len)
+{
+	struct dmesg_component *dmesg_comp = dmesg_msg_iter->dmesg_comp;
+	int ret = 0;
+
+	while (true) {
+		char *begin = dmesg_msg_iter->buf + dmesg_msg_iter->buf_begin;
+		size_t avail = dmesg_msg_iter->buf_end -
+			dmesg_msg_iter->buf_begin;
+		const char *newline = memchr(begin, '\n', avail);
+		ssize_t read_len;
+
+		if (newline) {
+			*line = begin;
+			*len = newline - begin + 1;
+			dmesg_msg_iter->buf_begin += *len;
+			goto end;
+		}
+
+		if (dmesg_msg_iter->eof) {
+			if (avail == 0) {
+				ret = 1;
+				goto end;
+			}
+
+			/* Last line without a newline character */
+			*line = begin;
+			*len = avail;
+			dmesg_msg_iter->buf_begin = dmesg_msg_iter->buf_end;
+			goto end;
+		}
+
+		if (dmesg_msg_iter->buf_end == dmesg_msg_iter->buf_size) {
+			if (dmesg_msg_iter->buf_begin > 0) {
+				/* Move the partial line to the beginning */
+				memmove(dmesg_msg_iter->buf, begin, avail);
+				dmesg_msg_iter->buf_begin = 0;
+				dmesg_msg_iter->buf_end = avail;
+			} else {
+				/* Partial line fills the buffer: grow it */
+				dmesg_msg_iter->buf_size *= 2;
+				dmesg_msg_iter->buf = g_realloc(
+					dmesg_msg_iter->buf,
+					dmesg_msg_iter->buf_size);
+			}
+		}
+
+		/*
+		 * Read directly from the file descriptor to get what's
+		 * available without waiting for a full buffer, for
+		 * example when reading a pipe.
+		 */
+		do {
+			read_len = read(fileno(dmesg_msg_iter->fp),
+				dmesg_msg_iter->buf + dmesg_msg_iter->buf_end,
+				dmesg_msg_iter->buf_size -
+					dmesg_msg_iter->buf_end);
+		} while (read_len < 0 && errno == EINTR);
+
+		if (read_len < 0) {
+			BT_COMP_LOGE_APPEND_CAUSE_ERRNO(dmesg_comp->self_comp,
+				"Cannot read input file", ".");
+			ret = -1;
+			goto end;
+		}
+
+		if (read_len == 0) {
+			dmesg_msg_iter->eof = true;
+		}
+
+		dmesg_msg_iter->buf_end += read_len;
+	}
+
+end:
+	return ret;
+}
+
 static
 bt_message_iterator_class_next_method_status dmesg_msg_iter_next_one(
 		struct dmesg_msg_iter *dmesg_msg_iter,
 		bt_message **msg)
 {
-	ssize_t len;
+	const char *line;
+	size_t len;
 	struct dmesg_component *dmesg_comp;
 	bt_message_iterator_class_next_method_status status;
 
@@ -743,34 +956,27 @@ bt_message_iterator_class_next_method_status dmesg_msg_iter_next_one(
 	while (true) {
 		const char *ch;
 		bool only_spaces = true;
-
-		len = bt_getline(&dmesg_msg_iter->linebuf,
-			&dmesg_msg_iter->linebuf_len, dmesg_msg_iter->fp);
-		if (len < 0) {
-			if (errno == EINVAL) {
-				status = BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_ERROR;
-				goto end;
-			} else if (errno == ENOMEM) {
-				status = BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_MEMORY_ERROR;
+		int ret;
+
+		ret = read_line(dmesg_msg_iter, &line, &len);
+		if (ret < 0) {
+			status = BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_ERROR;
+			goto end;
+		} else if (ret > 0) {
+			if (dmesg_msg_iter->state == STATE_EMIT_STREAM_BEGINNING) {
+				/* Stream did not even begin */
+				status = BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_END;
 				goto end;
 			} else {
-				if (dmesg_msg_iter->state == STATE_EMIT_STREAM_BEGINNING) {
-					/* Stream did not even begin */
-					status = BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_END;
-					goto end;
-				} else {
-					/* End stream now */
-					dmesg_msg_iter->state =
-						STATE_EMIT_STREAM_END;
-					goto handle_state;
-				}
+				/* End stream now */
+				dmesg_msg_iter->state =
+					STATE_EMIT_STREAM_END;
+				goto handle_state;
 			}
 		}
 
-		BT_ASSERT_DBG(dmesg_msg_iter->linebuf);
-
 		/* Ignore empty lines, once trimmed */
-		for (ch = dmesg_msg_iter->linebuf; *ch != '\0'; ch++) {
+		for (ch = line; ch < line + len && *ch != '\0'; ch++) {
 			if (!isspace((unsigned char) *ch)) {
 				only_spaces = false;
 				break;
@@ -783,12 +989,12 @@ bt_message_iterator_class_next_method_status dmesg_msg_iter_next_one(
 	}
 
 	dmesg_msg_iter->tmp_event_msg = create_msg_from_line(
-		dmesg_msg_iter, dmesg_msg_iter->linebuf);
+		dmesg_msg_iter, line, len);
 	if (!dmesg_msg_iter->tmp_event_msg) {
 		BT_COMP_LOGE_APPEND_CAUSE(dmesg_comp->self_comp,
 			"Cannot create event message from line: "
-			"dmesg-comp-addr=%p, line=\"%s\"", dmesg_comp,
-			dmesg_msg_iter->linebuf);
+			"dmesg-comp-addr=%p, line=\"%.*s\"", dmesg_comp,
+			(int) len, line);
 		status = BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_ERROR;
 		goto end;
 	}
@@ -894,11 +1100,28 @@ dmesg_msg_iter_seek_beginning(
 {
 	struct dmesg_msg_iter *dmesg_msg_iter =
 		bt_self_message_iterator_get_data(self_msg_iter);
+	struct dmesg_component *dmesg_comp = dmesg_msg_iter->dmesg_comp;
+	bt_message_iterator_class_seek_beginning_method_status status =
+		BT_MESSAGE_ITERATOR_CLASS_SEEK_BEGINNING_METHOD_STATUS_OK;
 
 	BT_ASSERT(!dmesg_msg_iter->dmesg_comp->params.read_from_stdin);
 
+	/* Discard what's buffered and read the file again */
+	if (lseek(fileno(dmesg_msg_iter->fp), 0, SEEK_SET) < 0) {
+		BT_COMP_LOGE_APPEND_CAUSE_ERRNO(dmesg_comp->self_comp,
+			"Cannot seek the beginning of the input file",
+			": path=\"%s\"", dmesg_comp->params.path->str);
+		status = BT_MESSAGE_ITERATOR_CLASS_SEEK_BEGINNING_METHOD_STATUS_ERROR;
+		goto end;
+	}
+
+	dmesg_msg_iter->buf_begin = 0;
+	dmesg_msg_iter->buf_end = 0;
+	dmesg_msg_iter->eof = false;
 	BT_MESSAGE_PUT_REF_AND_RESET(dmesg_msg_iter->tmp_event_msg);
 	dmesg_msg_iter->last_clock_value = 0;
 	dmesg_msg_iter->state = STATE_EMIT_STREAM_BEGINNING;
-	return BT_MESSAGE_ITERATOR_CLASS_SEEK_BEGINNING_METHOD_STATUS_OK;
+
+end:
+	return status;
 }
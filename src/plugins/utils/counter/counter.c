@@ -98,6 +98,476 @@ void try_print_count(struct counter *counter, uint64_t msg_count)
 	}
 }
 
+static
+void destroy_event_class_stats(gpointer data)
+{
+	struct counter_event_class_stats *ec_stats = data;
+
+	bt_event_class_put_ref(ec_stats->event_class);
+	g_free(ec_stats);
+}
+
+static
+void destroy_stream_stats(gpointer data)
+{
+	struct counter_stream_stats *stream_stats = data;
+
+	if (stream_stats->name) {
+		g_string_free(stream_stats->name, TRUE);
+	}
+
+	if (stream_stats->trace_name) {
+		g_string_free(stream_stats->trace_name, TRUE);
+	}
+
+	g_free(stream_stats);
+}
+
+static
+struct counter_stream_stats *create_stream_stats(struct counter *counter,
+		const bt_stream *stream)
+{
+	const bt_stream_class *stream_class = bt_stream_borrow_class_const(stream);
+	const char *name = bt_stream_get_name(stream);
+	const char *trace_name =
+		bt_trace_get_name(bt_stream_borrow_trace_const(stream));
+	struct counter_stream_stats *stream_stats =
+		g_new0(struct counter_stream_stats, 1);
+
+	if (!stream_stats) {
+		goto error;
+	}
+
+	stream_stats->name = g_string_new(name ? name : "");
+	stream_stats->trace_name = g_string_new(trace_name ? trace_name : "");
+	if (!stream_stats->name || !stream_stats->trace_name) {
+		goto error;
+	}
+
+	stream_stats->stream_class_id = bt_stream_class_get_id(stream_class);
+	stream_stats->id = bt_stream_get_id(stream);
+	stream_stats->has_default_clock_class =
+		bt_stream_class_borrow_default_clock_class_const(stream_class);
+	stream_stats->min_packet_events = UINT64_MAX;
+	g_ptr_array_add(counter->stats.streams, stream_stats);
+	g_hash_table_insert(counter->stats.active_streams, (gpointer) stream,
+		stream_stats);
+	goto end;
+
+error:
+	if (stream_stats) {
+		destroy_stream_stats(stream_stats);
+		stream_stats = NULL;
+	}
+
+end:
+	return stream_stats;
+}
+
+/*
+ * Returns the statistics of the active stream `stream`, creating them
+ * if needed, or `NULL` on memory error.
+ */
+static
+struct counter_stream_stats *borrow_stream_stats(struct counter *counter,
+		const bt_stream *stream)
+{
+	struct counter_stream_stats *stream_stats;
+
+	if (stream == counter->stats.last_stream) {
+		return counter->stats.last_stream_stats;
+	}
+
+	stream_stats = g_hash_table_lookup(counter->stats.active_streams,
+		stream);
+	if (!stream_stats) {
+		stream_stats = create_stream_stats(counter, stream);
+		if (!stream_stats) {
+			goto end;
+		}
+	}
+
+	counter->stats.last_stream = stream;
+	counter->stats.last_stream_stats = stream_stats;
+
+end:
+	return stream_stats;
+}
+
+/*
+ * Returns the statistics of the event class `event_class`, creating
+ * them if needed, or `NULL` on memory error.
+ */
+static
+struct counter_event_class_stats *borrow_event_class_stats(
+		struct counter *counter, const bt_event_class *event_class)
+{
+	struct counter_event_class_stats *ec_stats;
+
+	if (event_class == counter->stats.last_event_class) {
+		return counter->stats.last_event_class_stats;
+	}
+
+	ec_stats = g_hash_table_lookup(counter->stats.event_classes,
+		event_class);
+	if (!ec_stats) {
+		ec_stats = g_new0(struct counter_event_class_stats, 1);
+		if (!ec_stats) {
+			goto end;
+		}
+
+		ec_stats->event_class = event_class;
+		bt_event_class_get_ref(event_class);
+		g_hash_table_insert(counter->stats.event_classes,
+			(gpointer) event_class, ec_stats);
+	}
+
+	counter->stats.last_event_class = event_class;
+	counter->stats.last_event_class_stats = ec_stats;
+
+end:
+	return ec_stats;
+}
+
+static
+void end_stream_stats(struct counter *counter, const bt_stream *stream)
+{
+	g_hash_table_remove(counter->stats.active_streams, stream);
+
+	if (stream == counter->stats.last_stream) {
+		counter->stats.last_stream = NULL;
+		counter->stats.last_stream_stats = NULL;
+	}
+}
+
+static
+void update_stream_time(struct counter_stream_stats *stream_stats,
+		const bt_clock_snapshot *cs)
+{
+	int64_t ns_from_origin;
+
+	if (bt_clock_snapshot_get_ns_from_origin(cs, &ns_from_origin) !=
+			BT_CLOCK_SNAPSHOT_GET_NS_FROM_ORIGIN_STATUS_OK) {
+		/* Overflow: ignore this time */
+		return;
+	}
+
+	if (!stream_stats->has_time) {
+		stream_stats->first_ns = ns_from_origin;
+		stream_stats->has_time = true;
+	}
+
+	stream_stats->last_ns = ns_from_origin;
+}
+
+/*
+ * Updates the detailed statistics of `counter` with the message `msg`.
+ *
+ * Returns false on memory error.
+ */
+static
+bool update_statistics(struct counter *counter, const bt_message *msg)
+{
+	struct counter_stream_stats *stream_stats;
+	bool ret = true;
+
+	switch (bt_message_get_type(msg)) {
+	case BT_MESSAGE_TYPE_EVENT:
+	{
+		const bt_event *event = bt_message_event_borrow_event_const(msg);
+		struct counter_event_class_stats *ec_stats;
+
+		stream_stats = borrow_stream_stats(counter,
+			bt_event_borrow_stream_const(event));
+		ec_stats = borrow_event_class_stats(counter,
+			bt_event_borrow_class_const(event));
+		if (!stream_stats || !ec_stats) {
+			ret = false;
+			goto end;
+		}
+
+		ec_stats->count++;
+		stream_stats->events++;
+		stream_stats->cur_packet_events++;
+
+		if (stream_stats->has_default_clock_class) {
+			update_stream_time(stream_stats,
+				bt_message_event_borrow_default_clock_snapshot_const(msg));
+		}
+
+		break;
+	}
+	case BT_MESSAGE_TYPE_PACKET_BEGINNING:
+		stream_stats = borrow_stream_stats(counter,
+			bt_packet_borrow_stream_const(
+				bt_message_packet_beginning_borrow_packet_const(msg)));
+		if (!stream_stats) {
+			ret = false;
+			goto end;
+		}
+
+		stream_stats->cur_packet_events = 0;
+		break;
+	case BT_MESSAGE_TYPE_PACKET_END:
+		stream_stats = borrow_stream_stats(counter,
+			bt_packet_borrow_stream_const(
+				bt_message_packet_end_borrow_packet_const(msg)));
+		if (!stream_stats) {
+			ret = false;
+			goto end;
+		}
+
+		stream_stats->packets++;
+		stream_stats->total_packet_events +=
+			stream_stats->cur_packet_events;
+		stream_stats->min_packet_events = MIN(
+			stream_stats->min_packet_events,
+			stream_stats->cur_packet_events);
+		stream_stats->max_packet_events = MAX(
+			stream_stats->max_packet_events,
+			stream_stats->cur_packet_events);
+		stream_stats->cur_packet_events = 0;
+		break;
+	case BT_MESSAGE_TYPE_STREAM_BEGINNING:
+		if (!borrow_stream_stats(counter,
+				bt_message_stream_beginning_borrow_stream_const(msg))) {
+			ret = false;
+			goto end;
+		}
+
+		break;
+	case BT_MESSAGE_TYPE_STREAM_END:
+		end_stream_stats(counter,
+			bt_message_stream_end_borrow_stream_const(msg));
+		break;
+	case BT_MESSAGE_TYPE_DISCARDED_EVENTS:
+	{
+		uint64_t count = 1;
+
+		stream_stats = borrow_stream_stats(counter,
+			bt_message_discarded_events_borrow_stream_const(msg));
+		if (!stream_stats) {
+			ret = false;
+			goto end;
+		}
+
+		(void) bt_message_discarded_events_get_count(msg, &count);
+		stream_stats->disc_events += count;
+		break;
+	}
+	case BT_MESSAGE_TYPE_DISCARDED_PACKETS:
+	{
+		uint64_t count = 1;
+
+		stream_stats = borrow_stream_stats(counter,
+			bt_message_discarded_packets_borrow_stream_const(msg));
+		if (!stream_stats) {
+			ret = false;
+			goto end;
+		}
+
+		(void) bt_message_discarded_packets_get_count(msg, &count);
+		stream_stats->disc_packets += count;
+		break;
+	}
+	default:
+		break;
+	}
+
+end:
+	return ret;
+}
+
+static
+gint compare_event_class_stats(gconstpointer a, gconstpointer b)
+{
+	const struct counter_event_class_stats *ec_stats_a =
+		*((const struct counter_event_class_stats **) a);
+	const struct counter_event_class_stats *ec_stats_b =
+		*((const struct counter_event_class_stats **) b);
+
+	/* Descending count */
+	if (ec_stats_a->count > ec_stats_b->count) {
+		return -1;
+	} else if (ec_stats_a->count < ec_stats_b->count) {
+		return 1;
+	}
+
+	return 0;
+}
+
+static
+void print_rate(const char *what, uint64_t count, uint64_t duration_ns)
+{
+	if (duration_ns == 0) {
+		return;
+	}
+
+	printf("%15.1f %s/s\n",
+		(double) count * 1e9 / (double) duration_ns, what);
+}
+
+static
+void print_event_class_statistics(struct counter *counter)
+{
+	GPtrArray *ec_stats_array = g_ptr_array_new();
+	GHashTableIter iter;
+	gpointer value;
+	guint i;
+
+	if (!ec_stats_array) {
+		BT_COMP_LOGE_STR("Failed to allocate a GPtrArray.");
+		goto end;
+	}
+
+	g_hash_table_iter_init(&iter, counter->stats.event_classes);
+
+	while (g_hash_table_iter_next(&iter, NULL, &value)) {
+		g_ptr_array_add(ec_stats_array, value);
+	}
+
+	g_ptr_array_sort(ec_stats_array, compare_event_class_stats);
+	printf("\n%sEvent classes:%s\n", bt_common_color_bold(),
+		bt_common_color_reset());
+
+	for (i = 0; i < ec_stats_array->len; i++) {
+		const struct counter_event_class_stats *ec_stats =
+			ec_stats_array->pdata[i];
+		const char *name = bt_event_class_get_name(ec_stats->event_class);
+
+		printf("%15" PRIu64 " %6.2f%% %s (stream class ID %" PRIu64
+			", ID %" PRIu64 ")\n",
+			ec_stats->count,
+			counter->count.event == 0 ? 0. :
+				(double) ec_stats->count * 100. /
+				(double) counter->count.event,
+			name ? name : "(no name)",
+			bt_stream_class_get_id(
+				bt_event_class_borrow_stream_class_const(
+					ec_stats->event_class)),
+			bt_event_class_get_id(ec_stats->event_class));
+	}
+
+end:
+	if (ec_stats_array) {
+		g_ptr_array_free(ec_stats_array, TRUE);
+	}
+}
+
+static
+void print_stream_statistics(struct counter *counter)
+{
+	guint i;
+
+	printf("\n%sStreams:%s\n", bt_common_color_bold(),
+		bt_common_color_reset());
+
+	for (i = 0; i < counter->stats.streams->len; i++) {
+		const struct counter_stream_stats *stream_stats =
+			counter->stats.streams->pdata[i];
+
+		printf("  Stream `%s` (trace `%s`, stream class ID %" PRIu64
+			", ID %" PRIu64 "):\n",
+			stream_stats->name->str, stream_stats->trace_name->str,
+			stream_stats->stream_class_id, stream_stats->id);
+		printf("%15" PRIu64 " event%s\n", stream_stats->events,
+			stream_stats->events == 1 ? "" : "s");
+
+		if (stream_stats->packets > 0) {
+			printf("%15" PRIu64 " packet%s (events per packet: "
+				"min %" PRIu64 ", avg %.1f, max %" PRIu64 ")\n",
+				stream_stats->packets,
+				stream_stats->packets == 1 ? "" : "s",
+				stream_stats->min_packet_events,
+				(double) stream_stats->total_packet_events /
+					(double) stream_stats->packets,
+				stream_stats->max_packet_events);
+		}
+
+		if (stream_stats->disc_events > 0 || !counter->hide_zero) {
+			printf("%15" PRIu64 " discarded event%s\n",
+				stream_stats->disc_events,
+				stream_stats->disc_events == 1 ? "" : "s");
+		}
+
+		if (stream_stats->disc_packets > 0 || !counter->hide_zero) {
+			printf("%15" PRIu64 " discarded packet%s\n",
+				stream_stats->disc_packets,
+				stream_stats->disc_packets == 1 ? "" : "s");
+		}
+
+		if (stream_stats->has_time) {
+			const uint64_t duration_ns = (uint64_t)
+				(stream_stats->last_ns - stream_stats->first_ns);
+
+			printf("%15.9f s of trace time\n",
+				(double) duration_ns / 1e9);
+			print_rate("events", stream_stats->events, duration_ns);
+		}
+	}
+}
+
+static
+void print_total_statistics(struct counter *counter)
+{
+	bool has_time = false;
+	int64_t first_ns = 0;
+	int64_t last_ns = 0;
+	uint64_t processing_ns;
+	guint i;
+
+	for (i = 0; i < counter->stats.streams->len; i++) {
+		const struct counter_stream_stats *stream_stats =
+			counter->stats.streams->pdata[i];
+
+		if (!stream_stats->has_time) {
+			continue;
+		}
+
+		if (!has_time) {
+			first_ns = stream_stats->first_ns;
+			last_ns = stream_stats->last_ns;
+			has_time = true;
+		} else {
+			first_ns = MIN(first_ns, stream_stats->first_ns);
+			last_ns = MAX(last_ns, stream_stats->last_ns);
+		}
+	}
+
+	printf("\n%sTotal:%s\n", bt_common_color_bold(),
+		bt_common_color_reset());
+
+	if (has_time) {
+		const uint64_t duration_ns = (uint64_t) (last_ns - first_ns);
+
+		printf("%15.9f s of trace time\n", (double) duration_ns / 1e9);
+		print_rate("events", counter->count.event, duration_ns);
+	}
+
+	processing_ns = (uint64_t) (counter->stats.end_time_us -
+		counter->stats.begin_time_us) * UINT64_C(1000);
+	printf("%15.9f s of processing time\n", (double) processing_ns / 1e9);
+	print_rate("events", counter->count.event, processing_ns);
+	print_rate("messages", get_total_count(counter), processing_ns);
+}
+
+static
+void try_print_statistics(struct counter *counter)
+{
+	if (!counter->statistics || counter->stats.printed) {
+		return;
+	}
+
+	if (counter->stats.end_time_us == 0) {
+		counter->stats.end_time_us = g_get_monotonic_time();
+	}
+
+	print_event_class_statistics(counter);
+	print_stream_statistics(counter);
+	print_total_statistics(counter);
+	counter->stats.printed = true;
+}
+
 static
 void try_print_last(struct counter *counter)
 {
@@ -106,6 +576,8 @@ void try_print_last(struct counter *counter)
 	if (total != counter->last_printed_total) {
 		print_count(counter);
 	}
+
+	try_print_statistics(counter);
 }
 
 static
@@ -114,6 +586,19 @@ void destroy_private_counter_data(struct counter *counter)
 	if (counter) {
 		bt_message_iterator_put_ref(
 			counter->msg_iter);
+
+		if (counter->stats.active_streams) {
+			g_hash_table_destroy(counter->stats.active_streams);
+		}
+
+		if (counter->stats.streams) {
+			g_ptr_array_free(counter->stats.streams, TRUE);
+		}
+
+		if (counter->stats.event_classes) {
+			g_hash_table_destroy(counter->stats.event_classes);
+		}
+
 		g_free(counter);
 	}
 }
@@ -127,14 +612,14 @@ void counter_finalize(bt_self_component_sink *comp)
 			bt_self_component_sink_as_self_component(comp));
 	BT_ASSERT(counter);
 	try_print_last(counter);
-	bt_message_iterator_put_ref(counter->msg_iter);
-	g_free(counter);
+	destroy_private_counter_data(counter);
 }
 
 static
 struct bt_param_validation_map_value_entry_descr counter_params[] = {
 	{ "step", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL, { .type = BT_VALUE_TYPE_UNSIGNED_INTEGER } },
 	{ "hide-zero", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL, { .type = BT_VALUE_TYPE_BOOL } },
+	{ "statistics", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL, { .type = BT_VALUE_TYPE_BOOL } },
 	BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_END
 };
 
@@ -149,6 +634,7 @@ bt_component_class_initialize_method_status counter_init(
 	struct counter *counter = g_new0(struct counter, 1);
 	const bt_value *step = NULL;
 	const bt_value *hide_zero = NULL;
+	const bt_value *statistics = NULL;
 	enum bt_param_validation_status validation_status;
 	gchar *validate_error = NULL;
 
@@ -192,6 +678,27 @@ bt_component_class_initialize_method_status counter_init(
 		counter->hide_zero = (bool) bt_value_bool_get(hide_zero);
 	}
 
+	statistics = bt_value_map_borrow_entry_value_const(params,
+		"statistics");
+	if (statistics) {
+		counter->statistics = (bool) bt_value_bool_get(statistics);
+	}
+
+	if (counter->statistics) {
+		counter->stats.event_classes = g_hash_table_new_full(
+			g_direct_hash, g_direct_equal, NULL,
+			destroy_event_class_stats);
+		counter->stats.streams = g_ptr_array_new_with_free_func(
+			destroy_stream_stats);
+		counter->stats.active_streams = g_hash_table_new(
+			g_direct_hash, g_direct_equal);
+		if (!counter->stats.event_classes || !counter->stats.streams ||
+				!counter->stats.active_streams) {
+			status = BT_COMPONENT_CLASS_INITIALIZE_METHOD_STATUS_MEMORY_ERROR;
+			goto error;
+		}
+	}
+
 	bt_self_component_set_data(
 		bt_self_component_sink_as_self_component(component),
 		counter);
@@ -251,6 +758,10 @@ bt_component_class_sink_consume_method_status counter_consume(
 	BT_ASSERT_DBG(counter);
 	BT_ASSERT_DBG(counter->msg_iter);
 
+	if (counter->statistics && counter->stats.begin_time_us == 0) {
+		counter->stats.begin_time_us = g_get_monotonic_time();
+	}
+
 	/* Consume messages */
 	next_status = bt_message_iterator_next(
 		counter->msg_iter, &msgs, &msg_count);
@@ -293,6 +804,14 @@ bt_component_class_sink_consume_method_status counter_consume(
 				counter->count.other++;
 			}
 
+			if (counter->statistics &&
+					next_status == BT_MESSAGE_ITERATOR_NEXT_STATUS_OK &&
+					!update_statistics(counter, msg)) {
+				BT_COMP_LOGE_APPEND_CAUSE(self_comp,
+					"Failed to update statistics.");
+				next_status = BT_MESSAGE_ITERATOR_NEXT_STATUS_MEMORY_ERROR;
+			}
+
 			bt_message_put_ref(msg);
 		}
 
@@ -300,6 +819,7 @@ bt_component_class_sink_consume_method_status counter_consume(
 		break;
 	}
 	case BT_MESSAGE_ITERATOR_NEXT_STATUS_END:
+		counter->stats.end_time_us = g_get_monotonic_time();
 		try_print_last(counter);
 		break;
 	case BT_MESSAGE_ITERATOR_NEXT_STATUS_ERROR:
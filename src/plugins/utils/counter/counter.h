@@ -17,6 +17,57 @@
 extern "C" {
 #endif
 
+/* Statistics of an event class (statistics mode) */
+struct counter_event_class_stats {
+	/* Owned by this */
+	const bt_event_class *event_class;
+
+	/* Number of event messages */
+	uint64_t count;
+};
+
+/* Statistics of a stream (statistics mode) */
+struct counter_stream_stats {
+	/* Names copied at stream beginning time (empty if not available) */
+	GString *name;
+	GString *trace_name;
+
+	uint64_t stream_class_id;
+	uint64_t id;
+
+	/* Whether or not the stream class has a default clock class */
+	bool has_default_clock_class;
+
+	/* Number of event messages */
+	uint64_t events;
+
+	/* Number of packet end messages */
+	uint64_t packets;
+
+	/* Number of events of the current packet */
+	uint64_t cur_packet_events;
+
+	/* Minimum, maximum, and total number of events of ended packets */
+	uint64_t min_packet_events;
+	uint64_t max_packet_events;
+	uint64_t total_packet_events;
+
+	/*
+	 * Number of discarded events and packets, where a discarded
+	 * events/packets message without a count counts as one.
+	 */
+	uint64_t disc_events;
+	uint64_t disc_packets;
+
+	/*
+	 * Times of the first and last event messages (ns from origin),
+	 * valid if `has_time` is true.
+	 */
+	bool has_time;
+	int64_t first_ns;
+	int64_t last_ns;
+};
+
 struct counter {
 	bt_message_iterator *msg_iter;
 	struct {
@@ -34,6 +85,45 @@ struct counter {
 	uint64_t at;
 	uint64_t step;
 	bool hide_zero;
+
+	/* Whether or not to compute detailed statistics */
+	bool statistics;
+
+	struct {
+		/*
+		 * Event class (`const bt_event_class *`, weak) to
+		 * statistics (`struct counter_event_class_stats *`, owned)
+		 */
+		GHashTable *event_classes;
+
+		/*
+		 * Array of `struct counter_stream_stats *` (owned), in
+		 * stream beginning order
+		 */
+		GPtrArray *streams;
+
+		/*
+		 * Active stream (`const bt_stream *`, weak) to statistics
+		 * (`struct counter_stream_stats *`, weak)
+		 */
+		GHashTable *active_streams;
+
+		/*
+		 * Last looked up entries, most event messages having
+		 * the same event class and stream as the previous one
+		 */
+		const bt_event_class *last_event_class;
+		struct counter_event_class_stats *last_event_class_stats;
+		const bt_stream *last_stream;
+		struct counter_stream_stats *last_stream_stats;
+
+		/* Monotonic times (µs) of the first and last consumptions */
+		int64_t begin_time_us;
+		int64_t end_time_us;
+
+		bool printed;
+	} stats;
+
 	bt_logging_level log_level;
 	bt_self_component *self_comp;
 };
@@ -193,7 +193,8 @@ bool MsgIter::_canSeekBeginning()
                        });
 }
 
-void MsgIter::_seekBeginning()
+template <typename SeekFuncT>
+void MsgIter::_seekUpstreamMsgIters(SeekFuncT&& seekFunc)
 {
     /*
      * The current approach is that this operation is either successful
@@ -205,7 +206,7 @@ void MsgIter::_seekBeginning()
      * iterator pointers so that we can process what's in
      * `_mUpstreamMsgIters` only. This is irreversible, but it's okay:
      * if any seeking fails below, the downstream user is required to
-     * try the "seek beginning" operation again and only call
+     * try the seeking operation again and only call
      * bt_message_iterator_next() if it was successful.
      *
      * This means if the first four upstream message iterators seek, and
@@ -220,7 +221,7 @@ void MsgIter::_seekBeginning()
     /* Make each upstream message iterator seek */
     for (auto& upstreamMsgIter : _mUpstreamMsgIters) {
         /* This may throw! */
-        upstreamMsgIter->seekBeginning();
+        seekFunc(*upstreamMsgIter);
     }
 
     /*
@@ -232,6 +233,38 @@ void MsgIter::_seekBeginning()
     }
 }
 
+void MsgIter::_seekBeginning()
+{
+    this->_seekUpstreamMsgIters([](UpstreamMsgIter& upstreamMsgIter) {
+        upstreamMsgIter.seekBeginning();
+    });
+}
+
+bool MsgIter::_canSeekNsFromOrigin(const std::int64_t nsFromOrigin)
+{
+    /*
+     * We can only seek a given time ourselves if all our upstream
+     * message iterators also can, possibly automatically.
+     *
+     * Making each upstream message iterator seek `nsFromOrigin` is
+     * equivalent to having the library automatically make this message
+     * iterator seek `nsFromOrigin`, but each upstream message iterator
+     * may do it much faster (natively, or by skipping what the library
+     * would discard anyway while automatically seeking).
+     */
+    return std::all_of(_mUpstreamMsgIters.begin(), _mUpstreamMsgIters.end(),
+                       [nsFromOrigin](UpstreamMsgIter::UP& upstreamMsgIter) {
+                           return upstreamMsgIter->canSeekNsFromOrigin(nsFromOrigin);
+                       });
+}
+
+void MsgIter::_seekNsFromOrigin(const std::int64_t nsFromOrigin)
+{
+    this->_seekUpstreamMsgIters([nsFromOrigin](UpstreamMsgIter& upstreamMsgIter) {
+        upstreamMsgIter.seekNsFromOrigin(nsFromOrigin);
+    });
+}
+
 namespace {
 
 std::string formatClkClsOrigin(const bt2::ClockOriginView clkClsOrigin, const char * const prefix,
@@ -52,6 +52,8 @@ public:
 private:
     bool _canSeekBeginning();
     void _seekBeginning();
+    bool _canSeekNsFromOrigin(std::int64_t nsFromOrigin);
+    void _seekNsFromOrigin(std::int64_t nsFromOrigin);
     void _next(bt2::ConstMessageArray& msgs);
 
     /*
@@ -62,6 +64,16 @@ private:
      */
     void _ensureFullHeap();
 
+    /*
+     * Makes all the upstream message iterators seek, calling
+     * `seekFunc` for each one of them, so that the next call to
+     * _next() reloads them all.
+     *
+     * This may throw whatever `seekFunc` may throw.
+     */
+    template <typename SeekFuncT>
+    void _seekUpstreamMsgIters(SeekFuncT&& seekFunc);
+
     /*
      * Validates the clock class of the received message `msg`, setting
      * the expectation if this is the first one.
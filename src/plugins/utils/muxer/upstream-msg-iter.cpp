@@ -11,6 +11,8 @@
 #include "cpp-common/vendor/fmt/core.h"
 #include "cpp-common/vendor/fmt/format.h"
 
+#include "plugins/common/muxing/muxing.hpp"
+
 #include "upstream-msg-iter.hpp"
 
 namespace bt2mux {
@@ -25,67 +27,6 @@ UpstreamMsgIter::UpstreamMsgIter(bt2::MessageIterator::Shared msgIter, std::stri
                _mPortName);
 }
 
-namespace {
-
-/*
- * Returns the clock snapshot of `msg`, possibly missing.
- */
-bt2::OptionalBorrowedObject<bt2::ConstClockSnapshot> msgCs(const bt2::ConstMessage msg) noexcept
-{
-    switch (msg.type()) {
-    case bt2::MessageType::Event:
-        if (msg.asEvent().streamClassDefaultClockClass()) {
-            return msg.asEvent().defaultClockSnapshot();
-        }
-
-        break;
-    case bt2::MessageType::PacketBeginning:
-        if (msg.asPacketBeginning().packet().stream().cls().packetsHaveBeginningClockSnapshot()) {
-            return msg.asPacketBeginning().defaultClockSnapshot();
-        }
-
-        break;
-    case bt2::MessageType::PacketEnd:
-        if (msg.asPacketEnd().packet().stream().cls().packetsHaveEndClockSnapshot()) {
-            return msg.asPacketEnd().defaultClockSnapshot();
-        }
-
-        break;
-    case bt2::MessageType::DiscardedEvents:
-        if (msg.asDiscardedEvents().stream().cls().discardedEventsHaveDefaultClockSnapshots()) {
-            return msg.asDiscardedEvents().beginningDefaultClockSnapshot();
-        }
-
-        break;
-    case bt2::MessageType::DiscardedPackets:
-        if (msg.asDiscardedPackets().stream().cls().discardedPacketsHaveDefaultClockSnapshots()) {
-            return msg.asDiscardedPackets().beginningDefaultClockSnapshot();
-        }
-
-        break;
-    case bt2::MessageType::MessageIteratorInactivity:
-        return msg.asMessageIteratorInactivity().clockSnapshot();
-    case bt2::MessageType::StreamBeginning:
-        if (msg.asStreamBeginning().streamClassDefaultClockClass()) {
-            return msg.asStreamBeginning().defaultClockSnapshot();
-        }
-
-        break;
-    case bt2::MessageType::StreamEnd:
-        if (msg.asStreamEnd().streamClassDefaultClockClass()) {
-            return msg.asStreamEnd().defaultClockSnapshot();
-        }
-
-        break;
-    default:
-        bt_common_abort();
-    }
-
-    return {};
-}
-
-} /* namespace */
-
 UpstreamMsgIter::ReloadStatus UpstreamMsgIter::reload()
 {
     BT_ASSERT_DBG(!_mDiscardRequired);
@@ -110,7 +51,7 @@ UpstreamMsgIter::ReloadStatus UpstreamMsgIter::reload()
         _mMsgTs.reset();
         return ReloadStatus::NoMore;
     } else {
-        if (const auto cs = msgCs(this->msg())) {
+        if (const auto cs = muxing::msgCs(this->msg())) {
             _mMsgTs = cs->nsFromOrigin();
             BT_CPPLOGD("Cached the timestamp of the current message: this={}, ts={}",
                        fmt::ptr(this), *_mMsgTs);
@@ -166,6 +107,19 @@ void UpstreamMsgIter::seekBeginning()
     _mDiscardRequired = false;
 }
 
+bool UpstreamMsgIter::canSeekNsFromOrigin(const std::int64_t nsFromOrigin)
+{
+    return _mMsgIter->canSeekNsFromOrigin(nsFromOrigin);
+}
+
+void UpstreamMsgIter::seekNsFromOrigin(const std::int64_t nsFromOrigin)
+{
+    _mMsgIter->seekNsFromOrigin(nsFromOrigin);
+    _mMsgs.msgs.reset();
+    _mMsgTs.reset();
+    _mDiscardRequired = false;
+}
+
 bool UpstreamMsgIter::canSeekForward() const noexcept
 {
     return _mMsgIter->canSeekForward();
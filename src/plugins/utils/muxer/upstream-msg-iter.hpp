@@ -88,8 +88,8 @@ public:
      * Discards the current message, making this upstream message
      * iterator ready for a reload (reload()).
      *
-     * You may only call reload() or seekBeginning() after having called
-     * this.
+     * You may only call reload(), seekBeginning(), or seekNsFromOrigin()
+     * after having called this.
      */
     void discard() noexcept
     {
@@ -116,7 +116,8 @@ public:
      * If this method returns `ReloadStatus::NO_MORE`, then the
      * underlying libbabeltrace2 message iterator is ended, meaning you
      * may not call msg(), msgTs(), or reload() again for this message
-     * iterator until you successfully call seekBeginning().
+     * iterator until you successfully call seekBeginning() or
+     * seekNsFromOrigin().
      */
     ReloadStatus reload();
 
@@ -134,6 +135,20 @@ public:
      */
     void seekBeginning();
 
+    /*
+     * Forwards to bt2::MessageIterator::canSeekNsFromOrigin().
+     */
+    bool canSeekNsFromOrigin(std::int64_t nsFromOrigin);
+
+    /*
+     * Forwards to bt2::MessageIterator::seekNsFromOrigin().
+     *
+     * On success, you may call reload() afterwards. With any exception,
+     * you must call this method again, successfully, before you may
+     * call reload().
+     */
+    void seekNsFromOrigin(std::int64_t nsFromOrigin);
+
     /*
      * Forwards to bt2::MessageIterator::canSeekForward().
      */
@@ -12,6 +12,7 @@
 #include "dummy/dummy.h"
 #include "muxer/comp.hpp"
 #include "muxer/msg-iter.hpp"
+#include "stats/comp.hpp"
 #include "trimmer/trimmer.h"
 
 #ifndef BT_BUILT_IN_PLUGINS
@@ -44,6 +45,12 @@ BT_PLUGIN_SINK_COMPONENT_CLASS_DESCRIPTION(counter, "Count messages and print th
 BT_PLUGIN_SINK_COMPONENT_CLASS_HELP(counter,
                                     "See the babeltrace2-sink.utils.counter(7) manual page.");
 
+/* sink.utils.stats */
+BT_CPP_PLUGIN_SINK_COMPONENT_CLASS(stats, bt2stats::Comp);
+BT_PLUGIN_SINK_COMPONENT_CLASS_DESCRIPTION(
+    stats, "Aggregate event messages by class, stream, field value, and time, and print the result.");
+BT_PLUGIN_SINK_COMPONENT_CLASS_HELP(stats, "See the babeltrace2-sink.utils.stats(7) manual page.");
+
 /* flt.utils.trimmer */
 BT_PLUGIN_FILTER_COMPONENT_CLASS(trimmer, trimmer_msg_iter_next);
 BT_PLUGIN_FILTER_COMPONENT_CLASS_GET_SUPPORTED_MIP_VERSIONS_METHOD(trimmer,
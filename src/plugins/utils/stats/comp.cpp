@@ -0,0 +1,595 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS Inc. and Linux Foundation
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
+#include "common/assert.h"
+#include "cpp-common/bt2c/glib-up.hpp"
+#include "cpp-common/vendor/fmt/format.h"
+
+#include "plugins/common/muxing/muxing.hpp"
+#include "plugins/common/param-validation/param-validation.h"
+
+#include "comp.hpp"
+
+namespace bt2stats {
+
+namespace {
+
+const bt_param_validation_value_descr eventClsNamesElemDescr =
+    bt_param_validation_value_descr::makeString();
+
+bt_param_validation_map_value_entry_descr paramsDescr[] = {
+    {"event-class-names", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeArray(1, BT_PARAM_VALIDATION_INFINITE,
+                                                eventClsNamesElemDescr)},
+    {"bucket-duration", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeSignedInteger()},
+    {"key-field", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeString()},
+    {"top-count", BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_OPTIONAL,
+     bt_param_validation_value_descr::makeSignedInteger()},
+    BT_PARAM_VALIDATION_MAP_VALUE_ENTRY_END};
+
+} /* namespace */
+
+Comp::Comp(const bt2::SelfSinkComponent selfComp, const bt2::ConstMapValue params, void *) :
+    bt2::UserSinkComponent<Comp> {selfComp, "PLUGIN/SINK.UTILS.STATS"},
+    _mLastBucketIt {_mBuckets.end()}
+{
+    BT_CPPLOGI("Initializing component.");
+    this->_parseParams(params);
+
+    try {
+        this->_addInputPort("in");
+    } catch (const bt2c::Error&) {
+        BT_CPPLOGE_APPEND_CAUSE_AND_RETHROW("Failed to add a single input port.");
+    }
+
+    BT_CPPLOGI("Initialized component.");
+}
+
+Comp::~Comp()
+{
+    if (_mPrinted) {
+        return;
+    }
+
+    /* Interrupted or failed graph: print what we have */
+    try {
+        this->_print();
+    } catch (...) {
+        BT_CPPLOGW("Failed to print the aggregated statistics.");
+    }
+}
+
+void Comp::_getSupportedMipVersions(bt2::SelfComponentClass, bt2::ConstValue, bt2::LoggingLevel,
+                                    const bt2::UnsignedIntegerRangeSet ranges)
+{
+    ranges.addRange(0, 1);
+}
+
+void Comp::_parseParams(const bt2::ConstMapValue params)
+{
+    gchar *error = NULL;
+
+    if (bt_param_validation_validate(params.libObjPtr(), paramsDescr, &error) !=
+        BT_PARAM_VALIDATION_STATUS_OK) {
+        bt2c::GCharUP errorFreer {error};
+        BT_CPPLOGE_APPEND_CAUSE_AND_THROW(bt2c::Error, "{}", error);
+    }
+
+    /* event-class-names parameter */
+    if (const auto namesVal = params["event-class-names"]) {
+        const auto namesArrayVal = namesVal->asArray();
+
+        for (std::uint64_t i = 0; i < namesArrayVal.length(); ++i) {
+            _mEventClsNames.emplace(namesArrayVal[i].asString().value().str());
+        }
+    }
+
+    /* bucket-duration parameter */
+    if (const auto bucketDurationVal = params["bucket-duration"]) {
+        const auto val = bucketDurationVal->asSignedInteger().value();
+
+        if (val <= 0) {
+            BT_CPPLOGE_APPEND_CAUSE_AND_THROW(
+                bt2c::Error,
+                "Invalid `bucket-duration` parameter: expecting a positive value: val={}", val);
+        }
+
+        _mBucketDuration = static_cast<std::uint64_t>(val);
+    }
+
+    /* top-count parameter */
+    if (const auto topCountVal = params["top-count"]) {
+        const auto val = topCountVal->asSignedInteger().value();
+
+        if (val <= 0) {
+            BT_CPPLOGE_APPEND_CAUSE_AND_THROW(
+                bt2c::Error, "Invalid `top-count` parameter: expecting a positive value: val={}",
+                val);
+        }
+
+        _mTopCount = static_cast<std::uint64_t>(val);
+    }
+
+    /* key-field parameter: `SCOPE.NAME[.NAME]...` */
+    if (const auto keyFieldVal = params["key-field"]) {
+        _mKeyFieldPath = keyFieldVal->asString().value().str();
+
+        std::vector<std::string> parts;
+        std::size_t begin = 0;
+
+        while (true) {
+            const auto end = _mKeyFieldPath.find('.', begin);
+
+            parts.emplace_back(_mKeyFieldPath.substr(begin, end - begin));
+
+            if (end == std::string::npos) {
+                break;
+            }
+
+            begin = end + 1;
+        }
+
+        if (parts.size() < 2 || std::any_of(parts.begin(), parts.end(), [](const std::string& part) {
+                return part.empty();
+            })) {
+            BT_CPPLOGE_APPEND_CAUSE_AND_THROW(
+                bt2c::Error,
+                "Invalid `key-field` parameter: expecting `SCOPE.NAME[.NAME]...`: val=\"{}\"",
+                _mKeyFieldPath);
+        }
+
+        if (parts[0] == "packet-context") {
+            _mKeyFieldScope = _KeyFieldScope::PacketContext;
+        } else if (parts[0] == "common-context") {
+            _mKeyFieldScope = _KeyFieldScope::CommonEventContext;
+        } else if (parts[0] == "specific-context") {
+            _mKeyFieldScope = _KeyFieldScope::SpecificEventContext;
+        } else if (parts[0] == "payload") {
+            _mKeyFieldScope = _KeyFieldScope::EventPayload;
+        } else {
+            BT_CPPLOGE_APPEND_CAUSE_AND_THROW(
+                bt2c::Error,
+                "Invalid `key-field` parameter: unknown scope: val=\"{}\", scope=\"{}\", "
+                "expected-scopes=[packet-context, common-context, specific-context, payload]",
+                _mKeyFieldPath, parts[0]);
+        }
+
+        _mKeyFieldMemberNames.assign(parts.begin() + 1, parts.end());
+    }
+}
+
+void Comp::_graphIsConfigured()
+{
+    _mMsgIter = this->_createMessageIterator(this->_inputPorts()["in"]);
+}
+
+bool Comp::_consume()
+{
+    BT_ASSERT_DBG(_mMsgIter);
+
+    const auto msgs = _mMsgIter->next();
+
+    if (!msgs) {
+        /* No more messages */
+        this->_print();
+        return false;
+    }
+
+    for (const auto msg : *msgs) {
+        switch (msg.type()) {
+        case bt2::MessageType::Event:
+            this->_handleEventMsg(msg.asEvent());
+            break;
+        case bt2::MessageType::StreamEnd:
+        {
+            const auto streamLibPtr = msg.asStreamEnd().stream().libObjPtr();
+
+            /* The library may reuse the address of an ended stream */
+            _mActiveStreamInfoIndexes.erase(streamLibPtr);
+
+            if (streamLibPtr == _mLastStreamLibPtr) {
+                _mLastStreamLibPtr = nullptr;
+            }
+
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    return true;
+}
+
+void Comp::_handleEventMsg(const bt2::ConstEventMessage msg)
+{
+    const auto event = msg.event();
+    auto& eventClsInfo = this->_eventClsInfo(event.cls());
+
+    if (!eventClsInfo.isSelected) {
+        return;
+    }
+
+    ++eventClsInfo.count;
+    ++_mEventCount;
+    ++_mStreamInfos[this->_streamInfoIndex(event.stream())].count;
+
+    if (!_mKeyFieldPath.empty()) {
+        this->_countKey(eventClsInfo, event);
+    }
+
+    if (_mBucketDuration) {
+        bt2s::optional<std::int64_t> ts;
+
+        if (const auto cs = muxing::msgCs(msg)) {
+            try {
+                ts = cs->nsFromOrigin();
+            } catch (const bt2::OverflowError&) {
+                /* Not representable: consider that there's no time */
+            }
+        }
+
+        if (ts) {
+            this->_countInBucket(_mLastEventClsIndex, *ts);
+        } else {
+            ++_mEventWithoutTimeCount;
+        }
+    }
+}
+
+Comp::_EventClsInfo& Comp::_eventClsInfo(const bt2::ConstEventClass eventCls)
+{
+    const auto libPtr = eventCls.libObjPtr();
+
+    if (libPtr == _mLastEventClsLibPtr) {
+        return _mEventClsInfos[_mLastEventClsIndex];
+    }
+
+    auto it = _mEventClsInfoIndexes.find(libPtr);
+
+    if (it == _mEventClsInfoIndexes.end()) {
+        _EventClsInfo info;
+
+        /* Keep a reference so that `libPtr` remains a valid key */
+        info.cls = eventCls.shared();
+        info.name = eventCls.name() ? eventCls.name().str() :
+                                      fmt::format("(unnamed, ID {})", eventCls.id());
+        info.isSelected = _mEventClsNames.empty() ||
+                          (eventCls.name() && _mEventClsNames.count(info.name) > 0);
+
+        if (!_mKeyFieldPath.empty()) {
+            this->_resolveKeyField(info);
+        }
+
+        BT_CPPLOGD("New event class: name=\"{}\", id={}, is-selected={}, key-field-kind={}",
+                   info.name, eventCls.id(), info.isSelected,
+                   static_cast<int>(info.keyFieldKind));
+        it = _mEventClsInfoIndexes.emplace(libPtr, _mEventClsInfos.size()).first;
+        _mEventClsInfos.emplace_back(std::move(info));
+    }
+
+    _mLastEventClsLibPtr = libPtr;
+    _mLastEventClsIndex = it->second;
+    return _mEventClsInfos[it->second];
+}
+
+std::size_t Comp::_streamInfoIndex(const bt2::ConstStream stream)
+{
+    const auto libPtr = stream.libObjPtr();
+
+    if (libPtr == _mLastStreamLibPtr) {
+        return _mLastStreamIndex;
+    }
+
+    auto it = _mActiveStreamInfoIndexes.find(libPtr);
+
+    if (it == _mActiveStreamInfoIndexes.end()) {
+        _StreamInfo info;
+
+        info.name = stream.name() ? stream.name().str() : std::string {};
+        info.traceName = stream.trace().name() ? stream.trace().name().str() : std::string {};
+        info.id = stream.id();
+        it = _mActiveStreamInfoIndexes.emplace(libPtr, _mStreamInfos.size()).first;
+        _mStreamInfos.emplace_back(std::move(info));
+    }
+
+    _mLastStreamLibPtr = libPtr;
+    _mLastStreamIndex = it->second;
+    return it->second;
+}
+
+void Comp::_resolveKeyField(_EventClsInfo& info) const
+{
+    bt2::OptionalBorrowedObject<bt2::ConstStructureFieldClass> scopeFc;
+
+    switch (_mKeyFieldScope) {
+    case _KeyFieldScope::PacketContext:
+        scopeFc = info.cls->streamClass().packetContextFieldClass();
+        break;
+    case _KeyFieldScope::CommonEventContext:
+        scopeFc = info.cls->streamClass().commonEventContextFieldClass();
+        break;
+    case _KeyFieldScope::SpecificEventContext:
+        scopeFc = info.cls->specificContextFieldClass();
+        break;
+    case _KeyFieldScope::EventPayload:
+        scopeFc = info.cls->payloadFieldClass();
+        break;
+    default:
+        bt_common_abort();
+    }
+
+    if (!scopeFc) {
+        return;
+    }
+
+    bt2::ConstFieldClass fc = *scopeFc;
+
+    for (const auto& memberName : _mKeyFieldMemberNames) {
+        if (!fc.isStructure()) {
+            info.keyFieldMemberIndexes.clear();
+            return;
+        }
+
+        const auto structFc = fc.asStructure();
+        std::uint64_t i = 0;
+
+        for (; i < structFc.length(); ++i) {
+            if (std::strcmp(structFc[i].name(), memberName.c_str()) == 0) {
+                break;
+            }
+        }
+
+        if (i == structFc.length()) {
+            info.keyFieldMemberIndexes.clear();
+            return;
+        }
+
+        info.keyFieldMemberIndexes.push_back(i);
+        fc = structFc[i].fieldClass();
+    }
+
+    if (fc.isBool()) {
+        info.keyFieldKind = _KeyFieldKind::Bool;
+    } else if (fc.isUnsignedInteger()) {
+        info.keyFieldKind = _KeyFieldKind::UnsignedInteger;
+    } else if (fc.isSignedInteger()) {
+        info.keyFieldKind = _KeyFieldKind::SignedInteger;
+    } else if (fc.isString()) {
+        info.keyFieldKind = _KeyFieldKind::String;
+    } else {
+        /* Unsupported key field class */
+        info.keyFieldMemberIndexes.clear();
+    }
+}
+
+void Comp::_countKey(const _EventClsInfo& info, const bt2::ConstEvent event)
+{
+    if (info.keyFieldKind == _KeyFieldKind::None) {
+        ++_mKeyCounts.none;
+        return;
+    }
+
+    bt2::OptionalBorrowedObject<bt2::ConstStructureField> scopeField;
+
+    switch (_mKeyFieldScope) {
+    case _KeyFieldScope::PacketContext:
+        if (const auto packet = event.packet()) {
+            scopeField = packet->contextField();
+        }
+
+        break;
+    case _KeyFieldScope::CommonEventContext:
+        scopeField = event.commonContextField();
+        break;
+    case _KeyFieldScope::SpecificEventContext:
+        scopeField = event.specificContextField();
+        break;
+    case _KeyFieldScope::EventPayload:
+        scopeField = event.payloadField();
+        break;
+    default:
+        bt_common_abort();
+    }
+
+    if (!scopeField) {
+        ++_mKeyCounts.none;
+        return;
+    }
+
+    bt2::ConstField field = *scopeField;
+
+    for (const auto index : info.keyFieldMemberIndexes) {
+        field = field.asStructure()[index];
+    }
+
+    switch (info.keyFieldKind) {
+    case _KeyFieldKind::Bool:
+        ++_mKeyCounts.bools[field.asBool().value() ? 1 : 0];
+        break;
+    case _KeyFieldKind::UnsignedInteger:
+        ++_mKeyCounts.uInts[field.asUnsignedInteger().value()];
+        break;
+    case _KeyFieldKind::SignedInteger:
+        ++_mKeyCounts.sInts[field.asSignedInteger().value()];
+        break;
+    case _KeyFieldKind::String:
+    {
+        const auto strField = field.asString();
+
+        /* Reuse the capacity of `_mStrKeyBuf` */
+        _mStrKeyBuf.assign(strField.value().data(), strField.length());
+        ++_mKeyCounts.strs[_mStrKeyBuf];
+        break;
+    }
+    default:
+        bt_common_abort();
+    }
+}
+
+void Comp::_countInBucket(const std::size_t eventClsIndex, const std::int64_t ts)
+{
+    const auto duration = static_cast<std::int64_t>(*_mBucketDuration);
+    auto offset = ts % duration;
+
+    if (offset < 0) {
+        /* Round toward negative infinity */
+        offset += duration;
+    }
+
+    const auto bucketBegin = ts - offset;
+
+    if (_mLastBucketIt == _mBuckets.end() || _mLastBucketIt->first != bucketBegin) {
+        _mLastBucketIt = _mBuckets.emplace(bucketBegin, std::vector<std::uint64_t> {}).first;
+    }
+
+    auto& counts = _mLastBucketIt->second;
+
+    if (counts.size() <= eventClsIndex) {
+        counts.resize(eventClsIndex + 1);
+    }
+
+    ++counts[eventClsIndex];
+}
+
+void Comp::_appendTopEntries(std::string& str, std::vector<_Entry> entries,
+                             const std::uint64_t total) const
+{
+    const auto count = std::min(static_cast<std::size_t>(_mTopCount), entries.size());
+
+    std::partial_sort(entries.begin(), entries.begin() + count, entries.end(),
+                      [](const _Entry& left, const _Entry& right) {
+                          if (left.second != right.second) {
+                              return left.second > right.second;
+                          }
+
+                          return left.first < right.first;
+                      });
+
+    for (std::size_t i = 0; i < count; ++i) {
+        fmt::format_to(std::back_inserter(str), "{:>15} {:>6.2f}% {}\n", entries[i].second,
+                       total == 0 ? 0. :
+                                    static_cast<double>(entries[i].second) * 100. /
+                                        static_cast<double>(total),
+                       entries[i].first);
+    }
+
+    if (entries.size() > count) {
+        fmt::format_to(std::back_inserter(str), "{:>15} other{}\n", entries.size() - count,
+                       entries.size() - count == 1 ? "" : "s");
+    }
+}
+
+void Comp::_print()
+{
+    std::string str;
+    auto out = std::back_inserter(str);
+
+    _mPrinted = true;
+
+    /* Totals */
+    fmt::format_to(out, "{} event message{} ({} event class{}, {} stream{})\n", _mEventCount,
+                   _mEventCount == 1 ? "" : "s", _mEventClsInfos.size(),
+                   _mEventClsInfos.size() == 1 ? "" : "es", _mStreamInfos.size(),
+                   _mStreamInfos.size() == 1 ? "" : "s");
+
+    /* Event classes */
+    {
+        std::vector<_Entry> entries;
+
+        for (const auto& info : _mEventClsInfos) {
+            if (info.isSelected) {
+                entries.emplace_back(info.name, info.count);
+            }
+        }
+
+        fmt::format_to(out, "\nTop event classes:\n");
+        this->_appendTopEntries(str, std::move(entries), _mEventCount);
+    }
+
+    /* Streams */
+    {
+        std::vector<_Entry> entries;
+
+        for (const auto& info : _mStreamInfos) {
+            entries.emplace_back(fmt::format("`{}` (trace `{}`, ID {})", info.name,
+                                             info.traceName, info.id),
+                                 info.count);
+        }
+
+        fmt::format_to(out, "\nTop streams:\n");
+        this->_appendTopEntries(str, std::move(entries), _mEventCount);
+    }
+
+    /* Key field values */
+    if (!_mKeyFieldPath.empty()) {
+        std::vector<_Entry> entries;
+
+        for (std::size_t i = 0; i < 2; ++i) {
+            if (_mKeyCounts.bools[i] > 0) {
+                entries.emplace_back(i == 0 ? "false" : "true", _mKeyCounts.bools[i]);
+            }
+        }
+
+        for (const auto& keyCount : _mKeyCounts.uInts) {
+            entries.emplace_back(fmt::to_string(keyCount.first), keyCount.second);
+        }
+
+        for (const auto& keyCount : _mKeyCounts.sInts) {
+            entries.emplace_back(fmt::to_string(keyCount.first), keyCount.second);
+        }
+
+        for (const auto& keyCount : _mKeyCounts.strs) {
+            entries.emplace_back(fmt::format("\"{}\"", keyCount.first), keyCount.second);
+        }
+
+        fmt::format_to(out, "\nTop `{}` values:\n", _mKeyFieldPath);
+        this->_appendTopEntries(str, std::move(entries), _mEventCount);
+
+        if (_mKeyCounts.none > 0) {
+            fmt::format_to(out, "{:>15} event message{} without this field\n", _mKeyCounts.none,
+                           _mKeyCounts.none == 1 ? "" : "s");
+        }
+    }
+
+    /* Histogram */
+    if (_mBucketDuration) {
+        fmt::format_to(out, "\nEvent messages per {} ns bucket (bucket beginning, ns from origin):\n",
+                       *_mBucketDuration);
+
+        for (const auto& bucket : _mBuckets) {
+            std::vector<_Entry> entries;
+            std::uint64_t bucketCount = 0;
+
+            for (std::size_t i = 0; i < bucket.second.size(); ++i) {
+                if (bucket.second[i] > 0) {
+                    entries.emplace_back(_mEventClsInfos[i].name, bucket.second[i]);
+                    bucketCount += bucket.second[i];
+                }
+            }
+
+            fmt::format_to(out, "  {:>20} {:>15}\n", bucket.first, bucketCount);
+            this->_appendTopEntries(str, std::move(entries), bucketCount);
+        }
+
+        if (_mEventWithoutTimeCount > 0) {
+            fmt::format_to(out, "{:>15} event message{} without time\n", _mEventWithoutTimeCount,
+                           _mEventWithoutTimeCount == 1 ? "" : "s");
+        }
+    }
+
+    std::fwrite(str.data(), 1, str.size(), stdout);
+    std::fflush(stdout);
+}
+
+} /* namespace bt2stats */
@@ -0,0 +1,197 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (c) 2024 EfficiOS Inc. and Linux Foundation
+ */
+
+#ifndef BABELTRACE_PLUGINS_UTILS_STATS_COMP_HPP
+#define BABELTRACE_PLUGINS_UTILS_STATS_COMP_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "cpp-common/bt2/component-class-dev.hpp"
+#include "cpp-common/bt2/message-iterator.hpp"
+#include "cpp-common/bt2/message.hpp"
+#include "cpp-common/bt2/plugin-dev.hpp"
+#include "cpp-common/bt2/trace-ir.hpp"
+#include "cpp-common/bt2s/optional.hpp"
+
+namespace bt2stats {
+
+/*
+ * A `sink.utils.stats` component aggregates the event messages it
+ * consumes in memory and prints the result when there's no more
+ * messages to consume:
+ *
+ * • The event message count of each event class and of each stream,
+ *   keeping the most frequent ones.
+ *
+ * • Optionally, the most frequent values of a given event record
+ *   field.
+ *
+ * • Optionally, an event count histogram with time buckets of a given
+ *   duration, with the event message counts of the most frequent event
+ *   classes of each bucket.
+ */
+class Comp final : public bt2::UserSinkComponent<Comp>
+{
+    friend bt2::UserSinkComponent<Comp>;
+
+public:
+    explicit Comp(bt2::SelfSinkComponent selfComp, bt2::ConstMapValue params, void *);
+    ~Comp();
+
+protected:
+    static void _getSupportedMipVersions(bt2::SelfComponentClass, bt2::ConstValue,
+                                         bt2::LoggingLevel, bt2::UnsignedIntegerRangeSet ranges);
+
+private:
+    /* Scope of the field of `key-field` */
+    enum class _KeyFieldScope
+    {
+        PacketContext,
+        CommonEventContext,
+        SpecificEventContext,
+        EventPayload,
+    };
+
+    /* Kind of the field of `key-field` for a given event class */
+    enum class _KeyFieldKind
+    {
+        None,
+        Bool,
+        UnsignedInteger,
+        SignedInteger,
+        String,
+    };
+
+    /* Aggregated data of an event class */
+    struct _EventClsInfo final
+    {
+        bt2::ConstEventClass::Shared cls;
+        std::string name;
+
+        /* Whether or not `event-class-names` selects this class */
+        bool isSelected;
+
+        /*
+         * Kind of the field of `key-field` within the events of this
+         * class, and indexes of the structure members to follow from
+         * its scope field to reach it.
+         */
+        _KeyFieldKind keyFieldKind = _KeyFieldKind::None;
+        std::vector<std::uint64_t> keyFieldMemberIndexes;
+
+        /* Number of event messages */
+        std::uint64_t count = 0;
+    };
+
+    /* Aggregated data of a stream */
+    struct _StreamInfo final
+    {
+        std::string name;
+        std::string traceName;
+        std::uint64_t id;
+
+        /* Number of event messages */
+        std::uint64_t count = 0;
+    };
+
+    /* Aggregated counts of the values of the field of `key-field` */
+    struct _KeyCounts final
+    {
+        /* Indexed by the boolean value */
+        std::uint64_t bools[2] = {0, 0};
+
+        std::unordered_map<std::uint64_t, std::uint64_t> uInts;
+        std::unordered_map<std::int64_t, std::uint64_t> sInts;
+        std::unordered_map<std::string, std::uint64_t> strs;
+
+        /* Number of events of which the class has no such field */
+        std::uint64_t none = 0;
+    };
+
+    /* Label and count of a printed entry */
+    using _Entry = std::pair<std::string, std::uint64_t>;
+
+    void _graphIsConfigured();
+    bool _consume();
+    void _parseParams(bt2::ConstMapValue params);
+    void _handleEventMsg(bt2::ConstEventMessage msg);
+    _EventClsInfo& _eventClsInfo(bt2::ConstEventClass eventCls);
+    std::size_t _streamInfoIndex(bt2::ConstStream stream);
+    void _resolveKeyField(_EventClsInfo& info) const;
+    void _countKey(const _EventClsInfo& info, bt2::ConstEvent event);
+    void _countInBucket(std::size_t eventClsIndex, std::int64_t ts);
+    void _print();
+    void _appendTopEntries(std::string& str, std::vector<_Entry> entries,
+                           std::uint64_t total) const;
+
+    /* Upstream message iterator */
+    bt2::MessageIterator::Shared _mMsgIter;
+
+    /* Parameters */
+    std::unordered_set<std::string> _mEventClsNames;
+    bt2s::optional<std::uint64_t> _mBucketDuration;
+    std::string _mKeyFieldPath;
+    _KeyFieldScope _mKeyFieldScope = _KeyFieldScope::EventPayload;
+    std::vector<std::string> _mKeyFieldMemberNames;
+    std::uint64_t _mTopCount = 10;
+
+    /* Event classes, in order of appearance */
+    std::vector<_EventClsInfo> _mEventClsInfos;
+
+    /* Event class library pointer to index within `_mEventClsInfos` */
+    std::unordered_map<const bt_event_class *, std::size_t> _mEventClsInfoIndexes;
+
+    /*
+     * Last looked up event class and its index within
+     * `_mEventClsInfos`, most event messages having the same class as
+     * the previous one.
+     */
+    const bt_event_class *_mLastEventClsLibPtr = nullptr;
+    std::size_t _mLastEventClsIndex = 0;
+
+    /* Streams, in order of beginning */
+    std::vector<_StreamInfo> _mStreamInfos;
+
+    /* Active stream library pointer to index within `_mStreamInfos` */
+    std::unordered_map<const bt_stream *, std::size_t> _mActiveStreamInfoIndexes;
+
+    /* Last looked up stream and its index within `_mStreamInfos` */
+    const bt_stream *_mLastStreamLibPtr = nullptr;
+    std::size_t _mLastStreamIndex = 0;
+
+    /* Counts of the values of the field of `key-field` */
+    _KeyCounts _mKeyCounts;
+
+    /* Reused buffer to look up a string key without allocating */
+    std::string _mStrKeyBuf;
+
+    /*
+     * Time buckets: beginning time (ns from origin) to event message
+     * count of each event class (same indexes as `_mEventClsInfos`).
+     */
+    std::map<std::int64_t, std::vector<std::uint64_t>> _mBuckets;
+
+    /* Last used bucket, most event messages falling into it */
+    std::map<std::int64_t, std::vector<std::uint64_t>>::iterator _mLastBucketIt;
+
+    /* Number of selected event messages */
+    std::uint64_t _mEventCount = 0;
+
+    /* Number of selected event messages without a time */
+    std::uint64_t _mEventWithoutTimeCount = 0;
+
+    /* Whether or not the result is printed */
+    bool _mPrinted = false;
+};
+
+} /* namespace bt2stats */
+
+#endif /* BABELTRACE_PLUGINS_UTILS_STATS_COMP_HPP */
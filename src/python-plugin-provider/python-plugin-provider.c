@@ -22,6 +22,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <signal.h>
+#include <pthread.h>
 #include <Python.h>
 #include <glib.h>
 
@@ -50,6 +51,13 @@ static enum python_state {
 static PyObject *py_try_load_plugin_module_func = NULL;
 static bool python_was_initialized_by_us;
 
+/*
+ * Protects `python_state` and serializes the calls to the Python
+ * interpreter of bt_plugin_python_create_all_from_file(): threads
+ * which load plugins concurrently take turns.
+ */
+static pthread_mutex_t python_lock = PTHREAD_MUTEX_INITIALIZER;
+
 static
 void append_python_traceback_error_cause(void)
 {
@@ -595,8 +603,8 @@ end:
 	return status;
 }
 
-BT_EXPORT
-int bt_plugin_python_create_all_from_file(const char *path,
+static
+int create_all_from_file(const char *path,
 		bool fail_on_load_error, struct bt_plugin_set **plugin_set_out)
 {
 	bt_plugin *plugin = NULL;
@@ -750,3 +758,16 @@ end:
 
 	return status;
 }
+
+BT_EXPORT
+int bt_plugin_python_create_all_from_file(const char *path,
+		bool fail_on_load_error, struct bt_plugin_set **plugin_set_out)
+{
+	int status;
+
+	pthread_mutex_lock(&python_lock);
+	status = create_all_from_file(path, fail_on_load_error,
+		plugin_set_out);
+	pthread_mutex_unlock(&python_lock);
+	return status;
+}
@@ -0,0 +1,221 @@
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# Copyright (C) 2024 EfficiOS Inc.
+#
+
+import unittest
+
+import bt2
+
+# Number of "ev" events (and of "other" events) of the source below
+_EVENT_COUNT = 40
+
+
+# Source which emits, after a stream beginning and a packet beginning
+# message, `_EVENT_COUNT` pairs of events:
+#
+# 1. Event of class "ev" (ID 0) with:
+#        payload.u = i
+#        payload.s = -i
+#        payload.r = i / 2
+#        payload.inner.b = i is odd
+#
+# 2. Event of class "other" (ID 1) with:
+#        payload.u = 1000 + i
+#
+# The timestamp of each event is its index (within all the messages)
+# times 10.
+class _MyIter(bt2._UserMessageIterator):
+    def __init__(self, config, self_port_output):
+        comp = self._component
+        self._msgs = [
+            self._create_stream_beginning_message(comp._stream),
+            self._create_packet_beginning_message(comp._packet, 0),
+        ]
+
+        for i in range(_EVENT_COUNT):
+            msg = self._create_event_message(
+                comp._ev_ec, comp._packet, len(self._msgs) * 10
+            )
+            msg.event.payload_field["u"] = i
+            msg.event.payload_field["s"] = -i
+            msg.event.payload_field["r"] = i / 2
+            msg.event.payload_field["inner"]["b"] = i % 2 == 1
+            self._msgs.append(msg)
+            msg = self._create_event_message(
+                comp._other_ec, comp._packet, len(self._msgs) * 10
+            )
+            msg.event.payload_field["u"] = 1000 + i
+            self._msgs.append(msg)
+
+        ts = len(self._msgs) * 10
+        self._msgs.append(self._create_packet_end_message(comp._packet, ts))
+        self._msgs.append(self._create_stream_end_message(comp._stream))
+        self._at = 0
+
+    def __next__(self):
+        if self._at == len(self._msgs):
+            raise bt2.Stop
+
+        msg = self._msgs[self._at]
+        self._at += 1
+        return msg
+
+
+class _MySrc(bt2._UserSourceComponent, message_iterator_class=_MyIter):
+    def __init__(self, config, params, obj):
+        tc = self._create_trace_class()
+        cc = self._create_clock_class(frequency=1000000000)
+        sc = tc.create_stream_class(
+            default_clock_class=cc,
+            supports_packets=True,
+            packets_have_beginning_default_clock_snapshot=True,
+            packets_have_end_default_clock_snapshot=True,
+        )
+        inner_fc = tc.create_structure_field_class()
+        inner_fc += [("b", tc.create_bool_field_class())]
+        ev_payload_fc = tc.create_structure_field_class()
+        ev_payload_fc += [
+            ("u", tc.create_unsigned_integer_field_class(32)),
+            ("s", tc.create_signed_integer_field_class(32)),
+            ("r", tc.create_double_precision_real_field_class()),
+            ("inner", inner_fc),
+        ]
+        other_payload_fc = tc.create_structure_field_class()
+        other_payload_fc += [("u", tc.create_unsigned_integer_field_class(32))]
+        self._ev_ec = sc.create_event_class(
+            name="ev", payload_field_class=ev_payload_fc
+        )
+        self._other_ec = sc.create_event_class(
+            name="other", payload_field_class=other_payload_fc
+        )
+        self._stream = tc().create_stream(sc)
+        self._packet = self._stream.create_packet()
+        self._add_output_port("out")
+
+
+def _create_msg_iter():
+    return bt2.TraceCollectionMessageIterator(bt2.ComponentSpec(_MySrc))
+
+
+class EventColumnReaderTestCase(unittest.TestCase):
+    def test_create_wrong_capacity(self):
+        with self.assertRaises(ValueError):
+            bt2.EventColumnReader(["timestamp"], 0)
+
+    def test_create_no_columns(self):
+        with self.assertRaises(ValueError):
+            bt2.EventColumnReader([], 16)
+
+    def test_create_unknown_special_column(self):
+        with self.assertRaises(ValueError):
+            bt2.EventColumnReader(["meow"], 16)
+
+    def test_create_unknown_scope(self):
+        with self.assertRaises(ValueError):
+            bt2.EventColumnReader([("meow", "u")], 16)
+
+    def test_create_no_member_name(self):
+        with self.assertRaises(ValueError):
+            bt2.EventColumnReader([("payload",)], 16)
+
+    def test_create_wrong_format(self):
+        with self.assertRaises(ValueError):
+            bt2.EventColumnReader(["timestamp"], 16, formats=["i"])
+
+    def test_create_wrong_format_count(self):
+        with self.assertRaises(ValueError):
+            bt2.EventColumnReader(["timestamp"], 16, formats=["q", "Q"])
+
+    def test_buffers(self):
+        reader = bt2.EventColumnReader(
+            ["timestamp", ("payload", "u"), ("payload", "r")],
+            16,
+            formats=["q", "Q", "d"],
+        )
+        self.assertEqual(reader.capacity, 16)
+        self.assertEqual(len(reader), 3)
+        self.assertEqual(reader.count, 0)
+        self.assertEqual([buf.format for buf in reader.buffers], ["q", "Q", "d"])
+        self.assertEqual([len(buf) for buf in reader.buffers], [16, 16, 16])
+
+    def test_read_all(self):
+        msg_iter = _create_msg_iter()
+        reader = bt2.EventColumnReader(
+            [
+                "timestamp",
+                "event-class-id",
+                ("payload", "u"),
+                ("payload", "s"),
+                ("payload", "r"),
+                ("payload", "inner", "b"),
+            ],
+            1000,
+            formats=["q", "Q", "Q", "q", "d", "q"],
+        )
+        self.assertEqual(msg_iter.read_event_columns(reader), _EVENT_COUNT * 2)
+
+        for row in range(_EVENT_COUNT * 2):
+            i = row // 2
+            is_ev = row % 2 == 0
+            self.assertEqual(reader[0][row], (2 + row) * 10)
+            self.assertEqual(reader[1][row], 0 if is_ev else 1)
+            self.assertEqual(reader[2][row], i if is_ev else 1000 + i)
+
+            # missing fields are 0
+            self.assertEqual(reader[3][row], -i if is_ev else 0)
+            self.assertEqual(reader[4][row], i / 2 if is_ev else 0)
+            self.assertEqual(reader[5][row], int(i % 2 == 1) if is_ev else 0)
+
+        with self.assertRaises(bt2.Stop):
+            msg_iter.read_event_columns(reader)
+
+    def test_read_event_class_names(self):
+        msg_iter = _create_msg_iter()
+        reader = bt2.EventColumnReader(
+            [("payload", "u")], 1000, event_class_names=["other"]
+        )
+        self.assertEqual(msg_iter.read_event_columns(reader), _EVENT_COUNT)
+        self.assertEqual(list(reader[0]), [1000 + i for i in range(_EVENT_COUNT)])
+
+    def test_read_batches(self):
+        msg_iter = _create_msg_iter()
+        reader = bt2.EventColumnReader([("payload", "u")], 7, event_class_names=["ev"])
+        values = []
+
+        while True:
+            try:
+                count = msg_iter.read_event_columns(reader)
+            except bt2.Stop:
+                break
+
+            self.assertGreater(count, 0)
+            self.assertLessEqual(count, 7)
+            values += list(reader[0])
+
+        self.assertEqual(values, list(range(_EVENT_COUNT)))
+
+    def test_read_mixed_with_next(self):
+        msg_iter = _create_msg_iter()
+        reader = bt2.EventColumnReader([("payload", "u")], 3, event_class_names=["ev"])
+
+        # stream beginning and packet beginning messages
+        self.assertIs(type(next(msg_iter)), bt2._StreamBeginningMessageConst)
+        self.assertIs(type(next(msg_iter)), bt2._PacketBeginningMessageConst)
+
+        # three "ev" events
+        self.assertEqual(msg_iter.read_event_columns(reader), 3)
+        self.assertEqual(list(reader[0]), [0, 1, 2])
+
+        # next message is an "other" event following the last "ev" event
+        msg = next(msg_iter)
+        self.assertIs(type(msg), bt2._EventMessageConst)
+        self.assertEqual(msg.event.cls.name, "other")
+        self.assertEqual(msg.event.payload_field["u"], 1002)
+
+        self.assertEqual(msg_iter.read_event_columns(reader), 3)
+        self.assertEqual(list(reader[0]), [3, 4, 5])
+
+
+if __name__ == "__main__":
+    unittest.main()
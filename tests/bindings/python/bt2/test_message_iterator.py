@@ -376,6 +376,90 @@ class UserMessageIteratorTestCase(unittest.TestCase):
         self.assertIs(type(msg_ev2), bt2._EventMessageConst)
         self.assertEqual(msg_ev1.addr, msg_ev2.addr)
 
+    def test_next_batch(self):
+        class MyIter(bt2._UserMessageIterator):
+            def __init__(self, config, port):
+                tc, sc, ec = port.user_data
+                trace = tc()
+                stream = trace.create_stream(sc)
+                self._msgs = [self._create_stream_beginning_message(stream)]
+                self._msgs += [
+                    self._create_event_message(ec, stream) for _ in range(10)
+                ]
+                self._msgs.append(self._create_stream_end_message(stream))
+
+            def _user_next_batch(self, capacity):
+                nonlocal batch_lens
+
+                if len(self._msgs) == 0:
+                    raise bt2.Stop
+
+                # Return at most three messages at a time
+                count = min(3, capacity)
+                batch = self._msgs[:count]
+                del self._msgs[:count]
+                batch_lens.append(len(batch))
+                return batch
+
+        class MySource(bt2._UserSourceComponent, message_iterator_class=MyIter):
+            def __init__(self, config, params, obj):
+                tc = self._create_trace_class()
+                sc = tc.create_stream_class()
+                ec = sc.create_event_class()
+                self._add_output_port("out", (tc, sc, ec))
+
+        batch_lens = []
+        graph = bt2.Graph()
+        src = graph.add_component(MySource, "src")
+        it = TestOutputPortMessageIterator(graph, src.output_ports["out"])
+        msgs = [next(it) for _ in range(12)]
+
+        self.assertIs(type(msgs[0]), bt2._StreamBeginningMessageConst)
+
+        for msg in msgs[1:11]:
+            self.assertIs(type(msg), bt2._EventMessageConst)
+
+        self.assertIs(type(msgs[11]), bt2._StreamEndMessageConst)
+        self.assertEqual(batch_lens, [3, 3, 3, 3])
+
+    def test_next_batch_empty(self):
+        class MyIter(bt2._UserMessageIterator):
+            def _user_next_batch(self, capacity):
+                return []
+
+        class MySource(bt2._UserSourceComponent, message_iterator_class=MyIter):
+            def __init__(self, config, params, obj):
+                self._add_output_port("out")
+
+        graph = _create_graph(MySource, SimpleSink)
+
+        with self.assertRaises(bt2._Error):
+            graph.run()
+
+    def test_next_batch_exceeds_capacity(self):
+        class MyIter(bt2._UserMessageIterator):
+            def __init__(self, config, port):
+                tc, sc = port.user_data
+                trace = tc()
+                self._stream = trace.create_stream(sc)
+
+            def _user_next_batch(self, capacity):
+                return [
+                    self._create_stream_beginning_message(self._stream)
+                    for _ in range(capacity + 1)
+                ]
+
+        class MySource(bt2._UserSourceComponent, message_iterator_class=MyIter):
+            def __init__(self, config, params, obj):
+                tc = self._create_trace_class()
+                sc = tc.create_stream_class()
+                self._add_output_port("out", (tc, sc))
+
+        graph = _create_graph(MySource, SimpleSink)
+
+        with self.assertRaises(bt2._Error):
+            graph.run()
+
     # Try consuming many times from an iterator that always returns TryAgain.
     # This verifies that we are not missing an incref of Py_None, making the
     # refcount of Py_None reach 0.
@@ -1102,5 +1186,155 @@ class UserMessageIteratorSeekNsFromOriginTestCase(unittest.TestCase):
         self.assertEqual(actual_ns_from_origin, 17)
 
 
+
+class UserComponentInputPortMessageIteratorNextBatchTestCase(unittest.TestCase):
+    # Source which emits a stream beginning message, `event_count`
+    # events (payload field `u` is the index), and a stream end message,
+    # `batch_len` messages at a time.
+    @staticmethod
+    def _create_src_comp_cls(event_count, batch_len):
+        class MyIter(bt2._UserMessageIterator):
+            def __init__(self, config, port):
+                tc, sc, ec = port.user_data
+                stream = tc().create_stream(sc)
+                self._msgs = [self._create_stream_beginning_message(stream)]
+
+                for i in range(event_count):
+                    msg = self._create_event_message(ec, stream)
+                    msg.event.payload_field["u"] = i
+                    self._msgs.append(msg)
+
+                self._msgs.append(self._create_stream_end_message(stream))
+
+            def _user_next_batch(self, capacity):
+                if len(self._msgs) == 0:
+                    raise bt2.Stop
+
+                count = min(batch_len, capacity)
+                batch = self._msgs[:count]
+                del self._msgs[:count]
+                return batch
+
+        class MySource(bt2._UserSourceComponent, message_iterator_class=MyIter):
+            def __init__(self, config, params, obj):
+                tc = self._create_trace_class()
+                sc = tc.create_stream_class()
+                payload_fc = tc.create_structure_field_class()
+                payload_fc += [("u", tc.create_unsigned_integer_field_class(32))]
+                ec = sc.create_event_class(payload_field_class=payload_fc)
+                self._add_output_port("out", (tc, sc, ec))
+
+        return MySource
+
+    # Runs a graph of which the sink calls `consume_batch_func` with
+    # each message batch.
+    @staticmethod
+    def _run(src_comp_cls, consume_batch_func, first_msg_func=None):
+        class MySink(bt2._UserSinkComponent):
+            def __init__(self, config, params, obj):
+                self._add_input_port("in")
+
+            def _user_graph_is_configured(self):
+                self._msg_iter = self._create_message_iterator(
+                    self._input_ports["in"]
+                )
+
+                if first_msg_func is not None:
+                    self._first = True
+
+            def _user_consume(self):
+                if first_msg_func is not None and self._first:
+                    first_msg_func(next(self._msg_iter))
+                    self._first = False
+
+                consume_batch_func(self._msg_iter.next_batch())
+
+        _create_graph(src_comp_cls, MySink).run()
+
+    def test_next_batch(self):
+        batches = []
+
+        def consume_batch(batch):
+            self.assertIs(type(batch), bt2._MessageBatchConst)
+            batches.append([type(msg) for msg in batch])
+
+        self._run(self._create_src_comp_cls(8, 5), consume_batch)
+        self.assertEqual(
+            batches,
+            [
+                [bt2._StreamBeginningMessageConst] + [bt2._EventMessageConst] * 4,
+                [bt2._EventMessageConst] * 4 + [bt2._StreamEndMessageConst],
+            ],
+        )
+
+    def test_next_batch_after_next(self):
+        first_msgs = []
+        batch_lens = []
+
+        def consume_batch(batch):
+            batch_lens.append(len(batch))
+
+        self._run(self._create_src_comp_cls(8, 5), consume_batch, first_msgs.append)
+        self.assertIs(type(first_msgs[0]), bt2._StreamBeginningMessageConst)
+
+        # Rest of the first native batch, then second native batch
+        self.assertEqual(batch_lens, [4, 5])
+
+    def test_getitem(self):
+        def consume_batch(batch):
+            if len(batch) < 3:
+                return
+
+            # Same object for the same index, created on access
+            self.assertIs(batch[1], batch[1])
+            self.assertIs(batch[-1], batch[len(batch) - 1])
+            self.assertEqual(
+                [msg.addr for msg in batch[1:3]], [batch[1].addr, batch[2].addr]
+            )
+
+            with self.assertRaises(IndexError):
+                batch[len(batch)]
+
+        self._run(self._create_src_comp_cls(8, 5), consume_batch)
+
+    def test_messages_outlive_batch(self):
+        msgs = []
+
+        def consume_batch(batch):
+            msgs.extend(batch)
+
+        self._run(self._create_src_comp_cls(3, 2), consume_batch)
+        self.assertEqual(
+            [msg.event.payload_field["u"] for msg in msgs[1:4]], [0, 1, 2]
+        )
+
+    def test_iter_borrowed(self):
+        values = []
+        event_msg_ids = set()
+
+        def consume_batch(batch):
+            for msg in batch.iter_borrowed():
+                if isinstance(msg, bt2._EventMessageConst):
+                    event_msg_ids.add(id(msg))
+                    values.append(msg.event.payload_field["u"])
+
+        self._run(self._create_src_comp_cls(10, 4), consume_batch)
+        self.assertEqual(values, list(range(10)))
+
+        # One reused event message object per batch
+        self.assertLessEqual(len(event_msg_ids), 3)
+
+    def test_iter_borrowed_event_outlives_iteration(self):
+        events = []
+
+        def consume_batch(batch):
+            for msg in batch.iter_borrowed():
+                if isinstance(msg, bt2._EventMessageConst):
+                    events.append(msg.event)
+
+        self._run(self._create_src_comp_cls(6, 4), consume_batch)
+        self.assertEqual([ev.payload_field["u"] for ev in events], list(range(6)))
+
+
 if __name__ == "__main__":
     unittest.main()
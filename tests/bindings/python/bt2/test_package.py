@@ -161,6 +161,7 @@ _public_names = [
     "ComponentSpec",
     "create_value",
     "EventClassLogLevel",
+    "EventColumnReader",
     "FieldPathScope",
     "find_plugin",
     "find_plugins",
@@ -20,6 +20,7 @@
 #include <stdio.h>
 #include "compat/limits.h"
 #include "compat/stdio.h"
+#include <stdbool.h>
 #include <string.h>
 #include "common/assert.h"
 #include "common/uuid.h"
@@ -47,7 +48,7 @@
 #define DEFAULT_CLOCK_TIME 0
 #define DEFAULT_CLOCK_VALUE 0
 
-#define NR_TESTS 325
+#define NR_TESTS 335
 
 struct bt_utsname {
 	char sysname[BABELTRACE_HOST_NAME_MAX];
@@ -125,6 +126,181 @@ result:
 	ok(ret == 0, "Babeltrace could read the resulting trace");
 }
 
+/*
+ * Copies the file `name` of the directory `src_dir_path` to the
+ * directory `dst_dir_path`.
+ */
+static
+void copy_file(const char *src_dir_path, const char *dst_dir_path,
+		const char *name, gchar **contents, gsize *len)
+{
+	gchar *src_path = g_build_filename(src_dir_path, name, NULL);
+	gchar *dst_path = g_build_filename(dst_dir_path, name, NULL);
+	gboolean ret;
+
+	ret = g_file_get_contents(src_path, contents, len, NULL);
+	BT_ASSERT(ret);
+	ret = g_file_set_contents(dst_path, *contents, *len, NULL);
+	BT_ASSERT(ret);
+	g_free(src_path);
+	g_free(dst_path);
+}
+
+/*
+ * Returns whether or not `data` contains the CTF packet header magic
+ * number, in either byte order.
+ */
+static
+bool is_packet_magic(const gchar *data)
+{
+	static const guchar magic_be[] = {0xc1, 0xfc, 0x1f, 0xc1};
+	static const guchar magic_le[] = {0xc1, 0x1f, 0xfc, 0xc1};
+
+	return memcmp(data, magic_be, sizeof(magic_be)) == 0 ||
+		memcmp(data, magic_le, sizeof(magic_le)) == 0;
+}
+
+/*
+ * Validates the data stream of test_streaming_stream() within the trace
+ * `trace_path`, reading it alone with the `sink.text.details`
+ * component class.
+ */
+static
+void validate_streaming_stream(const char *parser_path,
+		const char *trace_path)
+{
+	gchar *stream_trace_path;
+	gchar *stream_file_name = NULL;
+	gchar *contents = NULL;
+	gchar *details_output = NULL;
+	gchar **lines = NULL;
+	gchar **line;
+	gsize len;
+	gsize offset;
+	gsize last_packet_offset = 0;
+	gsize max_packet_len = 0;
+	uint64_t file_packet_count = 0;
+	uint64_t packet_count = 0;
+	uint64_t packet_ts_count = 0;
+	uint64_t event_count = 0;
+	uint64_t last_value = 0;
+	uint64_t ts = 0;
+	bool has_ts = false;
+	bool ts_monotonic = true;
+	gint exit_status;
+	GDir *dir;
+	const char *name;
+
+	/* Isolate the data stream in its own trace directory */
+	stream_trace_path = g_build_filename(g_get_tmp_dir(),
+		"ctfwriter_streaming_XXXXXX", NULL);
+	if (!bt_mkdtemp(stream_trace_path)) {
+		perror("# perror");
+	}
+
+	dir = g_dir_open(trace_path, 0, NULL);
+	BT_ASSERT(dir);
+
+	while ((name = g_dir_read_name(dir))) {
+		if (g_str_has_prefix(name, "streaming_stream-")) {
+			stream_file_name = g_strdup(name);
+		}
+	}
+
+	g_dir_close(dir);
+	BT_ASSERT(stream_file_name);
+	copy_file(trace_path, stream_trace_path, "metadata", &contents, &len);
+	g_free(contents);
+	copy_file(trace_path, stream_trace_path, stream_file_name, &contents,
+		&len);
+
+	/*
+	 * Find the packets within the data stream file: its packets are
+	 * contiguous and each one starts with the magic number.
+	 */
+	for (offset = 0; offset + 4 <= len; offset++) {
+		if (!is_packet_magic(&contents[offset])) {
+			continue;
+		}
+
+		if (file_packet_count > 0) {
+			max_packet_len = MAX(max_packet_len,
+				offset - last_packet_offset);
+		}
+
+		last_packet_offset = offset;
+		file_packet_count++;
+	}
+
+	max_packet_len = MAX(max_packet_len, len - last_packet_offset);
+	ok(file_packet_count > 2 && max_packet_len <= 256,
+		"Streaming stream packets are at most 256 bytes");
+
+	/* Read the data stream */
+	{
+		const char *argv[] = {
+			parser_path, stream_trace_path,
+			"-c", "sink.text.details",
+			"-p", "with-metadata=no,with-trace-name=no,with-stream-name=no",
+			NULL,
+		};
+
+		if (!g_spawn_sync(NULL, (gchar **) argv, NULL, 0, NULL, NULL,
+				&details_output, NULL, &exit_status, NULL)) {
+			diag("Failed to spawn babeltrace.");
+			details_output = g_strdup("");
+		}
+	}
+
+	lines = g_strsplit(details_output, "\n", -1);
+
+	for (line = lines; *line; line++) {
+		if ((*line)[0] == '[' && g_ascii_isdigit((*line)[1])) {
+			/* `[1,042 cycles, ...]`: remove thousands separators */
+			const char *ch;
+			uint64_t new_ts = 0;
+
+			for (ch = &(*line)[1]; *ch != ' ' && *ch != '\0'; ch++) {
+				if (*ch != ',') {
+					new_ts = new_ts * 10 + (uint64_t) (*ch - '0');
+				}
+			}
+
+			if (new_ts < ts) {
+				ts_monotonic = false;
+			}
+
+			ts = new_ts;
+			has_ts = true;
+		} else if (strcmp(*line, "Packet beginning:") == 0) {
+			packet_count++;
+			packet_ts_count += has_ts;
+			has_ts = false;
+		} else if (strcmp(*line, "Packet end:") == 0) {
+			packet_ts_count += has_ts;
+			has_ts = false;
+		} else if (g_str_has_prefix(*line, "Event `streamed_event` ")) {
+			event_count++;
+			has_ts = false;
+		} else if (g_str_has_prefix(*line, "    value: ")) {
+			last_value = g_ascii_strtoull(&(*line)[11], NULL, 10);
+		}
+	}
+
+	ok(packet_count == file_packet_count &&
+		packet_ts_count == packet_count * 2 && ts_monotonic,
+		"Streaming stream packets have their beginning and end timestamps");
+	ok(event_count == 1001 && last_value == 999,
+		"Streaming stream contains all the appended events");
+
+	g_strfreev(lines);
+	g_free(details_output);
+	g_free(contents);
+	g_free(stream_file_name);
+	recursive_rmdir(stream_trace_path);
+	g_free(stream_trace_path);
+}
+
 static
 void append_simple_event(struct bt_ctf_stream_class *stream_class,
 		struct bt_ctf_stream *stream, struct bt_ctf_clock *clock)
@@ -1420,6 +1596,98 @@ end:
 	bt_ctf_object_put_ref(event_header_type);
 }
 
+static
+void test_streaming_stream(struct bt_ctf_writer *writer,
+		struct bt_ctf_clock *clock)
+{
+	int i, ret;
+	struct bt_ctf_stream_class *stream_class = NULL;
+	struct bt_ctf_stream *stream = NULL;
+	struct bt_ctf_field_type *integer_type = NULL;
+	struct bt_ctf_field *integer = NULL, *packet_header = NULL;
+	struct bt_ctf_event_class *event_class = NULL;
+	struct bt_ctf_event *event = NULL;
+
+	stream_class = bt_ctf_stream_class_create("streaming_stream");
+	BT_ASSERT(stream_class);
+	ret = bt_ctf_stream_class_set_clock(stream_class, clock);
+	BT_ASSERT(ret == 0);
+	event_class = bt_ctf_event_class_create("streamed_event");
+	BT_ASSERT(event_class);
+	integer_type = bt_ctf_field_type_integer_create(32);
+	BT_ASSERT(integer_type);
+	ret = bt_ctf_event_class_add_field(event_class, integer_type,
+		"value");
+	BT_ASSERT(ret == 0);
+	ret = bt_ctf_stream_class_add_event_class(stream_class, event_class);
+	BT_ASSERT(ret == 0);
+	stream = bt_ctf_writer_create_stream(writer, stream_class);
+	BT_ASSERT(stream);
+	packet_header = bt_ctf_stream_get_packet_header(stream);
+	BT_ASSERT(packet_header);
+	integer = bt_ctf_field_structure_get_field_by_name(packet_header,
+		"custom_trace_packet_header_field");
+	BT_ASSERT(integer);
+	ret = bt_ctf_field_integer_unsigned_set_value(integer, 2112);
+	BT_ASSERT(ret == 0);
+	BT_CTF_OBJECT_PUT_REF_AND_RESET(integer);
+
+	ok(bt_ctf_stream_enable_streaming(NULL, 0) < 0,
+		"bt_ctf_stream_enable_streaming handles a NULL stream correctly");
+
+	/* Streaming cannot be enabled with a non-empty current packet */
+	event = bt_ctf_event_create(event_class);
+	BT_ASSERT(event);
+	integer = bt_ctf_event_get_payload(event, "value");
+	BT_ASSERT(integer);
+	ret = bt_ctf_field_integer_unsigned_set_value(integer, 0);
+	BT_ASSERT(ret == 0);
+	BT_CTF_OBJECT_PUT_REF_AND_RESET(integer);
+	ret = bt_ctf_clock_set_time(clock, ++current_time);
+	BT_ASSERT(ret == 0);
+	ret = bt_ctf_stream_append_event(stream, event);
+	BT_ASSERT(ret == 0);
+	BT_CTF_OBJECT_PUT_REF_AND_RESET(event);
+	ok(bt_ctf_stream_enable_streaming(stream, 256) < 0,
+		"bt_ctf_stream_enable_streaming fails when the current packet contains events");
+	ok(bt_ctf_stream_flush(stream) == 0,
+		"Flush a stream before enabling streaming");
+	ok(bt_ctf_stream_enable_streaming(stream, 256) == 0,
+		"Enable streaming with a maximum packet size");
+
+	/* Make the stream roll over packets many times */
+	for (i = 0; i < 1000; i++) {
+		event = bt_ctf_event_create(event_class);
+		BT_ASSERT(event);
+		integer = bt_ctf_event_get_payload(event, "value");
+		BT_ASSERT(integer);
+		ret = bt_ctf_field_integer_unsigned_set_value(integer, i);
+		BT_ASSERT(ret == 0);
+		BT_CTF_OBJECT_PUT_REF_AND_RESET(integer);
+		ret = bt_ctf_clock_set_time(clock, ++current_time);
+		BT_ASSERT(ret == 0);
+		ret = bt_ctf_stream_append_event(stream, event);
+		BT_CTF_OBJECT_PUT_REF_AND_RESET(event);
+
+		if (ret) {
+			break;
+		}
+	}
+
+	ok(i == 1000,
+		"Append events to a streaming stream with automatic packet rollover");
+	ok(bt_ctf_stream_flush(stream) == 0,
+		"Flush a streaming stream's last packet");
+	ok(bt_ctf_stream_flush(stream) == 0,
+		"Flush an empty packet of a streaming stream");
+
+	bt_ctf_object_put_ref(stream);
+	bt_ctf_object_put_ref(stream_class);
+	bt_ctf_object_put_ref(event_class);
+	bt_ctf_object_put_ref(packet_header);
+	bt_ctf_object_put_ref(integer_type);
+}
+
 static
 void test_instantiate_event_before_stream(struct bt_ctf_writer *writer,
 		struct bt_ctf_clock *clock)
@@ -2035,6 +2303,8 @@ int main(int argc, char **argv)
 
 	test_custom_event_header_stream(writer, clock);
 
+	test_streaming_stream(writer, clock);
+
 	metadata_string = bt_ctf_writer_get_metadata_string(writer);
 	ok(metadata_string, "Get metadata string");
 
@@ -2058,6 +2328,7 @@ int main(int argc, char **argv)
 	bt_ctf_object_put_ref(stream_class);
 
 	validate_trace(argv[1], trace_path);
+	validate_streaming_stream(argv[1], trace_path);
 
 	recursive_rmdir(trace_path);
 	g_free(trace_path);
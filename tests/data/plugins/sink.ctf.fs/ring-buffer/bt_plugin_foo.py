@@ -0,0 +1,52 @@
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# Copyright (C) 2024 EfficiOS Inc.
+#
+
+import bt2
+
+
+class TheSourceIterator(bt2._UserMessageIterator):
+    def __init__(self, config, port):
+        tc, sc, ecs = port.user_data
+
+        trace = tc()
+        stream = trace.create_stream(sc, name="the-stream")
+
+        self._msgs = [self._create_stream_beginning_message(stream)]
+
+        # Four packets of 100 ns, each one containing a single event of
+        # its own event class.
+        for i, ec in enumerate(ecs):
+            packet = stream.create_packet()
+            self._msgs += [
+                self._create_packet_beginning_message(packet, i * 100),
+                self._create_event_message(ec, packet, i * 100 + 50),
+                self._create_packet_end_message(packet, i * 100 + 100),
+            ]
+
+        self._msgs.append(self._create_stream_end_message(stream))
+
+    def __next__(self):
+        if len(self._msgs) == 0:
+            raise StopIteration
+
+        return self._msgs.pop(0)
+
+
+@bt2.plugin_component_class
+class TheSource(bt2._UserSourceComponent, message_iterator_class=TheSourceIterator):
+    def __init__(self, config, params, obj):
+        tc = self._create_trace_class()
+        cc = self._create_clock_class()
+        sc = tc.create_stream_class(
+            default_clock_class=cc,
+            supports_packets=True,
+            packets_have_beginning_default_clock_snapshot=True,
+            packets_have_end_default_clock_snapshot=True,
+        )
+        ecs = [sc.create_event_class(name="event-{}".format(i)) for i in range(4)]
+        self._add_output_port("out", user_data=(tc, sc, ecs))
+
+
+bt2.register_plugin(__name__, "foo")
@@ -0,0 +1,62 @@
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# Copyright (C) 2024 EfficiOS Inc.
+#
+
+import bt2
+
+
+class TheSourceIterator(bt2._UserMessageIterator):
+    def __init__(self, config, port):
+        tc, sc, ec_a, ec_b = port.user_data
+
+        trace = tc(name="the-trace")
+        stream1 = trace.create_stream(sc, name="s1")
+        stream2 = trace.create_stream(sc, name="s2")
+        packet1 = stream1.create_packet()
+        packet2 = stream1.create_packet()
+        packet3 = stream2.create_packet()
+
+        self._msgs = [
+            self._create_stream_beginning_message(stream1),
+            self._create_stream_beginning_message(stream2),
+            self._create_packet_beginning_message(packet1),
+            self._create_event_message(ec_a, packet1, 1000),
+            self._create_packet_beginning_message(packet3),
+            self._create_event_message(ec_b, packet3, 1500),
+            self._create_event_message(ec_a, packet1, 2000),
+            self._create_event_message(ec_a, packet1, 3000),
+            self._create_packet_end_message(packet1),
+            self._create_packet_beginning_message(packet2),
+            self._create_event_message(ec_a, packet2, 4000),
+            self._create_packet_end_message(packet2),
+            self._create_discarded_events_message(stream2, count=2),
+            self._create_event_message(ec_b, packet3, 5500),
+            self._create_packet_end_message(packet3),
+            self._create_stream_end_message(stream1),
+            self._create_stream_end_message(stream2),
+        ]
+
+    def __next__(self):
+        if len(self._msgs) == 0:
+            raise StopIteration
+
+        return self._msgs.pop(0)
+
+
+@bt2.plugin_component_class
+class TheSource(bt2._UserSourceComponent, message_iterator_class=TheSourceIterator):
+    def __init__(self, config, params, obj):
+        tc = self._create_trace_class()
+        cc = self._create_clock_class(frequency=1000000000)
+        sc = tc.create_stream_class(
+            default_clock_class=cc,
+            supports_packets=True,
+            supports_discarded_events=True,
+        )
+        ec_a = sc.create_event_class(name="a")
+        ec_b = sc.create_event_class(name="b")
+        self._add_output_port("out", user_data=(tc, sc, ec_a, ec_b))
+
+
+bt2.register_plugin(__name__, "foo")
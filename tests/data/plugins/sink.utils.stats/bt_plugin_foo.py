@@ -0,0 +1,60 @@
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# Copyright (C) 2024 EfficiOS Inc.
+#
+
+import bt2
+
+
+class TheSourceIterator(bt2._UserMessageIterator):
+    def __init__(self, config, port):
+        tc, sc, ec_a, ec_b = port.user_data
+
+        trace = tc()
+        stream1 = trace.create_stream(sc, name="s1")
+        stream2 = trace.create_stream(sc, name="s2")
+
+        self._msgs = [
+            self._create_stream_beginning_message(stream1),
+            self._create_stream_beginning_message(stream2),
+        ]
+
+        # (event class, stream, time, `cpu` payload field value)
+        for ec, stream, ts, cpu in [
+            (ec_a, stream1, 0, 0),
+            (ec_a, stream1, 100, 1),
+            (ec_b, stream2, 200, 1),
+            (ec_b, stream1, 1500, 0),
+            (ec_b, stream2, 2100, 0),
+            (ec_a, stream1, 2500, 0),
+        ]:
+            msg = self._create_event_message(ec, stream, default_clock_snapshot=ts)
+            msg.event.payload_field["cpu"] = cpu
+            self._msgs.append(msg)
+
+        self._msgs += [
+            self._create_stream_end_message(stream1),
+            self._create_stream_end_message(stream2),
+        ]
+
+    def __next__(self):
+        if len(self._msgs) == 0:
+            raise StopIteration
+
+        return self._msgs.pop(0)
+
+
+@bt2.plugin_component_class
+class TheSource(bt2._UserSourceComponent, message_iterator_class=TheSourceIterator):
+    def __init__(self, config, params, obj):
+        tc = self._create_trace_class()
+        cc = self._create_clock_class(frequency=1000000000)
+        sc = tc.create_stream_class(default_clock_class=cc)
+        payload_fc = tc.create_structure_field_class()
+        payload_fc += [("cpu", tc.create_unsigned_integer_field_class())]
+        ec_a = sc.create_event_class(name="a", payload_field_class=payload_fc)
+        ec_b = sc.create_event_class(name="b", payload_field_class=payload_fc)
+        self._add_output_port("out", user_data=(tc, sc, ec_a, ec_b))
+
+
+bt2.register_plugin(__name__, "foo")
@@ -512,7 +512,18 @@ class _LttngLiveViewerProtocolCodec:
             fmt, data, _LttngLiveViewerProtocolCodec._COMMAND_HEADER_SIZE_BYTES
         )
 
+    # Decodes the first command of `data`, returning the command and its
+    # size (bytes), or `None` if `data` doesn't contain a whole command.
     def decode(self, data: bytes):
+        cmd = self._decode(data)
+
+        if cmd is None:
+            return
+
+        payload_size, _, _ = self._unpack(self._COMMAND_HEADER_STRUCT_FMT, data)
+        return cmd, self._COMMAND_HEADER_SIZE_BYTES + payload_size
+
+    def _decode(self, data: bytes):
         if len(data) < self._COMMAND_HEADER_SIZE_BYTES:
             # Not enough data to read the command header
             return
@@ -814,10 +825,15 @@ class _LttngStream(ABC):
 # An LTTng data stream.
 class _LttngDataStream(_LttngStream):
     def __init__(
-        self, path: str, beacons_json: Optional[tjson.ArrayVal], creation_timestamp: int
+        self,
+        path: str,
+        beacons_json: Optional[tjson.ArrayVal],
+        creation_timestamp: int,
+        retry_count: int = 0,
     ):
         super().__init__(creation_timestamp)
         self._path = path
+        self._retry_count = retry_count
         filename = os.path.basename(path)
         match = re.match(r"(.*)_\d+", filename)
         if not match:
@@ -849,6 +865,12 @@ class _LttngDataStream(_LttngStream):
     def index(self):
         return self._index
 
+    # Number of "get next data stream index entry" commands to which the
+    # server replies `RETRY` before replying with the first index entry.
+    @property
+    def retry_count(self):
+        return self._retry_count
+
     def get_data(self, offset_bytes: int, len_bytes: int):
         self._file.seek(offset_bytes)
         return self._file.read(len_bytes)
@@ -1036,15 +1058,19 @@ class LttngTrace(Sequence[_LttngDataStream]):
         metadata_sections_json: Optional[tjson.ArrayVal],
         beacons_json: Optional[tjson.ObjVal],
         creation_timestamp: int,
+        retries_json: Optional[tjson.ObjVal] = None,
     ):
         self._path = trace_dir
         self._creation_timestamp = creation_timestamp
         self._create_metadata_stream(trace_dir, metadata_sections_json)
-        self._create_data_streams(trace_dir, beacons_json)
+        self._create_data_streams(trace_dir, beacons_json, retries_json)
         logging.info('Built trace: path="{}"'.format(trace_dir))
 
     def _create_data_streams(
-        self, trace_dir: str, beacons_json: Optional[tjson.ObjVal]
+        self,
+        trace_dir: str,
+        beacons_json: Optional[tjson.ObjVal],
+        retries_json: Optional[tjson.ObjVal],
     ):
         data_stream_paths = []  # type: list[str]
 
@@ -1071,9 +1097,16 @@ class LttngTrace(Sequence[_LttngDataStream]):
             if beacons_json is not None and stream_name in beacons_json:
                 this_beacons_json = beacons_json.at(stream_name, tjson.ArrayVal)
 
+            retry_count = 0
+            if retries_json is not None and stream_name in retries_json:
+                retry_count = retries_json.at(stream_name, tjson.IntVal).val
+
             self._data_streams.append(
                 _LttngDataStream(
-                    data_stream_path, this_beacons_json, self._creation_timestamp
+                    data_stream_path,
+                    this_beacons_json,
+                    self._creation_timestamp,
+                    retry_count,
                 )
             )
 
@@ -1164,6 +1197,7 @@ class _LttngLiveViewerSessionDataStreamState(_LttngLiveViewerSessionStreamState)
         self._data_stream = data_stream
         self._metadata_stream_id = metadata_stream_id
         self._cur_index_entry_index = 0
+        self._remaining_retry_count = data_stream.retry_count
         fmt = 'Built data stream state: id={}, ts-id={}, ts-name="{}", path="{}"'
         logging.info(
             fmt.format(
@@ -1200,6 +1234,15 @@ class _LttngLiveViewerSessionDataStreamState(_LttngLiveViewerSessionStreamState)
     def goto_next_index_entry(self):
         self._cur_index_entry_index += 1
 
+    # Returns whether or not the server must reply `RETRY` to the
+    # current "get next data stream index entry" command.
+    def consume_retry(self):
+        if self._remaining_retry_count == 0:
+            return False
+
+        self._remaining_retry_count -= 1
+        return True
+
 
 # The state of a single metadata stream.
 class _LttngLiveViewerSessionMetadataStreamState(_LttngLiveViewerSessionStreamState):
@@ -1597,6 +1640,18 @@ class _LttngLiveViewerSession:
                 status, index_entry, False, False
             )
 
+        if stream_state.consume_retry():
+            # No index entry available yet
+            status = _LttngLiveViewerGetNextDataStreamIndexEntryReply.Status.RETRY
+
+            # Dummy data stream index entry to use with the `RETRY`
+            # status (the reply needs one, but the viewer ignores it)
+            index_entry = _LttngDataStreamIndexEntry(0, 0, 0, 0, 0, 0, 0)
+
+            return _LttngLiveViewerGetNextDataStreamIndexEntryReply(
+                status, index_entry, False, False
+            )
+
         timestamp_begin = _get_entry_timestamp_begin(stream_state.cur_index_entry)
 
         if needs_new_metadata_section(metadata_stream_state, timestamp_begin):
@@ -1801,6 +1856,9 @@ class LttngLiveServer:
         self._sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
         self._codec = _LttngLiveViewerProtocolCodec()
 
+        # Received command data not decoded yet
+        self._recv_data = bytes()
+
         # Port 0: OS assigns an unused port
         serv_addr = ("localhost", port if port is not None else 0)
         self._sock.bind(serv_addr)
@@ -1829,19 +1887,34 @@ class LttngLiveServer:
         return self._sock.getsockname()[1]
 
     def _recv_command(self):
-        data = bytes()
-
         while True:
+            # The viewer may send many commands at once: first try to
+            # decode a command from what it already sent.
+            try:
+                res = self._codec.decode(self._recv_data)
+            except struct.error as exc:
+                raise RuntimeError("Malformed command: {}".format(exc)) from exc
+
+            if res is not None:
+                cmd, size = res
+                self._recv_data = self._recv_data[size:]
+                logging.info(
+                    "Received command from viewer: cmd-cls-name={}".format(
+                        cmd.__class__.__name__
+                    )
+                )
+                return cmd
+
             logging.info("Waiting for viewer command.")
             buf = self._conn.recv(128)
 
             if not buf:
                 logging.info("Client closed connection.")
 
-                if data:
+                if self._recv_data:
                     raise RuntimeError(
                         "Client closed connection after having sent {} command bytes.".format(
-                            len(data)
+                            len(self._recv_data)
                         )
                     )
 
@@ -1849,20 +1922,7 @@ class LttngLiveServer:
 
             logging.info("Received data from viewer: length={}".format(len(buf)))
 
-            data += buf
-
-            try:
-                cmd = self._codec.decode(data)
-            except struct.error as exc:
-                raise RuntimeError("Malformed command: {}".format(exc)) from exc
-
-            if cmd is not None:
-                logging.info(
-                    "Received command from viewer: cmd-cls-name={}".format(
-                        cmd.__class__.__name__
-                    )
-                )
-                return cmd
+            self._recv_data += buf
 
     def _send_reply(self, reply: _LttngLiveViewerReply):
         data = self._codec.encode(reply)
@@ -1989,6 +2049,9 @@ def _session_descriptors_from_path(
     #                     "beacons": {
     #                         "my_stream": [ 5235787, 728375283 ]
     #                     },
+    #                     "retries": {
+    #                         "my_stream": 3
+    #                     },
     #                     "metadata-sections": [
     #                           {
     #                                "line": 1,
@@ -2025,6 +2088,11 @@ def _session_descriptors_from_path(
                 if "beacons" in trace_json
                 else None
             )
+            retries = (
+                trace_json.at("retries", tjson.ObjVal)
+                if "retries" in trace_json
+                else None
+            )
             path = trace_json.at("path", tjson.StrVal).val
             creation_timestamp = (
                 trace_json.at("creation-timestamp", tjson.IntVal).val
@@ -2036,7 +2104,9 @@ def _session_descriptors_from_path(
                 path = os.path.join(trace_path_prefix, path)
 
             traces.append(
-                LttngTrace(path, metadata_sections, beacons, creation_timestamp)
+                LttngTrace(
+                    path, metadata_sections, beacons, creation_timestamp, retries
+                )
             )
 
         sessions.append(
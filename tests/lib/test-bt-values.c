@@ -9,10 +9,12 @@
 
 #include <babeltrace2/babeltrace.h>
 #include "common/assert.h"
+#include <inttypes.h>
+#include <stdio.h>
 #include <string.h>
 #include "tap/tap.h"
 
-#define NR_TESTS 190
+#define NR_TESTS 195
 
 static
 void test_null(void)
@@ -735,6 +737,71 @@ void test_map(void)
 	pass("putting an existing map value object does not cause a crash")
 }
 
+static
+void test_map_many_entries(void)
+{
+	int ret = 0;
+	bt_bool all_found = BT_TRUE;
+	bt_bool all_replaced = BT_TRUE;
+	uint64_t i;
+	char key[32];
+	bt_value *obj;
+	bt_value *map_obj;
+	bt_value *map_copy_obj = NULL;
+	const uint64_t entry_count = 1000;
+
+	map_obj = bt_value_map_create();
+	BT_ASSERT(map_obj);
+
+	for (i = 0; i < entry_count; i++) {
+		snprintf(key, sizeof(key), "key-%" PRIu64, i);
+		ret |= bt_value_map_insert_unsigned_integer_entry(map_obj,
+			key, i);
+	}
+
+	ok(!ret && bt_value_map_get_size(map_obj) == entry_count,
+		"inserting many entries into a map value object succeeds");
+
+	for (i = 0; i < entry_count; i++) {
+		snprintf(key, sizeof(key), "key-%" PRIu64, i);
+		obj = bt_value_map_borrow_entry_value(map_obj, key);
+		if (!obj || bt_value_integer_unsigned_get(obj) != i) {
+			all_found = BT_FALSE;
+		}
+	}
+
+	ok(all_found,
+		"bt_value_map_borrow_entry_value() finds all the entries of a large map value object");
+	ok(!bt_value_map_has_entry(map_obj, "key-none"),
+		"large map value object has no key \"key-none\"");
+
+	for (i = 0; i < entry_count; i += 3) {
+		snprintf(key, sizeof(key), "key-%" PRIu64, i);
+		ret |= bt_value_map_insert_unsigned_integer_entry(map_obj,
+			key, i + entry_count);
+	}
+
+	for (i = 0; i < entry_count; i++) {
+		snprintf(key, sizeof(key), "key-%" PRIu64, i);
+		obj = bt_value_map_borrow_entry_value(map_obj, key);
+		if (!obj || bt_value_integer_unsigned_get(obj) !=
+				(i % 3 == 0 ? i + entry_count : i)) {
+			all_replaced = BT_FALSE;
+		}
+	}
+
+	ok(!ret && all_replaced &&
+		bt_value_map_get_size(map_obj) == entry_count,
+		"replacing entries of a large map value object keeps its size");
+
+	ret = bt_value_copy(map_obj, &map_copy_obj);
+	ok(!ret && bt_value_is_equal(map_obj, map_copy_obj),
+		"copy of a large map value object is equal to the original");
+
+	BT_VALUE_PUT_REF_AND_RESET(map_copy_obj);
+	BT_VALUE_PUT_REF_AND_RESET(map_obj);
+}
+
 static
 void test_types(void)
 {
@@ -746,6 +813,7 @@ void test_types(void)
 	test_string();
 	test_array();
 	test_map();
+	test_map_many_entries();
 }
 
 static
@@ -0,0 +1,538 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Copyright (C) 2024 EfficiOS, Inc.
+ *
+ * Runs independent graphs concurrently, in different threads, all of
+ * them sharing the same source component class, while other threads
+ * load the plugins of a directory.
+ */
+
+#include <babeltrace2/babeltrace.h>
+#include "common/assert.h"
+#include "common/common.h"
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <glib.h>
+
+#include "tap/tap.h"
+
+#define NR_TESTS 6
+
+/* Number of threads running graphs concurrently */
+#define NR_THREADS	8
+
+/* Number of graphs which each thread creates and runs, one at a time */
+#define NR_GRAPHS_PER_THREAD	50
+
+/* Number of event messages which each source message iterator emits */
+#define NR_EVENTS	1000
+
+/* Number of entries of the parameters of each source component */
+#define NR_PARAMS	64
+
+/* Number of threads loading plugins concurrently */
+#define NR_PLUGIN_THREADS	4
+
+/* Number of times each plugin thread loads the plugins of the directory */
+#define NR_LOADS_PER_PLUGIN_THREAD	10
+
+/* Trace IR objects of a source component */
+struct src_data {
+	bt_trace_class *tc;
+	bt_stream_class *sc;
+	bt_event_class *ec;
+	bt_trace *trace;
+	bt_stream *stream;
+};
+
+/* Source message iterator state */
+struct src_iter_data {
+	struct src_data *src_data;
+	bt_packet *packet;
+
+	/* Number of messages emitted so far */
+	uint64_t msg_count;
+};
+
+/* Results which the simple sink of a graph collects */
+struct sink_data {
+	uint64_t event_count;
+	bool packets_ok;
+};
+
+/* Results of a thread */
+struct thread_data {
+	/* Shared source component class */
+	const bt_component_class_source *src_comp_cls;
+
+	/* Number of graphs which ran successfully */
+	unsigned int graphs_ok;
+
+	/* Number of graphs of which the sink got all the events */
+	unsigned int sinks_ok;
+
+	/* Number of source components which got the expected parameters */
+	unsigned int params_ok;
+};
+
+/* Results of a plugin thread */
+struct plugin_thread_data {
+	/* Directory of the plugins to load */
+	const char *plugin_dir;
+
+	/* Number of plugins which a serial load finds */
+	uint64_t plugin_count;
+
+	/* Number of loads which found `plugin_count` plugins */
+	unsigned int loads_ok;
+};
+
+static
+bool check_params(const bt_value *params)
+{
+	char key[32];
+	uint64_t i;
+
+	if (bt_value_map_get_size(params) != NR_PARAMS) {
+		return false;
+	}
+
+	for (i = 0; i < NR_PARAMS; i++) {
+		const bt_value *entry;
+
+		snprintf(key, sizeof(key), "param-%" PRIu64, i);
+		entry = bt_value_map_borrow_entry_value_const(params, key);
+		if (!entry || !bt_value_is_unsigned_integer(entry) ||
+				bt_value_integer_unsigned_get(entry) != i) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static
+bt_component_class_initialize_method_status src_init(
+		bt_self_component_source *self_comp,
+		bt_self_component_source_configuration *config __attribute__((unused)),
+		const bt_value *params, void *init_method_data)
+{
+	bt_self_component *self_comp_base =
+		bt_self_component_source_as_self_component(self_comp);
+	unsigned int *params_ok = init_method_data;
+	bt_self_component_add_port_status add_port_status;
+	struct src_data *data = g_new0(struct src_data, 1);
+
+	BT_ASSERT(data);
+
+	if (check_params(params)) {
+		(*params_ok)++;
+	}
+
+	add_port_status = bt_self_component_source_add_output_port(self_comp,
+		"out", NULL, NULL);
+	BT_ASSERT(add_port_status == BT_SELF_COMPONENT_ADD_PORT_STATUS_OK);
+	data->tc = bt_trace_class_create(self_comp_base);
+	BT_ASSERT(data->tc);
+	data->sc = bt_stream_class_create(data->tc);
+	BT_ASSERT(data->sc);
+	bt_stream_class_set_supports_packets(data->sc, BT_TRUE, BT_FALSE,
+		BT_FALSE);
+	data->ec = bt_event_class_create(data->sc);
+	BT_ASSERT(data->ec);
+	data->trace = bt_trace_create(data->tc);
+	BT_ASSERT(data->trace);
+	data->stream = bt_stream_create(data->sc, data->trace);
+	BT_ASSERT(data->stream);
+	bt_self_component_set_data(self_comp_base, data);
+	return BT_COMPONENT_CLASS_INITIALIZE_METHOD_STATUS_OK;
+}
+
+static
+void src_finalize(bt_self_component_source *self_comp)
+{
+	struct src_data *data = bt_self_component_get_data(
+		bt_self_component_source_as_self_component(self_comp));
+
+	BT_STREAM_PUT_REF_AND_RESET(data->stream);
+	BT_TRACE_PUT_REF_AND_RESET(data->trace);
+	BT_EVENT_CLASS_PUT_REF_AND_RESET(data->ec);
+	BT_STREAM_CLASS_PUT_REF_AND_RESET(data->sc);
+	BT_TRACE_CLASS_PUT_REF_AND_RESET(data->tc);
+	g_free(data);
+}
+
+static
+bt_message_iterator_class_initialize_method_status src_iter_init(
+		bt_self_message_iterator *self_msg_iter,
+		bt_self_message_iterator_configuration *config __attribute__((unused)),
+		bt_self_component_port_output *port __attribute__((unused)))
+{
+	struct src_iter_data *data = g_new0(struct src_iter_data, 1);
+
+	BT_ASSERT(data);
+	data->src_data = bt_self_component_get_data(
+		bt_self_message_iterator_borrow_component(self_msg_iter));
+	bt_self_message_iterator_set_data(self_msg_iter, data);
+	return BT_MESSAGE_ITERATOR_CLASS_INITIALIZE_METHOD_STATUS_OK;
+}
+
+static
+void src_iter_finalize(bt_self_message_iterator *self_msg_iter)
+{
+	struct src_iter_data *data =
+		bt_self_message_iterator_get_data(self_msg_iter);
+
+	BT_PACKET_PUT_REF_AND_RESET(data->packet);
+	g_free(data);
+}
+
+/*
+ * Emits a stream beginning message, a packet beginning message,
+ * `NR_EVENTS` event messages, a packet end message, and a stream end
+ * message.
+ */
+static
+bt_message_iterator_class_next_method_status src_iter_next(
+		bt_self_message_iterator *self_msg_iter,
+		bt_message_array_const msgs, uint64_t capacity,
+		uint64_t *count)
+{
+	struct src_iter_data *data =
+		bt_self_message_iterator_get_data(self_msg_iter);
+	struct src_data *src_data = data->src_data;
+	const uint64_t total_msg_count = NR_EVENTS + 4;
+	uint64_t i = 0;
+
+	if (data->msg_count == total_msg_count) {
+		return BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_END;
+	}
+
+	while (i < capacity && data->msg_count < total_msg_count) {
+		const bt_message *msg;
+
+		if (data->msg_count == 0) {
+			msg = bt_message_stream_beginning_create(self_msg_iter,
+				src_data->stream);
+		} else if (data->msg_count == 1) {
+			data->packet = bt_packet_create(src_data->stream);
+			BT_ASSERT(data->packet);
+			msg = bt_message_packet_beginning_create(self_msg_iter,
+				data->packet);
+		} else if (data->msg_count == total_msg_count - 2) {
+			msg = bt_message_packet_end_create(self_msg_iter,
+				data->packet);
+			BT_PACKET_PUT_REF_AND_RESET(data->packet);
+		} else if (data->msg_count == total_msg_count - 1) {
+			msg = bt_message_stream_end_create(self_msg_iter,
+				src_data->stream);
+		} else {
+			msg = bt_message_event_create_with_packet(
+				self_msg_iter, src_data->ec, data->packet);
+		}
+
+		BT_ASSERT(msg);
+		msgs[i] = msg;
+		i++;
+		data->msg_count++;
+	}
+
+	*count = i;
+	return BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_OK;
+}
+
+static
+bt_graph_simple_sink_component_consume_func_status sink_consume(
+		bt_message_iterator *msg_iter, void *user_data)
+{
+	struct sink_data *data = user_data;
+	bt_message_array_const msgs;
+	uint64_t count;
+	uint64_t i;
+
+	switch (bt_message_iterator_next(msg_iter, &msgs, &count)) {
+	case BT_MESSAGE_ITERATOR_NEXT_STATUS_OK:
+		for (i = 0; i < count; i++) {
+			if (bt_message_get_type(msgs[i]) ==
+					BT_MESSAGE_TYPE_EVENT) {
+				const bt_event *event =
+					bt_message_event_borrow_event_const(
+						msgs[i]);
+
+				if (!bt_event_borrow_packet_const(event)) {
+					data->packets_ok = false;
+				}
+
+				data->event_count++;
+			}
+
+			bt_message_put_ref(msgs[i]);
+		}
+
+		return BT_GRAPH_SIMPLE_SINK_COMPONENT_CONSUME_FUNC_STATUS_OK;
+	case BT_MESSAGE_ITERATOR_NEXT_STATUS_AGAIN:
+		return BT_GRAPH_SIMPLE_SINK_COMPONENT_CONSUME_FUNC_STATUS_AGAIN;
+	case BT_MESSAGE_ITERATOR_NEXT_STATUS_END:
+		return BT_GRAPH_SIMPLE_SINK_COMPONENT_CONSUME_FUNC_STATUS_END;
+	default:
+		bt_common_abort();
+	}
+}
+
+static
+bt_value *create_params(void)
+{
+	bt_value *params = bt_value_map_create();
+	char key[32];
+	uint64_t i;
+
+	BT_ASSERT(params);
+
+	for (i = 0; i < NR_PARAMS; i++) {
+		bt_value_map_insert_entry_status insert_status;
+
+		snprintf(key, sizeof(key), "param-%" PRIu64, i);
+		insert_status = bt_value_map_insert_unsigned_integer_entry(
+			params, key, i);
+		BT_ASSERT(insert_status == BT_VALUE_MAP_INSERT_ENTRY_STATUS_OK);
+	}
+
+	return params;
+}
+
+/*
+ * Creates and runs a graph made of a source component of the class
+ * `thread_data->src_comp_cls` connected to a simple sink component,
+ * updating `thread_data` with the results.
+ */
+static
+void run_one_graph(struct thread_data *thread_data)
+{
+	struct sink_data sink_data = {
+		.event_count = 0,
+		.packets_ok = true,
+	};
+	bt_graph *graph;
+	bt_value *params;
+	const bt_component_source *src_comp = NULL;
+	const bt_component_sink *sink_comp = NULL;
+	bt_graph_add_component_status add_comp_status;
+	bt_graph_connect_ports_status connect_status;
+	bt_graph_run_status run_status;
+
+	params = create_params();
+	graph = bt_graph_create(0);
+	BT_ASSERT(graph);
+	add_comp_status = bt_graph_add_source_component_with_initialize_method_data(
+		graph, thread_data->src_comp_cls, "src", params,
+		&thread_data->params_ok, BT_LOGGING_LEVEL_NONE, &src_comp);
+	BT_ASSERT(add_comp_status == BT_GRAPH_ADD_COMPONENT_STATUS_OK);
+	add_comp_status = bt_graph_add_simple_sink_component(graph, "sink",
+		NULL, sink_consume, NULL, &sink_data, &sink_comp);
+	BT_ASSERT(add_comp_status == BT_GRAPH_ADD_COMPONENT_STATUS_OK);
+	connect_status = bt_graph_connect_ports(graph,
+		bt_component_source_borrow_output_port_by_index_const(
+			src_comp, 0),
+		bt_component_sink_borrow_input_port_by_index_const(
+			sink_comp, 0),
+		NULL);
+	BT_ASSERT(connect_status == BT_GRAPH_CONNECT_PORTS_STATUS_OK);
+
+	do {
+		run_status = bt_graph_run(graph);
+	} while (run_status == BT_GRAPH_RUN_STATUS_AGAIN);
+
+	if (run_status == BT_GRAPH_RUN_STATUS_OK) {
+		thread_data->graphs_ok++;
+	}
+
+	if (sink_data.event_count == NR_EVENTS && sink_data.packets_ok) {
+		thread_data->sinks_ok++;
+	}
+
+	bt_graph_put_ref(graph);
+	bt_value_put_ref(params);
+}
+
+static
+void *thread_func(void *arg)
+{
+	struct thread_data *thread_data = arg;
+	unsigned int i;
+
+	for (i = 0; i < NR_GRAPHS_PER_THREAD; i++) {
+		run_one_graph(thread_data);
+	}
+
+	return NULL;
+}
+
+/*
+ * Loads the plugins of the directory `plugin_dir`, setting
+ * `*plugin_count` to their number.
+ *
+ * Returns false on error.
+ */
+static
+bool load_plugins(const char *plugin_dir, uint64_t *plugin_count)
+{
+	const bt_plugin_set *plugin_set = NULL;
+
+	switch (bt_plugin_find_all_from_dir(plugin_dir, BT_TRUE, BT_TRUE,
+			&plugin_set)) {
+	case BT_PLUGIN_FIND_ALL_FROM_DIR_STATUS_OK:
+		*plugin_count = bt_plugin_set_get_plugin_count(plugin_set);
+		bt_plugin_set_put_ref(plugin_set);
+		return true;
+	case BT_PLUGIN_FIND_ALL_FROM_DIR_STATUS_NOT_FOUND:
+		/* For example, with built-in plugins */
+		*plugin_count = 0;
+		return true;
+	default:
+		bt_current_thread_clear_error();
+		return false;
+	}
+}
+
+static
+void *plugin_thread_func(void *arg)
+{
+	struct plugin_thread_data *plugin_thread_data = arg;
+	unsigned int i;
+
+	for (i = 0; i < NR_LOADS_PER_PLUGIN_THREAD; i++) {
+		uint64_t plugin_count;
+
+		if (load_plugins(plugin_thread_data->plugin_dir,
+				&plugin_count) &&
+				plugin_count == plugin_thread_data->plugin_count) {
+			plugin_thread_data->loads_ok++;
+		}
+	}
+
+	return NULL;
+}
+
+static
+bt_component_class_source *create_src_comp_cls(void)
+{
+	bt_message_iterator_class *msg_iter_cls;
+	bt_component_class_source *src_comp_cls;
+	bt_component_class_set_method_status set_method_status;
+	bt_message_iterator_class_set_method_status set_iter_method_status;
+
+	msg_iter_cls = bt_message_iterator_class_create(src_iter_next);
+	BT_ASSERT(msg_iter_cls);
+	set_iter_method_status =
+		bt_message_iterator_class_set_initialize_method(msg_iter_cls,
+			src_iter_init);
+	BT_ASSERT(set_iter_method_status ==
+		BT_MESSAGE_ITERATOR_CLASS_SET_METHOD_STATUS_OK);
+	set_iter_method_status =
+		bt_message_iterator_class_set_finalize_method(msg_iter_cls,
+			src_iter_finalize);
+	BT_ASSERT(set_iter_method_status ==
+		BT_MESSAGE_ITERATOR_CLASS_SET_METHOD_STATUS_OK);
+
+	src_comp_cls = bt_component_class_source_create("src", msg_iter_cls);
+	BT_ASSERT(src_comp_cls);
+	set_method_status = bt_component_class_source_set_initialize_method(
+		src_comp_cls, src_init);
+	BT_ASSERT(set_method_status == BT_COMPONENT_CLASS_SET_METHOD_STATUS_OK);
+	set_method_status = bt_component_class_source_set_finalize_method(
+		src_comp_cls, src_finalize);
+	BT_ASSERT(set_method_status == BT_COMPONENT_CLASS_SET_METHOD_STATUS_OK);
+	bt_message_iterator_class_put_ref(msg_iter_cls);
+	return src_comp_cls;
+}
+
+static
+void test_concurrent_graphs(const char *plugin_dir)
+{
+	bt_component_class_source *src_comp_cls = create_src_comp_cls();
+	struct thread_data thread_data[NR_THREADS];
+	pthread_t threads[NR_THREADS];
+	struct plugin_thread_data plugin_thread_data[NR_PLUGIN_THREADS];
+	pthread_t plugin_threads[NR_PLUGIN_THREADS];
+	unsigned int created_thread_count = 0;
+	unsigned int created_plugin_thread_count = 0;
+	unsigned int graphs_ok = 0;
+	unsigned int sinks_ok = 0;
+	unsigned int params_ok = 0;
+	unsigned int loads_ok = 0;
+	uint64_t plugin_count;
+	bool load_ok;
+	unsigned int i;
+
+	/* Serial load to know what to expect */
+	load_ok = load_plugins(plugin_dir, &plugin_count);
+	BT_ASSERT(load_ok);
+	diag("Plugin directory `%s` contains %" PRIu64 " plugin(s)",
+		plugin_dir, plugin_count);
+
+	for (i = 0; i < NR_THREADS; i++) {
+		thread_data[i] = (struct thread_data) {
+			.src_comp_cls = src_comp_cls,
+		};
+
+		if (pthread_create(&threads[i], NULL, thread_func,
+				&thread_data[i]) == 0) {
+			created_thread_count++;
+		} else {
+			break;
+		}
+	}
+
+	for (i = 0; i < NR_PLUGIN_THREADS; i++) {
+		plugin_thread_data[i] = (struct plugin_thread_data) {
+			.plugin_dir = plugin_dir,
+			.plugin_count = plugin_count,
+		};
+
+		if (pthread_create(&plugin_threads[i], NULL,
+				plugin_thread_func,
+				&plugin_thread_data[i]) == 0) {
+			created_plugin_thread_count++;
+		} else {
+			break;
+		}
+	}
+
+	ok(created_thread_count == NR_THREADS, "All threads are created");
+	ok(created_plugin_thread_count == NR_PLUGIN_THREADS,
+		"All plugin threads are created");
+
+	for (i = 0; i < created_thread_count; i++) {
+		pthread_join(threads[i], NULL);
+		graphs_ok += thread_data[i].graphs_ok;
+		sinks_ok += thread_data[i].sinks_ok;
+		params_ok += thread_data[i].params_ok;
+	}
+
+	for (i = 0; i < created_plugin_thread_count; i++) {
+		pthread_join(plugin_threads[i], NULL);
+		loads_ok += plugin_thread_data[i].loads_ok;
+	}
+
+	ok(graphs_ok == created_thread_count * NR_GRAPHS_PER_THREAD,
+		"All the graphs run successfully");
+	ok(sinks_ok == created_thread_count * NR_GRAPHS_PER_THREAD,
+		"All the sinks receive all their event messages");
+	ok(params_ok == created_thread_count * NR_GRAPHS_PER_THREAD,
+		"All the source components receive their parameters");
+	ok(loads_ok == created_plugin_thread_count * NR_LOADS_PER_PLUGIN_THREAD,
+		"All the concurrent plugin loads find the same plugins");
+	bt_component_class_source_put_ref(src_comp_cls);
+}
+
+int main(int argc, char **argv)
+{
+	BT_ASSERT(argc == 2);
+	plan_tests(NR_TESTS);
+	test_concurrent_graphs(argv[1]);
+	return exit_status();
+}
@@ -12,7 +12,7 @@
 
 namespace {
 
-constexpr int NR_TESTS = 2;
+constexpr int NR_TESTS = 13;
 
 class TestStringClear final : public RunIn
 {
@@ -44,6 +44,98 @@ public:
     }
 };
 
+/*
+ * Release function of borrowed data, `userData` being a pointer to a
+ * release count to increment.
+ */
+void incrReleaseCount(void * const userData) noexcept
+{
+    ++*static_cast<unsigned int *>(userData);
+}
+
+class TestStringBorrowedValue final : public RunIn
+{
+public:
+    void onMsgIterInit(const bt2::SelfMessageIterator self) override
+    {
+        /* Boilerplate to get a string field */
+        const auto traceCls = self.component().createTraceClass();
+        const auto streamCls = traceCls->createStreamClass();
+        const auto eventCls = streamCls->createEventClass();
+        const auto payloadCls = traceCls->createStructureFieldClass();
+
+        payloadCls->appendMember("str", *traceCls->createStringFieldClass());
+        eventCls->payloadFieldClass(*payloadCls);
+
+        const auto trace = traceCls->instantiate();
+        const auto stream = streamCls->instantiate(*trace);
+        const auto msg = self.createEventMessage(*eventCls, *stream);
+        const auto field = (*msg->event().payloadField())["str"]->asString();
+        const char buf[] = "pomme grenade";
+        unsigned int releaseCount = 0;
+
+        /* Borrow "pomme" (followed with a null character) */
+        char borrowedBuf[] = "pomme\0grenade";
+
+        field.borrowedValue(borrowedBuf, 5, incrReleaseCount, &releaseCount);
+        ok(field.value().data() == borrowedBuf, "string field value is borrowed");
+        ok(field.length() == 5, "borrowed string field value has the expected length");
+
+        /* Appending copies the borrowed value, then releases it */
+        field.append(buf + 5, 8);
+        ok(field.value() == "pomme grenade", "string field value is copied on append");
+        ok(releaseCount == 1, "borrowed string field value is released on append");
+
+        /* Borrow again, then clear */
+        field.borrowedValue(borrowedBuf, 5, incrReleaseCount, &releaseCount);
+        field.clear();
+        ok(releaseCount == 2, "borrowed string field value is released on clear");
+        ok(field.value() == "", "string field is empty after clearing borrowed value");
+    }
+};
+
+class TestBlobBorrowedData final : public RunIn
+{
+public:
+    void onMsgIterInit(const bt2::SelfMessageIterator self) override
+    {
+        /* Boilerplate to get a dynamic BLOB field */
+        const auto traceCls = self.component().createTraceClass();
+        const auto streamCls = traceCls->createStreamClass();
+        const auto eventCls = streamCls->createEventClass();
+        const auto payloadCls = traceCls->createStructureFieldClass();
+
+        payloadCls->appendMember("blob",
+                                 *traceCls->createDynamicBlobWithoutLengthFieldLocationFieldClass());
+        eventCls->payloadFieldClass(*payloadCls);
+
+        const auto trace = traceCls->instantiate();
+        const auto stream = streamCls->instantiate(*trace);
+        const auto msg = self.createEventMessage(*eventCls, *stream);
+        const auto field = (*msg->event().payloadField())["blob"]->asDynamicBlob();
+        const std::uint8_t borrowedBuf[] = {1, 2, 3, 4};
+        unsigned int releaseCount = 0;
+
+        field.length(4);
+        field.borrowedData(borrowedBuf, incrReleaseCount, &releaseCount);
+        ok(field.asConst().data().data() == borrowedBuf, "BLOB field data is borrowed");
+
+        /* Getting the writable data copies the borrowed data */
+        const auto data = field.data();
+
+        ok(data.data() != borrowedBuf && data[0] == 1 && data[3] == 4,
+           "BLOB field data is copied when getting the writable data");
+        ok(releaseCount == 1, "borrowed BLOB field data is released when copied");
+
+        /* Borrow again, then set the length */
+        field.borrowedData(borrowedBuf, incrReleaseCount, &releaseCount);
+        field.length(2);
+        ok(releaseCount == 2, "borrowed BLOB field data is released when setting the length");
+        ok(field.asConst().data().data() != borrowedBuf,
+           "BLOB field data isn't borrowed anymore after setting the length");
+    }
+};
+
 } /* namespace */
 
 int main()
@@ -53,5 +145,11 @@ int main()
     TestStringClear testStringClear;
     runIn(testStringClear, 0);
 
+    TestStringBorrowedValue testStringBorrowedValue;
+    runIn(testStringBorrowedValue, 0);
+
+    TestBlobBorrowedData testBlobBorrowedData;
+    runIn(testBlobBorrowedData, 1);
+
     return exit_status();
 }
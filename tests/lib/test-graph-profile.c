@@ -0,0 +1,309 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Copyright (C) 2024 EfficiOS, Inc.
+ */
+
+#include <babeltrace2/babeltrace.h>
+#include "common/assert.h"
+#include "common/common.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <glib.h>
+
+#include "tap/tap.h"
+
+#define NR_TESTS 16
+
+/* Number of successful "next" method calls of the source */
+#define NR_BATCHES		10
+
+/* Number of messages per successful "next" method call */
+#define BATCH_SIZE		5
+
+/* Decoded bytes which the source reports per successful call */
+#define BYTES_PER_BATCH		4096
+
+struct src_iter_data {
+	bool returned_again;
+	uint64_t batch_count;
+	uint64_t clock_value;
+};
+
+static
+bt_component_class_initialize_method_status src_init(
+		bt_self_component_source *self_comp,
+		bt_self_component_source_configuration *config __attribute__((unused)),
+		const bt_value *params __attribute__((unused)),
+		void *init_method_data __attribute__((unused)))
+{
+	bt_self_component *self_comp_base =
+		bt_self_component_source_as_self_component(self_comp);
+	bt_self_component_add_port_status status;
+	bt_clock_class *clock_class;
+
+	status = bt_self_component_source_add_output_port(self_comp,
+		"out", NULL, NULL);
+	BT_ASSERT(status == BT_SELF_COMPONENT_ADD_PORT_STATUS_OK);
+	clock_class = bt_clock_class_create(self_comp_base);
+	BT_ASSERT(clock_class);
+	bt_self_component_set_data(self_comp_base, clock_class);
+	return BT_COMPONENT_CLASS_INITIALIZE_METHOD_STATUS_OK;
+}
+
+static
+void src_finalize(bt_self_component_source *self_comp)
+{
+	bt_clock_class_put_ref(bt_self_component_get_data(
+		bt_self_component_source_as_self_component(self_comp)));
+}
+
+static
+bt_message_iterator_class_initialize_method_status src_iter_init(
+		bt_self_message_iterator *self_msg_iter,
+		bt_self_message_iterator_configuration *config __attribute__((unused)),
+		bt_self_component_port_output *port __attribute__((unused)))
+{
+	struct src_iter_data *data = g_new0(struct src_iter_data, 1);
+
+	BT_ASSERT(data);
+	bt_self_message_iterator_set_data(self_msg_iter, data);
+	return BT_MESSAGE_ITERATOR_CLASS_INITIALIZE_METHOD_STATUS_OK;
+}
+
+static
+void src_iter_finalize(bt_self_message_iterator *self_msg_iter)
+{
+	g_free(bt_self_message_iterator_get_data(self_msg_iter));
+}
+
+static
+bt_message_iterator_class_next_method_status src_iter_next(
+		bt_self_message_iterator *self_msg_iter,
+		bt_message_array_const msgs, uint64_t capacity,
+		uint64_t *count)
+{
+	struct src_iter_data *data =
+		bt_self_message_iterator_get_data(self_msg_iter);
+	const bt_clock_class *clock_class = bt_self_component_get_data(
+		bt_self_message_iterator_borrow_component(self_msg_iter));
+	uint64_t i;
+
+	/* Make the sink try again once */
+	if (!data->returned_again) {
+		data->returned_again = true;
+		return BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_AGAIN;
+	}
+
+	if (data->batch_count == NR_BATCHES) {
+		return BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_END;
+	}
+
+	BT_ASSERT(capacity >= BATCH_SIZE);
+
+	for (i = 0; i < BATCH_SIZE; i++) {
+		msgs[i] = bt_message_message_iterator_inactivity_create(
+			self_msg_iter, clock_class, data->clock_value);
+		BT_ASSERT(msgs[i]);
+		data->clock_value++;
+	}
+
+	*count = BATCH_SIZE;
+	data->batch_count++;
+	bt_self_message_iterator_add_decoded_bytes(self_msg_iter,
+		BYTES_PER_BATCH);
+	return BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_OK;
+}
+
+static
+bt_graph_simple_sink_component_consume_func_status sink_consume(
+		bt_message_iterator *msg_iter, void *data __attribute__((unused)))
+{
+	bt_message_array_const msgs;
+	uint64_t count;
+	uint64_t i;
+
+	switch (bt_message_iterator_next(msg_iter, &msgs, &count)) {
+	case BT_MESSAGE_ITERATOR_NEXT_STATUS_OK:
+		for (i = 0; i < count; i++) {
+			bt_message_put_ref(msgs[i]);
+		}
+
+		return BT_GRAPH_SIMPLE_SINK_COMPONENT_CONSUME_FUNC_STATUS_OK;
+	case BT_MESSAGE_ITERATOR_NEXT_STATUS_AGAIN:
+		return BT_GRAPH_SIMPLE_SINK_COMPONENT_CONSUME_FUNC_STATUS_AGAIN;
+	case BT_MESSAGE_ITERATOR_NEXT_STATUS_END:
+		return BT_GRAPH_SIMPLE_SINK_COMPONENT_CONSUME_FUNC_STATUS_END;
+	default:
+		bt_common_abort();
+	}
+}
+
+static
+bt_graph *create_graph(bool enable_profiling)
+{
+	bt_message_iterator_class *msg_iter_cls;
+	bt_component_class_source *src_comp_cls;
+	bt_graph *graph;
+	const bt_component_source *src_comp = NULL;
+	const bt_component_sink *sink_comp = NULL;
+	bt_graph_add_component_status add_comp_status;
+	bt_graph_connect_ports_status connect_status;
+	bt_component_class_set_method_status set_method_status;
+	bt_message_iterator_class_set_method_status set_iter_method_status;
+
+	msg_iter_cls = bt_message_iterator_class_create(src_iter_next);
+	BT_ASSERT(msg_iter_cls);
+	set_iter_method_status =
+		bt_message_iterator_class_set_initialize_method(msg_iter_cls,
+			src_iter_init);
+	BT_ASSERT(set_iter_method_status ==
+		BT_MESSAGE_ITERATOR_CLASS_SET_METHOD_STATUS_OK);
+	set_iter_method_status =
+		bt_message_iterator_class_set_finalize_method(msg_iter_cls,
+			src_iter_finalize);
+	BT_ASSERT(set_iter_method_status ==
+		BT_MESSAGE_ITERATOR_CLASS_SET_METHOD_STATUS_OK);
+
+	src_comp_cls = bt_component_class_source_create("src", msg_iter_cls);
+	BT_ASSERT(src_comp_cls);
+	set_method_status = bt_component_class_source_set_initialize_method(
+		src_comp_cls, src_init);
+	BT_ASSERT(set_method_status == BT_COMPONENT_CLASS_SET_METHOD_STATUS_OK);
+	set_method_status = bt_component_class_source_set_finalize_method(
+		src_comp_cls, src_finalize);
+	BT_ASSERT(set_method_status == BT_COMPONENT_CLASS_SET_METHOD_STATUS_OK);
+
+	graph = bt_graph_create(0);
+	BT_ASSERT(graph);
+
+	if (enable_profiling) {
+		bt_graph_enable_profiling_status enable_status;
+
+		enable_status = bt_graph_enable_profiling(graph);
+		BT_ASSERT(enable_status == BT_GRAPH_ENABLE_PROFILING_STATUS_OK);
+	}
+
+	add_comp_status = bt_graph_add_source_component(graph, src_comp_cls,
+		"src", NULL, BT_LOGGING_LEVEL_NONE, &src_comp);
+	BT_ASSERT(add_comp_status == BT_GRAPH_ADD_COMPONENT_STATUS_OK);
+	add_comp_status = bt_graph_add_simple_sink_component(graph, "sink",
+		NULL, sink_consume, NULL, NULL, &sink_comp);
+	BT_ASSERT(add_comp_status == BT_GRAPH_ADD_COMPONENT_STATUS_OK);
+	connect_status = bt_graph_connect_ports(graph,
+		bt_component_source_borrow_output_port_by_index_const(
+			src_comp, 0),
+		bt_component_sink_borrow_input_port_by_index_const(
+			sink_comp, 0),
+		NULL);
+	BT_ASSERT(connect_status == BT_GRAPH_CONNECT_PORTS_STATUS_OK);
+	bt_component_class_source_put_ref(src_comp_cls);
+	bt_message_iterator_class_put_ref(msg_iter_cls);
+	return graph;
+}
+
+static
+void run_graph(bt_graph *graph)
+{
+	bt_graph_run_status run_status;
+
+	do {
+		run_status = bt_graph_run(graph);
+	} while (run_status == BT_GRAPH_RUN_STATUS_AGAIN);
+
+	BT_ASSERT(run_status == BT_GRAPH_RUN_STATUS_OK);
+}
+
+static
+uint64_t get_uint(const bt_value *map, const char *key)
+{
+	const bt_value *val = bt_value_map_borrow_entry_value_const(map, key);
+
+	BT_ASSERT(val);
+	return bt_value_integer_unsigned_get(val);
+}
+
+static
+void test_profile(void)
+{
+	bt_graph *graph;
+	const bt_value *profile = NULL;
+	const bt_value *comps;
+	const bt_value *src;
+	const bt_value *sink;
+	const bt_value *msg_iters;
+	bt_graph_get_profile_status get_profile_status;
+
+	graph = create_graph(true);
+	ok(bt_graph_profiling_is_enabled(graph),
+		"Graph's profiling is enabled");
+	run_graph(graph);
+	get_profile_status = bt_graph_get_profile(graph, &profile);
+	ok(get_profile_status == BT_GRAPH_GET_PROFILE_STATUS_OK,
+		"bt_graph_get_profile() succeeds");
+	BT_ASSERT(profile);
+	comps = bt_value_map_borrow_entry_value_const(profile, "components");
+	ok(comps && bt_value_array_get_length(comps) == 2,
+		"Profile has two components");
+	src = bt_value_array_borrow_element_by_index_const(comps, 0);
+	sink = bt_value_array_borrow_element_by_index_const(comps, 1);
+	ok(strcmp(bt_value_string_get(bt_value_map_borrow_entry_value_const(
+			src, "name")), "src") == 0 &&
+		strcmp(bt_value_string_get(bt_value_map_borrow_entry_value_const(
+			src, "type")), "source") == 0,
+		"Source component has the expected name and type");
+	ok(get_uint(src, "calls") == NR_BATCHES + 2,
+		"Source's \"next\" method call count is correct");
+	ok(get_uint(src, "again-count") == 1,
+		"Source's \"try again\" count is correct");
+	ok(get_uint(src, "message-count") == NR_BATCHES * BATCH_SIZE,
+		"Source's message count is correct");
+	ok(get_uint(bt_value_map_borrow_entry_value_const(src,
+			"message-counts"), "message-iterator-inactivity") ==
+			NR_BATCHES * BATCH_SIZE &&
+		get_uint(bt_value_map_borrow_entry_value_const(src,
+			"message-counts"), "event") == 0,
+		"Source's message counts by type are correct");
+	ok(bt_value_real_get(bt_value_map_borrow_entry_value_const(src,
+			"mean-batch-size")) == BATCH_SIZE,
+		"Source's mean batch size is correct");
+	ok(get_uint(src, "decoded-bytes") == NR_BATCHES * BYTES_PER_BATCH,
+		"Source's decoded byte count is correct");
+	msg_iters = bt_value_map_borrow_entry_value_const(src,
+		"message-iterators");
+	ok(msg_iters && bt_value_array_get_length(msg_iters) == 1 &&
+		get_uint(bt_value_array_borrow_element_by_index_const(
+			msg_iters, 0), "calls") == NR_BATCHES + 2,
+		"Source has one message iterator record");
+	ok(get_uint(src, "self-time-ns") <= get_uint(src, "inclusive-time-ns"),
+		"Source's self time is not greater than its inclusive time");
+	ok(strcmp(bt_value_string_get(bt_value_map_borrow_entry_value_const(
+			sink, "type")), "sink") == 0 &&
+		!bt_value_map_has_entry(sink, "message-iterators"),
+		"Sink component has the expected type and no message iterators");
+	ok(get_uint(sink, "calls") == NR_BATCHES + 2 &&
+		get_uint(sink, "again-count") == 1,
+		"Sink's \"consume\" method call counts are correct");
+	ok(get_uint(sink, "inclusive-time-ns") >=
+			get_uint(src, "inclusive-time-ns") &&
+		get_uint(sink, "self-time-ns") ==
+			get_uint(sink, "inclusive-time-ns") -
+			get_uint(src, "inclusive-time-ns"),
+		"Sink's times include the source's time");
+	bt_value_put_ref(profile);
+	bt_graph_put_ref(graph);
+
+	graph = create_graph(false);
+	ok(!bt_graph_profiling_is_enabled(graph),
+		"Graph's profiling is disabled by default");
+	run_graph(graph);
+	bt_graph_put_ref(graph);
+}
+
+int main(void)
+{
+	plan_tests(NR_TESTS);
+	test_profile();
+	return exit_status();
+}
@@ -0,0 +1,213 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Copyright (C) 2024 EfficiOS, Inc.
+ */
+
+#include <babeltrace2/babeltrace.h>
+#include "common/assert.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <glib.h>
+
+#include "tap/tap.h"
+
+#define NR_TESTS 7
+
+/* Short waiting duration (µs) */
+#define SHORT_WAIT_US	50000
+
+/* Long waiting duration (µs), never expected to elapse */
+#define LONG_WAIT_US	(20 * G_USEC_PER_SEC)
+
+#ifndef __MINGW32__
+
+#include <unistd.h>
+
+/* Pipe of which the source message iterator uses the read end */
+static int test_pipe[2] = { -1, -1 };
+
+static
+bt_component_class_initialize_method_status src_init(
+		bt_self_component_source *self_comp,
+		bt_self_component_source_configuration *config __attribute__((unused)),
+		const bt_value *params __attribute__((unused)),
+		void *init_method_data __attribute__((unused)))
+{
+	bt_self_component_add_port_status status;
+
+	status = bt_self_component_source_add_output_port(self_comp,
+		"out", NULL, NULL);
+	BT_ASSERT(status == BT_SELF_COMPONENT_ADD_PORT_STATUS_OK);
+	return BT_COMPONENT_CLASS_INITIALIZE_METHOD_STATUS_OK;
+}
+
+static
+bt_message_iterator_class_initialize_method_status src_iter_init(
+		bt_self_message_iterator *self_msg_iter,
+		bt_self_message_iterator_configuration *config __attribute__((unused)),
+		bt_self_component_port_output *port __attribute__((unused)))
+{
+	bt_self_message_iterator_set_readiness_fd(self_msg_iter, test_pipe[0]);
+	return BT_MESSAGE_ITERATOR_CLASS_INITIALIZE_METHOD_STATUS_OK;
+}
+
+static
+bt_message_iterator_class_next_method_status src_iter_next(
+		bt_self_message_iterator *self_msg_iter __attribute__((unused)),
+		bt_message_array_const msgs __attribute__((unused)),
+		uint64_t capacity __attribute__((unused)),
+		uint64_t *count __attribute__((unused)))
+{
+	/* Never ready: the test only checks how the graph waits */
+	return BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_AGAIN;
+}
+
+static
+bt_graph_simple_sink_component_consume_func_status sink_consume(
+		bt_message_iterator *msg_iter, void *data __attribute__((unused)))
+{
+	bt_message_array_const msgs;
+	uint64_t count;
+	bt_message_iterator_next_status next_status;
+
+	next_status = bt_message_iterator_next(msg_iter, &msgs, &count);
+	BT_ASSERT(next_status == BT_MESSAGE_ITERATOR_NEXT_STATUS_AGAIN);
+	return BT_GRAPH_SIMPLE_SINK_COMPONENT_CONSUME_FUNC_STATUS_AGAIN;
+}
+
+static
+bt_graph *create_graph(void)
+{
+	bt_message_iterator_class *msg_iter_cls;
+	bt_component_class_source *src_comp_cls;
+	bt_graph *graph;
+	const bt_component_source *src_comp = NULL;
+	const bt_component_sink *sink_comp = NULL;
+	bt_graph_add_component_status add_comp_status;
+	bt_graph_connect_ports_status connect_status;
+	bt_component_class_set_method_status set_method_status;
+	bt_message_iterator_class_set_method_status set_iter_method_status;
+
+	msg_iter_cls = bt_message_iterator_class_create(src_iter_next);
+	BT_ASSERT(msg_iter_cls);
+	set_iter_method_status =
+		bt_message_iterator_class_set_initialize_method(msg_iter_cls,
+			src_iter_init);
+	BT_ASSERT(set_iter_method_status ==
+		BT_MESSAGE_ITERATOR_CLASS_SET_METHOD_STATUS_OK);
+
+	src_comp_cls = bt_component_class_source_create("src", msg_iter_cls);
+	BT_ASSERT(src_comp_cls);
+	set_method_status = bt_component_class_source_set_initialize_method(
+		src_comp_cls, src_init);
+	BT_ASSERT(set_method_status == BT_COMPONENT_CLASS_SET_METHOD_STATUS_OK);
+
+	graph = bt_graph_create(0);
+	BT_ASSERT(graph);
+	add_comp_status = bt_graph_add_source_component(graph, src_comp_cls,
+		"src", NULL, BT_LOGGING_LEVEL_NONE, &src_comp);
+	BT_ASSERT(add_comp_status == BT_GRAPH_ADD_COMPONENT_STATUS_OK);
+	add_comp_status = bt_graph_add_simple_sink_component(graph, "sink",
+		NULL, sink_consume, NULL, NULL, &sink_comp);
+	BT_ASSERT(add_comp_status == BT_GRAPH_ADD_COMPONENT_STATUS_OK);
+	connect_status = bt_graph_connect_ports(graph,
+		bt_component_source_borrow_output_port_by_index_const(
+			src_comp, 0),
+		bt_component_sink_borrow_input_port_by_index_const(
+			sink_comp, 0),
+		NULL);
+	BT_ASSERT(connect_status == BT_GRAPH_CONNECT_PORTS_STATUS_OK);
+	bt_component_class_source_put_ref(src_comp_cls);
+	bt_message_iterator_class_put_ref(msg_iter_cls);
+	return graph;
+}
+
+/*
+ * Waits for the readiness of `graph` for at most `max_duration_us` and
+ * returns the elapsed time (µs).
+ */
+static
+gint64 timed_wait(bt_graph *graph, uint64_t max_duration_us)
+{
+	gint64 begin = g_get_monotonic_time();
+	bt_graph_wait_for_readiness_status wait_status;
+
+	wait_status = bt_graph_wait_for_readiness(graph, max_duration_us);
+	BT_ASSERT(wait_status == BT_GRAPH_WAIT_FOR_READINESS_STATUS_OK);
+	return g_get_monotonic_time() - begin;
+}
+
+static
+void test_readiness(void)
+{
+	bt_graph *graph;
+	bt_graph_run_once_status run_once_status;
+	gint64 elapsed;
+	int ret;
+	const char byte = 'x';
+
+	ret = pipe(test_pipe);
+	BT_ASSERT(ret == 0);
+	graph = create_graph();
+
+	run_once_status = bt_graph_run_once(graph);
+	ok(run_once_status == BT_GRAPH_RUN_ONCE_STATUS_AGAIN,
+		"Graph \"run once\" returns \"try again\"");
+
+	/* Readiness file descriptor is not readable yet */
+	elapsed = timed_wait(graph, SHORT_WAIT_US);
+	ok(elapsed >= SHORT_WAIT_US - 1000,
+		"Waiting lasts for the maximum duration when no file descriptor is readable (%" G_GINT64_FORMAT " µs)",
+		elapsed);
+
+	/* Make the readiness file descriptor readable */
+	run_once_status = bt_graph_run_once(graph);
+	ok(run_once_status == BT_GRAPH_RUN_ONCE_STATUS_AGAIN,
+		"Graph \"run once\" returns \"try again\" again");
+	ret = write(test_pipe[1], &byte, 1);
+	BT_ASSERT(ret == 1);
+	elapsed = timed_wait(graph, LONG_WAIT_US);
+	ok(elapsed < LONG_WAIT_US / 2,
+		"Waiting returns early when a readiness file descriptor is readable (%" G_GINT64_FORMAT " µs)",
+		elapsed);
+
+	/*
+	 * The previous wait forgot the readiness file descriptor: even
+	 * if it's still readable, waiting lasts for the maximum duration.
+	 */
+	elapsed = timed_wait(graph, SHORT_WAIT_US);
+	ok(elapsed >= SHORT_WAIT_US - 1000,
+		"Waiting forgets the recorded readiness file descriptors (%" G_GINT64_FORMAT " µs)",
+		elapsed);
+
+	/* Still readable: recorded again on "try again" */
+	run_once_status = bt_graph_run_once(graph);
+	ok(run_once_status == BT_GRAPH_RUN_ONCE_STATUS_AGAIN,
+		"Graph \"run once\" returns \"try again\" once more");
+	elapsed = timed_wait(graph, LONG_WAIT_US);
+	ok(elapsed < LONG_WAIT_US / 2,
+		"Readiness file descriptor is recorded again on \"try again\" (%" G_GINT64_FORMAT " µs)",
+		elapsed);
+
+	bt_graph_put_ref(graph);
+	close(test_pipe[0]);
+	close(test_pipe[1]);
+}
+
+int main(void)
+{
+	plan_tests(NR_TESTS);
+	test_readiness();
+	return exit_status();
+}
+
+#else /* __MINGW32__ */
+
+int main(void)
+{
+	plan_skip_all("Pipes are not supported on this platform");
+	return exit_status();
+}
+
+#endif /* __MINGW32__ */
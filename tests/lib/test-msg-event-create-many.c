@@ -0,0 +1,388 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Copyright (C) 2024 EfficiOS, Inc.
+ */
+
+#include <babeltrace2/babeltrace.h>
+#include "common/assert.h"
+#include "common/common.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <glib.h>
+
+#include "tap/tap.h"
+
+#define NR_TESTS 6
+
+/* Number of event messages per packet */
+#define NR_EVENTS	6
+
+/* Number of event classes of each stream class */
+#define NR_EVENT_CLASSES	2
+
+/* First default clock snapshot value */
+#define FIRST_CS_VALUE	1000
+
+/*
+ * Trace IR objects of a stream: the stream class of the stream with the
+ * clock has a default clock class while the other one doesn't.
+ */
+struct test_stream {
+	bt_stream_class *sc;
+	bt_event_class *ecs[NR_EVENT_CLASSES];
+	bt_stream *stream;
+	bool with_cs;
+};
+
+struct test_data {
+	bt_clock_class *cc;
+	bt_trace_class *tc;
+	bt_trace *trace;
+	struct test_stream streams[2];
+};
+
+struct src_iter_data {
+	/* Index of the next stream to emit */
+	unsigned int stream_index;
+};
+
+/* Results which the sink collects */
+struct sink_data {
+	uint64_t event_count[2];
+	bool event_classes_ok;
+	bool clock_snapshots_ok;
+	bool packets_ok;
+};
+
+static struct test_data test_data;
+static struct sink_data sink_data;
+
+static
+void create_test_stream(struct test_stream *test_stream, bool with_cs)
+{
+	bt_stream_class_set_default_clock_class_status set_cc_status;
+	unsigned int i;
+
+	test_stream->sc = bt_stream_class_create(test_data.tc);
+	BT_ASSERT(test_stream->sc);
+
+	if (with_cs) {
+		set_cc_status = bt_stream_class_set_default_clock_class(
+			test_stream->sc, test_data.cc);
+		BT_ASSERT(set_cc_status ==
+			BT_STREAM_CLASS_SET_DEFAULT_CLOCK_CLASS_STATUS_OK);
+	}
+
+	bt_stream_class_set_supports_packets(test_stream->sc, BT_TRUE,
+		with_cs, with_cs);
+
+	for (i = 0; i < NR_EVENT_CLASSES; i++) {
+		test_stream->ecs[i] = bt_event_class_create(test_stream->sc);
+		BT_ASSERT(test_stream->ecs[i]);
+	}
+
+	test_stream->stream = bt_stream_create(test_stream->sc,
+		test_data.trace);
+	BT_ASSERT(test_stream->stream);
+	test_stream->with_cs = with_cs;
+}
+
+static
+bt_component_class_initialize_method_status src_init(
+		bt_self_component_source *self_comp,
+		bt_self_component_source_configuration *config __attribute__((unused)),
+		const bt_value *params __attribute__((unused)),
+		void *init_method_data __attribute__((unused)))
+{
+	bt_self_component *self_comp_base =
+		bt_self_component_source_as_self_component(self_comp);
+	bt_self_component_add_port_status status;
+
+	status = bt_self_component_source_add_output_port(self_comp,
+		"out", NULL, NULL);
+	BT_ASSERT(status == BT_SELF_COMPONENT_ADD_PORT_STATUS_OK);
+	test_data.cc = bt_clock_class_create(self_comp_base);
+	BT_ASSERT(test_data.cc);
+	test_data.tc = bt_trace_class_create(self_comp_base);
+	BT_ASSERT(test_data.tc);
+	test_data.trace = bt_trace_create(test_data.tc);
+	BT_ASSERT(test_data.trace);
+	create_test_stream(&test_data.streams[0], true);
+	create_test_stream(&test_data.streams[1], false);
+	return BT_COMPONENT_CLASS_INITIALIZE_METHOD_STATUS_OK;
+}
+
+static
+void src_finalize(
+		bt_self_component_source *self_comp __attribute__((unused)))
+{
+	unsigned int i, j;
+
+	for (i = 0; i < 2; i++) {
+		struct test_stream *test_stream = &test_data.streams[i];
+
+		BT_STREAM_PUT_REF_AND_RESET(test_stream->stream);
+
+		for (j = 0; j < NR_EVENT_CLASSES; j++) {
+			BT_EVENT_CLASS_PUT_REF_AND_RESET(test_stream->ecs[j]);
+		}
+
+		BT_STREAM_CLASS_PUT_REF_AND_RESET(test_stream->sc);
+	}
+
+	BT_TRACE_PUT_REF_AND_RESET(test_data.trace);
+	BT_TRACE_CLASS_PUT_REF_AND_RESET(test_data.tc);
+	BT_CLOCK_CLASS_PUT_REF_AND_RESET(test_data.cc);
+}
+
+static
+bt_message_iterator_class_initialize_method_status src_iter_init(
+		bt_self_message_iterator *self_msg_iter,
+		bt_self_message_iterator_configuration *config __attribute__((unused)),
+		bt_self_component_port_output *port __attribute__((unused)))
+{
+	struct src_iter_data *data = g_new0(struct src_iter_data, 1);
+
+	BT_ASSERT(data);
+	bt_self_message_iterator_set_data(self_msg_iter, data);
+	return BT_MESSAGE_ITERATOR_CLASS_INITIALIZE_METHOD_STATUS_OK;
+}
+
+static
+void src_iter_finalize(bt_self_message_iterator *self_msg_iter)
+{
+	g_free(bt_self_message_iterator_get_data(self_msg_iter));
+}
+
+/*
+ * Emits, for a whole stream, at once: stream beginning, packet
+ * beginning, `NR_EVENTS` event messages created with a single call,
+ * packet end, and stream end messages.
+ */
+static
+bt_message_iterator_class_next_method_status src_iter_next(
+		bt_self_message_iterator *self_msg_iter,
+		bt_message_array_const msgs, uint64_t capacity,
+		uint64_t *count)
+{
+	struct src_iter_data *data =
+		bt_self_message_iterator_get_data(self_msg_iter);
+	struct test_stream *test_stream;
+	const bt_event_class *ecs[NR_EVENTS];
+	uint64_t cs_values[NR_EVENTS];
+	bt_message_event_create_many_status status;
+	bt_packet *packet;
+	uint64_t i = 0;
+	uint64_t j;
+
+	if (data->stream_index == 2) {
+		return BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_END;
+	}
+
+	BT_ASSERT(capacity >= NR_EVENTS + 4);
+	test_stream = &test_data.streams[data->stream_index];
+	packet = bt_packet_create(test_stream->stream);
+	BT_ASSERT(packet);
+	msgs[i] = bt_message_stream_beginning_create(self_msg_iter,
+		test_stream->stream);
+	BT_ASSERT(msgs[i]);
+	i++;
+
+	if (test_stream->with_cs) {
+		msgs[i] = bt_message_packet_beginning_create_with_default_clock_snapshot(
+			self_msg_iter, packet, FIRST_CS_VALUE);
+	} else {
+		msgs[i] = bt_message_packet_beginning_create(self_msg_iter,
+			packet);
+	}
+
+	BT_ASSERT(msgs[i]);
+	i++;
+
+	for (j = 0; j < NR_EVENTS; j++) {
+		ecs[j] = test_stream->ecs[j % NR_EVENT_CLASSES];
+		cs_values[j] = FIRST_CS_VALUE + j;
+	}
+
+	if (test_stream->with_cs) {
+		status = bt_message_event_create_many_with_packet_and_default_clock_snapshot(
+			self_msg_iter, ecs, packet, cs_values, NR_EVENTS,
+			&msgs[i]);
+	} else {
+		status = bt_message_event_create_many_with_packet(
+			self_msg_iter, ecs, packet, NR_EVENTS, &msgs[i]);
+	}
+
+	BT_ASSERT(status == BT_MESSAGE_EVENT_CREATE_MANY_STATUS_OK);
+	i += NR_EVENTS;
+
+	if (test_stream->with_cs) {
+		msgs[i] = bt_message_packet_end_create_with_default_clock_snapshot(
+			self_msg_iter, packet, FIRST_CS_VALUE + NR_EVENTS);
+	} else {
+		msgs[i] = bt_message_packet_end_create(self_msg_iter, packet);
+	}
+
+	BT_ASSERT(msgs[i]);
+	i++;
+	msgs[i] = bt_message_stream_end_create(self_msg_iter,
+		test_stream->stream);
+	BT_ASSERT(msgs[i]);
+	i++;
+	bt_packet_put_ref(packet);
+	*count = i;
+	data->stream_index++;
+	return BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_OK;
+}
+
+static
+void check_event_msg(const bt_message *msg)
+{
+	const bt_event *event = bt_message_event_borrow_event_const(msg);
+	const bt_stream *stream = bt_event_borrow_stream_const(event);
+	unsigned int stream_index = stream == test_data.streams[0].stream ?
+		0 : 1;
+	struct test_stream *test_stream = &test_data.streams[stream_index];
+	uint64_t index = sink_data.event_count[stream_index];
+
+	if (bt_event_borrow_class_const(event) !=
+			test_stream->ecs[index % NR_EVENT_CLASSES]) {
+		sink_data.event_classes_ok = false;
+	}
+
+	if (!bt_event_borrow_packet_const(event) ||
+			bt_packet_borrow_stream_const(
+				bt_event_borrow_packet_const(event)) != stream) {
+		sink_data.packets_ok = false;
+	}
+
+	if (test_stream->with_cs) {
+		if (bt_clock_snapshot_get_value(
+				bt_message_event_borrow_default_clock_snapshot_const(msg)) !=
+				FIRST_CS_VALUE + index) {
+			sink_data.clock_snapshots_ok = false;
+		}
+	}
+
+	sink_data.event_count[stream_index]++;
+}
+
+static
+bt_graph_simple_sink_component_consume_func_status sink_consume(
+		bt_message_iterator *msg_iter, void *data __attribute__((unused)))
+{
+	bt_message_array_const msgs;
+	uint64_t count;
+	uint64_t i;
+
+	switch (bt_message_iterator_next(msg_iter, &msgs, &count)) {
+	case BT_MESSAGE_ITERATOR_NEXT_STATUS_OK:
+		for (i = 0; i < count; i++) {
+			if (bt_message_get_type(msgs[i]) ==
+					BT_MESSAGE_TYPE_EVENT) {
+				check_event_msg(msgs[i]);
+			}
+
+			bt_message_put_ref(msgs[i]);
+		}
+
+		return BT_GRAPH_SIMPLE_SINK_COMPONENT_CONSUME_FUNC_STATUS_OK;
+	case BT_MESSAGE_ITERATOR_NEXT_STATUS_AGAIN:
+		return BT_GRAPH_SIMPLE_SINK_COMPONENT_CONSUME_FUNC_STATUS_AGAIN;
+	case BT_MESSAGE_ITERATOR_NEXT_STATUS_END:
+		return BT_GRAPH_SIMPLE_SINK_COMPONENT_CONSUME_FUNC_STATUS_END;
+	default:
+		bt_common_abort();
+	}
+}
+
+static
+bt_graph *create_graph(void)
+{
+	bt_message_iterator_class *msg_iter_cls;
+	bt_component_class_source *src_comp_cls;
+	bt_graph *graph;
+	const bt_component_source *src_comp = NULL;
+	const bt_component_sink *sink_comp = NULL;
+	bt_graph_add_component_status add_comp_status;
+	bt_graph_connect_ports_status connect_status;
+	bt_component_class_set_method_status set_method_status;
+	bt_message_iterator_class_set_method_status set_iter_method_status;
+
+	msg_iter_cls = bt_message_iterator_class_create(src_iter_next);
+	BT_ASSERT(msg_iter_cls);
+	set_iter_method_status =
+		bt_message_iterator_class_set_initialize_method(msg_iter_cls,
+			src_iter_init);
+	BT_ASSERT(set_iter_method_status ==
+		BT_MESSAGE_ITERATOR_CLASS_SET_METHOD_STATUS_OK);
+	set_iter_method_status =
+		bt_message_iterator_class_set_finalize_method(msg_iter_cls,
+			src_iter_finalize);
+	BT_ASSERT(set_iter_method_status ==
+		BT_MESSAGE_ITERATOR_CLASS_SET_METHOD_STATUS_OK);
+
+	src_comp_cls = bt_component_class_source_create("src", msg_iter_cls);
+	BT_ASSERT(src_comp_cls);
+	set_method_status = bt_component_class_source_set_initialize_method(
+		src_comp_cls, src_init);
+	BT_ASSERT(set_method_status == BT_COMPONENT_CLASS_SET_METHOD_STATUS_OK);
+	set_method_status = bt_component_class_source_set_finalize_method(
+		src_comp_cls, src_finalize);
+	BT_ASSERT(set_method_status == BT_COMPONENT_CLASS_SET_METHOD_STATUS_OK);
+
+	graph = bt_graph_create(0);
+	BT_ASSERT(graph);
+	add_comp_status = bt_graph_add_source_component(graph, src_comp_cls,
+		"src", NULL, BT_LOGGING_LEVEL_NONE, &src_comp);
+	BT_ASSERT(add_comp_status == BT_GRAPH_ADD_COMPONENT_STATUS_OK);
+	add_comp_status = bt_graph_add_simple_sink_component(graph, "sink",
+		NULL, sink_consume, NULL, NULL, &sink_comp);
+	BT_ASSERT(add_comp_status == BT_GRAPH_ADD_COMPONENT_STATUS_OK);
+	connect_status = bt_graph_connect_ports(graph,
+		bt_component_source_borrow_output_port_by_index_const(
+			src_comp, 0),
+		bt_component_sink_borrow_input_port_by_index_const(
+			sink_comp, 0),
+		NULL);
+	BT_ASSERT(connect_status == BT_GRAPH_CONNECT_PORTS_STATUS_OK);
+	bt_component_class_source_put_ref(src_comp_cls);
+	bt_message_iterator_class_put_ref(msg_iter_cls);
+	return graph;
+}
+
+static
+void test_create_many(void)
+{
+	bt_graph *graph;
+	bt_graph_run_status run_status;
+
+	sink_data.event_classes_ok = true;
+	sink_data.clock_snapshots_ok = true;
+	sink_data.packets_ok = true;
+	graph = create_graph();
+
+	do {
+		run_status = bt_graph_run(graph);
+	} while (run_status == BT_GRAPH_RUN_STATUS_AGAIN);
+
+	ok(run_status == BT_GRAPH_RUN_STATUS_OK, "Graph runs successfully");
+	ok(sink_data.event_count[0] == NR_EVENTS,
+		"Sink receives all the event messages with a default clock snapshot");
+	ok(sink_data.event_count[1] == NR_EVENTS,
+		"Sink receives all the event messages without a default clock snapshot");
+	ok(sink_data.event_classes_ok,
+		"Event messages have the expected event classes, in order");
+	ok(sink_data.clock_snapshots_ok,
+		"Event messages have the expected default clock snapshot values");
+	ok(sink_data.packets_ok, "Events belong to the expected packets");
+	bt_graph_put_ref(graph);
+}
+
+int main(void)
+{
+	plan_tests(NR_TESTS);
+	test_create_many();
+	return exit_status();
+}
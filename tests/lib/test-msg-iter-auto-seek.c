@@ -0,0 +1,352 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Copyright (C) 2024 EfficiOS, Inc.
+ */
+
+#include <babeltrace2/babeltrace.h>
+#include "common/assert.h"
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <glib.h>
+
+#include "tap/tap.h"
+
+#define NR_TESTS 8
+
+/* Number of event messages */
+#define NR_EVENTS	4
+
+/* Default clock snapshot value of the event message at index `_i` */
+#define EVENT_CS_VALUE(_i)	(10 * ((uint64_t) (_i) + 1))
+
+/* Time to seek (ns from origin, between two event messages) */
+#define SEEK_NS_FROM_ORIGIN	25
+
+struct test_data {
+	bt_clock_class *cc;
+	bt_trace_class *tc;
+	bt_stream_class *sc;
+	bt_event_class *ec;
+	bt_trace *trace;
+	bt_stream *stream;
+};
+
+struct src_iter_data {
+	/* Index of the next message to emit */
+	unsigned int msg_index;
+};
+
+/* What the source message iterator observes */
+struct src_observations {
+	/* Number of "next" method calls while not automatically seeking */
+	uint64_t next_count;
+
+	/* Number of "next" method calls while automatically seeking */
+	uint64_t auto_seek_next_count;
+
+	/* Last time to seek which the "next" method observed */
+	int64_t auto_seek_ns_from_origin;
+};
+
+static struct test_data test_data;
+static struct src_observations src_observations;
+
+static
+bt_component_class_initialize_method_status src_init(
+		bt_self_component_source *self_comp,
+		bt_self_component_source_configuration *config __attribute__((unused)),
+		const bt_value *params __attribute__((unused)),
+		void *init_method_data __attribute__((unused)))
+{
+	bt_self_component *self_comp_base =
+		bt_self_component_source_as_self_component(self_comp);
+	bt_self_component_add_port_status status;
+	bt_stream_class_set_default_clock_class_status set_cc_status;
+
+	status = bt_self_component_source_add_output_port(self_comp,
+		"out", NULL, NULL);
+	BT_ASSERT(status == BT_SELF_COMPONENT_ADD_PORT_STATUS_OK);
+	test_data.cc = bt_clock_class_create(self_comp_base);
+	BT_ASSERT(test_data.cc);
+	test_data.tc = bt_trace_class_create(self_comp_base);
+	BT_ASSERT(test_data.tc);
+	test_data.sc = bt_stream_class_create(test_data.tc);
+	BT_ASSERT(test_data.sc);
+	set_cc_status = bt_stream_class_set_default_clock_class(test_data.sc,
+		test_data.cc);
+	BT_ASSERT(set_cc_status ==
+		BT_STREAM_CLASS_SET_DEFAULT_CLOCK_CLASS_STATUS_OK);
+	test_data.ec = bt_event_class_create(test_data.sc);
+	BT_ASSERT(test_data.ec);
+	test_data.trace = bt_trace_create(test_data.tc);
+	BT_ASSERT(test_data.trace);
+	test_data.stream = bt_stream_create(test_data.sc, test_data.trace);
+	BT_ASSERT(test_data.stream);
+	return BT_COMPONENT_CLASS_INITIALIZE_METHOD_STATUS_OK;
+}
+
+static
+void src_finalize(
+		bt_self_component_source *self_comp __attribute__((unused)))
+{
+	BT_STREAM_PUT_REF_AND_RESET(test_data.stream);
+	BT_TRACE_PUT_REF_AND_RESET(test_data.trace);
+	BT_EVENT_CLASS_PUT_REF_AND_RESET(test_data.ec);
+	BT_STREAM_CLASS_PUT_REF_AND_RESET(test_data.sc);
+	BT_TRACE_CLASS_PUT_REF_AND_RESET(test_data.tc);
+	BT_CLOCK_CLASS_PUT_REF_AND_RESET(test_data.cc);
+}
+
+static
+bt_message_iterator_class_initialize_method_status src_iter_init(
+		bt_self_message_iterator *self_msg_iter,
+		bt_self_message_iterator_configuration *config,
+		bt_self_component_port_output *port __attribute__((unused)))
+{
+	struct src_iter_data *data = g_new0(struct src_iter_data, 1);
+
+	BT_ASSERT(data);
+	bt_self_message_iterator_set_data(self_msg_iter, data);
+
+	/* Let the library automatically seek a time */
+	bt_self_message_iterator_configuration_set_can_seek_forward(config,
+		BT_TRUE);
+	return BT_MESSAGE_ITERATOR_CLASS_INITIALIZE_METHOD_STATUS_OK;
+}
+
+static
+void src_iter_finalize(bt_self_message_iterator *self_msg_iter)
+{
+	g_free(bt_self_message_iterator_get_data(self_msg_iter));
+}
+
+/*
+ * Emits, one at a time: stream beginning, `NR_EVENTS` event messages,
+ * and stream end messages.
+ */
+static
+bt_message_iterator_class_next_method_status src_iter_next(
+		bt_self_message_iterator *self_msg_iter,
+		bt_message_array_const msgs,
+		uint64_t capacity __attribute__((unused)),
+		uint64_t *count)
+{
+	struct src_iter_data *data =
+		bt_self_message_iterator_get_data(self_msg_iter);
+	int64_t ns_from_origin;
+
+	if (bt_self_message_iterator_is_auto_seeking(self_msg_iter,
+			&ns_from_origin)) {
+		src_observations.auto_seek_next_count++;
+		src_observations.auto_seek_ns_from_origin = ns_from_origin;
+	} else {
+		src_observations.next_count++;
+	}
+
+	if (data->msg_index == 0) {
+		msgs[0] = bt_message_stream_beginning_create(self_msg_iter,
+			test_data.stream);
+		BT_ASSERT(msgs[0]);
+		bt_message_stream_beginning_set_default_clock_snapshot(
+			(bt_message *) msgs[0], 0);
+	} else if (data->msg_index <= NR_EVENTS) {
+		msgs[0] = bt_message_event_create_with_default_clock_snapshot(
+			self_msg_iter, test_data.ec, test_data.stream,
+			EVENT_CS_VALUE(data->msg_index - 1));
+	} else if (data->msg_index == NR_EVENTS + 1) {
+		msgs[0] = bt_message_stream_end_create(self_msg_iter,
+			test_data.stream);
+		BT_ASSERT(msgs[0]);
+		bt_message_stream_end_set_default_clock_snapshot(
+			(bt_message *) msgs[0], EVENT_CS_VALUE(NR_EVENTS));
+	} else {
+		return BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_END;
+	}
+
+	BT_ASSERT(msgs[0]);
+	data->msg_index++;
+	*count = 1;
+	return BT_MESSAGE_ITERATOR_CLASS_NEXT_METHOD_STATUS_OK;
+}
+
+static
+bt_message_iterator_class_seek_beginning_method_status src_iter_seek_beginning(
+		bt_self_message_iterator *self_msg_iter)
+{
+	struct src_iter_data *data =
+		bt_self_message_iterator_get_data(self_msg_iter);
+
+	data->msg_index = 0;
+	return BT_MESSAGE_ITERATOR_CLASS_SEEK_BEGINNING_METHOD_STATUS_OK;
+}
+
+static
+bt_message_iterator_class_can_seek_beginning_method_status src_iter_can_seek_beginning(
+		bt_self_message_iterator *self_msg_iter __attribute__((unused)),
+		bt_bool *can_seek)
+{
+	*can_seek = BT_TRUE;
+	return BT_MESSAGE_ITERATOR_CLASS_CAN_SEEK_BEGINNING_METHOD_STATUS_OK;
+}
+
+/*
+ * Reads the first message, makes the upstream message iterator seek
+ * `SEEK_NS_FROM_ORIGIN`, and then reads all the remaining messages.
+ */
+static
+bt_graph_simple_sink_component_consume_func_status sink_consume(
+		bt_message_iterator *msg_iter, void *data __attribute__((unused)))
+{
+	bt_message_array_const msgs;
+	uint64_t count;
+	uint64_t i;
+	bt_message_iterator_next_status next_status;
+	bt_message_iterator_can_seek_ns_from_origin_status can_seek_status;
+	bt_message_iterator_seek_ns_from_origin_status seek_status;
+	bt_bool can_seek;
+	int64_t first_event_ns_from_origin = -1;
+	uint64_t next_count_after_seek;
+
+	next_status = bt_message_iterator_next(msg_iter, &msgs, &count);
+	BT_ASSERT(next_status == BT_MESSAGE_ITERATOR_NEXT_STATUS_OK);
+
+	for (i = 0; i < count; i++) {
+		bt_message_put_ref(msgs[i]);
+	}
+
+	ok(src_observations.next_count > 0 &&
+		src_observations.auto_seek_next_count == 0,
+		"Message iterator is not automatically seeking during a regular \"next\" call");
+
+	can_seek_status = bt_message_iterator_can_seek_ns_from_origin(msg_iter,
+		SEEK_NS_FROM_ORIGIN, &can_seek);
+	BT_ASSERT(can_seek_status ==
+		BT_MESSAGE_ITERATOR_CAN_SEEK_NS_FROM_ORIGIN_STATUS_OK);
+	ok(can_seek, "Message iterator can seek a time automatically");
+	seek_status = bt_message_iterator_seek_ns_from_origin(msg_iter,
+		SEEK_NS_FROM_ORIGIN);
+	ok(seek_status == BT_MESSAGE_ITERATOR_SEEK_NS_FROM_ORIGIN_STATUS_OK,
+		"Message iterator seeks a time automatically");
+	ok(src_observations.auto_seek_next_count > 0,
+		"Message iterator is automatically seeking during the \"next\" calls of the seeking operation");
+	ok(src_observations.auto_seek_ns_from_origin == SEEK_NS_FROM_ORIGIN,
+		"Message iterator knows the time to seek (%" PRId64 " ns)",
+		src_observations.auto_seek_ns_from_origin);
+
+	next_count_after_seek = src_observations.auto_seek_next_count;
+
+	while (true) {
+		next_status = bt_message_iterator_next(msg_iter, &msgs,
+			&count);
+		if (next_status == BT_MESSAGE_ITERATOR_NEXT_STATUS_END) {
+			break;
+		}
+
+		BT_ASSERT(next_status == BT_MESSAGE_ITERATOR_NEXT_STATUS_OK);
+
+		for (i = 0; i < count; i++) {
+			if (bt_message_get_type(msgs[i]) == BT_MESSAGE_TYPE_EVENT &&
+					first_event_ns_from_origin < 0) {
+				bt_clock_snapshot_get_ns_from_origin_status cs_status;
+
+				cs_status = bt_clock_snapshot_get_ns_from_origin(
+					bt_message_event_borrow_default_clock_snapshot_const(
+						msgs[i]),
+					&first_event_ns_from_origin);
+				BT_ASSERT(cs_status ==
+					BT_CLOCK_SNAPSHOT_GET_NS_FROM_ORIGIN_STATUS_OK);
+			}
+
+			bt_message_put_ref(msgs[i]);
+		}
+	}
+
+	ok(src_observations.auto_seek_next_count == next_count_after_seek,
+		"Message iterator is not automatically seeking after the seeking operation");
+	ok(first_event_ns_from_origin == (int64_t) EVENT_CS_VALUE(2),
+		"First event message after seeking is the expected one (%" PRId64 " ns)",
+		first_event_ns_from_origin);
+	return BT_GRAPH_SIMPLE_SINK_COMPONENT_CONSUME_FUNC_STATUS_END;
+}
+
+static
+bt_graph *create_graph(void)
+{
+	bt_message_iterator_class *msg_iter_cls;
+	bt_component_class_source *src_comp_cls;
+	bt_graph *graph;
+	const bt_component_source *src_comp = NULL;
+	const bt_component_sink *sink_comp = NULL;
+	bt_graph_add_component_status add_comp_status;
+	bt_graph_connect_ports_status connect_status;
+	bt_component_class_set_method_status set_method_status;
+	bt_message_iterator_class_set_method_status set_iter_method_status;
+
+	msg_iter_cls = bt_message_iterator_class_create(src_iter_next);
+	BT_ASSERT(msg_iter_cls);
+	set_iter_method_status =
+		bt_message_iterator_class_set_initialize_method(msg_iter_cls,
+			src_iter_init);
+	BT_ASSERT(set_iter_method_status ==
+		BT_MESSAGE_ITERATOR_CLASS_SET_METHOD_STATUS_OK);
+	set_iter_method_status =
+		bt_message_iterator_class_set_finalize_method(msg_iter_cls,
+			src_iter_finalize);
+	BT_ASSERT(set_iter_method_status ==
+		BT_MESSAGE_ITERATOR_CLASS_SET_METHOD_STATUS_OK);
+	set_iter_method_status =
+		bt_message_iterator_class_set_seek_beginning_methods(
+			msg_iter_cls, src_iter_seek_beginning,
+			src_iter_can_seek_beginning);
+	BT_ASSERT(set_iter_method_status ==
+		BT_MESSAGE_ITERATOR_CLASS_SET_METHOD_STATUS_OK);
+
+	src_comp_cls = bt_component_class_source_create("src", msg_iter_cls);
+	BT_ASSERT(src_comp_cls);
+	set_method_status = bt_component_class_source_set_initialize_method(
+		src_comp_cls, src_init);
+	BT_ASSERT(set_method_status == BT_COMPONENT_CLASS_SET_METHOD_STATUS_OK);
+	set_method_status = bt_component_class_source_set_finalize_method(
+		src_comp_cls, src_finalize);
+	BT_ASSERT(set_method_status == BT_COMPONENT_CLASS_SET_METHOD_STATUS_OK);
+
+	graph = bt_graph_create(0);
+	BT_ASSERT(graph);
+	add_comp_status = bt_graph_add_source_component(graph, src_comp_cls,
+		"src", NULL, BT_LOGGING_LEVEL_NONE, &src_comp);
+	BT_ASSERT(add_comp_status == BT_GRAPH_ADD_COMPONENT_STATUS_OK);
+	add_comp_status = bt_graph_add_simple_sink_component(graph, "sink",
+		NULL, sink_consume, NULL, NULL, &sink_comp);
+	BT_ASSERT(add_comp_status == BT_GRAPH_ADD_COMPONENT_STATUS_OK);
+	connect_status = bt_graph_connect_ports(graph,
+		bt_component_source_borrow_output_port_by_index_const(
+			src_comp, 0),
+		bt_component_sink_borrow_input_port_by_index_const(
+			sink_comp, 0),
+		NULL);
+	BT_ASSERT(connect_status == BT_GRAPH_CONNECT_PORTS_STATUS_OK);
+	bt_component_class_source_put_ref(src_comp_cls);
+	bt_message_iterator_class_put_ref(msg_iter_cls);
+	return graph;
+}
+
+static
+void test_auto_seek(void)
+{
+	bt_graph *graph;
+	bt_graph_run_status run_status;
+
+	graph = create_graph();
+	run_status = bt_graph_run(graph);
+	ok(run_status == BT_GRAPH_RUN_STATUS_OK, "Graph runs");
+	bt_graph_put_ref(graph);
+}
+
+int main(void)
+{
+	plan_tests(NR_TESTS);
+	test_auto_seek();
+	return exit_status();
+}
@@ -0,0 +1,118 @@
+#!/bin/bash
+#
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# Copyright (C) 2024 EfficiOS Inc.
+#
+
+# This file tests the ring buffer mode of sink.ctf.fs: the output trace
+# must only contain the last packets of the stream, the first one
+# having the sequence number which follows the dropped packets.
+
+SH_TAP=1
+
+if [ -n "${BT_TESTS_SRCDIR:-}" ]; then
+	UTILSSH="$BT_TESTS_SRCDIR/utils/utils.sh"
+else
+	UTILSSH="$(dirname "$0")/../../utils/utils.sh"
+fi
+
+# shellcheck source=../../utils/utils.sh
+source "$UTILSSH"
+
+# Directory containing the Python test source.
+data_dir="$BT_TESTS_DATADIR/plugins/sink.ctf.fs/ring-buffer"
+
+temp_stdout=$(mktemp)
+temp_expected_stdout=$(mktemp)
+temp_stderr=$(mktemp)
+temp_output_dir=$(mktemp -d)
+
+trace_dir="$temp_output_dir/the-trace"
+
+if [ "$BT_TESTS_ENABLE_PYTHON_PLUGINS" != "1" ]; then
+	plan_skip_all "This test requires the Python plugin provider"
+	exit
+fi
+
+plan_tests 7
+
+# Prints the sequence number of the first packet of the data stream
+# file `$1`.
+#
+# The sink.ctf.fs packet header has a 32-bit magic number, a 16-byte
+# UUID, a 64-bit stream class ID, and a 64-bit stream ID. The packet
+# context then has 64-bit total size, content size, beginning time,
+# and end time fields, followed by the 64-bit sequence number, all in
+# the native byte order.
+first_packet_seq_num() {
+	od -A n -t u8 -j 68 -N 8 "$1" | tr -d ' '
+}
+
+# Runs sink.ctf.fs with the ring buffer parameter `$1`, reads back the
+# output trace, and checks that it contains the expected packets, the
+# first one having the sequence number `$2`.
+test_ring_buffer() {
+	local param="$1"
+	local expected_seq_num="$2"
+
+	bt_cli "$temp_stdout" "$temp_stderr" \
+		"--plugin-path=${data_dir}" \
+		-c src.foo.TheSource \
+		-c sink.ctf.fs -p "path=\"${trace_dir}\"" \
+		-p 'assume-single-trace=true' -p "$param"
+	ok "$?" "run sink.ctf.fs with $param"
+
+	bt_diff_cli "$temp_expected_stdout" /dev/null \
+		"$trace_dir" -c sink.text.details -p compact=yes,with-metadata=no
+	ok "$?" "$param: output trace only contains the last packets"
+
+	is "$(first_packet_seq_num "$trace_dir/the-stream")" "$expected_seq_num" \
+		"$param: sequence number of the first packet follows the dropped packets"
+
+	rm -f "$trace_dir/metadata"
+	rm -f "$trace_dir/the-stream"
+	rmdir "$trace_dir"
+}
+
+# Each packet ends 100 ns after the previous one: keep the last two.
+cat <<- 'END' > "$temp_expected_stdout"
+[Unknown] {0 0 0} Stream beginning
+[200 200] {0 0 0} Packet beginning
+[250 250] {0 0 0} Event `event-2` (2)
+[300 300] {0 0 0} Packet end
+[300 300] {0 0 0} Packet beginning
+[350 350] {0 0 0} Event `event-3` (3)
+[400 400] {0 0 0} Packet end
+[Unknown] {0 0 0} Stream end
+END
+
+test_ring_buffer 'ring-buffer-max-duration=100' 2
+
+# Any packet exceeds one byte: only keep the last one.
+cat <<- 'END' > "$temp_expected_stdout"
+[Unknown] {0 0 0} Stream beginning
+[300 300] {0 0 0} Packet beginning
+[350 350] {0 0 0} Event `event-3` (3)
+[400 400] {0 0 0} Packet end
+[Unknown] {0 0 0} Stream end
+END
+
+test_ring_buffer 'ring-buffer-max-size=1' 3
+
+# Without the ring buffer mode, the first packet has the sequence
+# number 0.
+bt_cli "$temp_stdout" "$temp_stderr" \
+	"--plugin-path=${data_dir}" \
+	-c src.foo.TheSource \
+	-c sink.ctf.fs -p "path=\"${trace_dir}\"" -p 'assume-single-trace=true'
+is "$(first_packet_seq_num "$trace_dir/the-stream")" 0 \
+	"sequence number of the first packet is 0 without the ring buffer mode"
+
+rm -f "$temp_stdout"
+rm -f "$temp_stderr"
+rm -f "$temp_expected_stdout"
+rm -f "$trace_dir/metadata"
+rm -f "$trace_dir/the-stream"
+rmdir "$trace_dir"
+rmdir "$temp_output_dir"
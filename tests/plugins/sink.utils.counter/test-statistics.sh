@@ -0,0 +1,92 @@
+#!/bin/bash
+#
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# Copyright (C) 2024 EfficiOS Inc.
+#
+
+# This file tests the statistics mode of a `sink.utils.counter`
+# component: message counts, event classes, streams, and totals.
+
+SH_TAP=1
+
+if [ -n "${BT_TESTS_SRCDIR:-}" ]; then
+	UTILSSH="$BT_TESTS_SRCDIR/utils/utils.sh"
+else
+	UTILSSH="$(dirname "$0")/../../utils/utils.sh"
+fi
+
+# shellcheck source=../../utils/utils.sh
+source "$UTILSSH"
+
+# Directory containing the Python test source.
+data_dir="$BT_TESTS_DATADIR/plugins/sink.utils.counter"
+
+temp_stdout=$(mktemp)
+temp_masked_stdout=$(mktemp)
+temp_expected_stdout=$(mktemp)
+temp_stderr=$(mktemp)
+
+if [ "$BT_TESTS_ENABLE_PYTHON_PLUGINS" != "1" ]; then
+	plan_skip_all "This test requires the Python plugin provider"
+	exit
+fi
+
+plan_tests 4
+
+bt_cli "$temp_stdout" "$temp_stderr" \
+	"--plugin-path=${data_dir}" \
+	-c src.foo.TheSource \
+	-c sink.utils.counter -p 'statistics=yes'
+ok "$?" "run babeltrace"
+
+# The processing time and the rates which derive from it, at the end
+# of the output, aren't deterministic: only check that they're there.
+grep -q ' s of processing time$' "$temp_stdout"
+ok "$?" "processing time is printed"
+
+sed '/ s of processing time$/,$d' "$temp_stdout" > "$temp_masked_stdout"
+
+cat > "$temp_expected_stdout" <<'END'
+              6 Event messages
+              2 Stream beginning messages
+              2 Stream end messages
+              3 Packet beginning messages
+              3 Packet end messages
+              1 Discarded event message
+              0 Discarded packet messages
+              0 Message iterator inactivity messages
+             17 messages (TOTAL)
+
+Event classes:
+              4  66.67% a (stream class ID 0, ID 0)
+              2  33.33% b (stream class ID 0, ID 1)
+
+Streams:
+  Stream `s1` (trace `the-trace`, stream class ID 0, ID 0):
+              4 events
+              2 packets (events per packet: min 1, avg 2.0, max 3)
+              0 discarded events
+              0 discarded packets
+    0.000003000 s of trace time
+      1333333.3 events/s
+  Stream `s2` (trace `the-trace`, stream class ID 0, ID 1):
+              2 events
+              1 packet (events per packet: min 2, avg 2.0, max 2)
+              2 discarded events
+              0 discarded packets
+    0.000004000 s of trace time
+       500000.0 events/s
+
+Total:
+    0.000004500 s of trace time
+      1333333.3 events/s
+END
+
+bt_diff "$temp_expected_stdout" "$temp_masked_stdout"
+ok "$?" "expected statistics on stdout"
+
+bt_diff "/dev/null" "$temp_stderr"
+ok "$?" "stderr is empty"
+
+rm -f "$temp_stdout" "$temp_masked_stdout" "$temp_expected_stdout" "$temp_stderr"
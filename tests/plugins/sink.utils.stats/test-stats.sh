@@ -0,0 +1,75 @@
+#!/bin/bash
+#
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# Copyright (C) 2024 EfficiOS Inc.
+#
+
+# This file tests the aggregated output of a `sink.utils.stats`
+# component: top event classes, top streams, top key field values, and
+# time buckets.
+
+SH_TAP=1
+
+if [ -n "${BT_TESTS_SRCDIR:-}" ]; then
+	UTILSSH="$BT_TESTS_SRCDIR/utils/utils.sh"
+else
+	UTILSSH="$(dirname "$0")/../../utils/utils.sh"
+fi
+
+# shellcheck source=../../utils/utils.sh
+source "$UTILSSH"
+
+# Directory containing the Python test source.
+data_dir="$BT_TESTS_DATADIR/plugins/sink.utils.stats"
+
+temp_stdout=$(mktemp)
+temp_expected_stdout=$(mktemp)
+temp_stderr=$(mktemp)
+
+if [ "$BT_TESTS_ENABLE_PYTHON_PLUGINS" != "1" ]; then
+	plan_skip_all "This test requires the Python plugin provider"
+	exit
+fi
+
+plan_tests 3
+
+bt_cli "$temp_stdout" "$temp_stderr" \
+	"--plugin-path=${data_dir}" \
+	-c src.foo.TheSource \
+	-c sink.utils.stats -p 'bucket-duration=1000,key-field="payload.cpu"'
+ok "$?" "run babeltrace"
+
+cat > "$temp_expected_stdout" <<'END'
+6 event messages (2 event classes, 2 streams)
+
+Top event classes:
+              3  50.00% a
+              3  50.00% b
+
+Top streams:
+              4  66.67% `s1` (trace ``, ID 0)
+              2  33.33% `s2` (trace ``, ID 1)
+
+Top `payload.cpu` values:
+              4  66.67% 0
+              2  33.33% 1
+
+Event messages per 1000 ns bucket (bucket beginning, ns from origin):
+                     0               3
+              2  66.67% a
+              1  33.33% b
+                  1000               1
+              1 100.00% b
+                  2000               2
+              1  50.00% a
+              1  50.00% b
+END
+
+bt_diff "$temp_expected_stdout" "$temp_stdout"
+ok "$?" "expected statistics on stdout"
+
+bt_diff "/dev/null" "$temp_stderr"
+ok "$?" "stderr is empty"
+
+rm -f "$temp_stdout" "$temp_expected_stdout" "$temp_stderr"
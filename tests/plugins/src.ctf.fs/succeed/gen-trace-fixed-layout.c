@@ -0,0 +1,237 @@
+/*
+ * SPDX-License-Identifier: MIT
+ *
+ * Copyright (C) 2024 EfficiOS Inc.
+ */
+
+/*
+ * Generates a CTF trace with three event record classes:
+ *
+ * `fixed`:
+ *     Payload with byte-aligned, standard-length integer fields only,
+ *     one of them having a byte order which differs from the one of
+ *     the trace: `src.ctf.fs` decodes it at once (fixed layout).
+ *
+ * `packed`:
+ *     Payload with standard-length integer fields which aren't
+ *     byte-aligned by class: `src.ctf.fs` decodes it field by field.
+ *
+ * `var`:
+ *     Payload with an integer field followed by a null-terminated
+ *     string field: `src.ctf.fs` decodes it field by field.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <babeltrace2-ctf-writer/writer.h>
+#include <babeltrace2-ctf-writer/clock.h>
+#include <babeltrace2-ctf-writer/clock-class.h>
+#include <babeltrace2-ctf-writer/stream.h>
+#include <babeltrace2-ctf-writer/event.h>
+#include <babeltrace2-ctf-writer/event-types.h>
+#include <babeltrace2-ctf-writer/event-fields.h>
+#include <babeltrace2-ctf-writer/stream-class.h>
+#include <babeltrace2-ctf-writer/trace.h>
+
+#include "common/assert.h"
+
+struct config {
+	struct bt_ctf_writer *writer;
+	struct bt_ctf_trace *trace;
+	struct bt_ctf_clock *clock;
+	struct bt_ctf_stream_class *sc;
+	struct bt_ctf_stream *stream;
+	struct bt_ctf_event_class *ec_fixed;
+	struct bt_ctf_event_class *ec_packed;
+	struct bt_ctf_event_class *ec_var;
+};
+
+static
+void fini_config(struct config *cfg)
+{
+	bt_ctf_object_put_ref(cfg->stream);
+	bt_ctf_object_put_ref(cfg->sc);
+	bt_ctf_object_put_ref(cfg->ec_fixed);
+	bt_ctf_object_put_ref(cfg->ec_packed);
+	bt_ctf_object_put_ref(cfg->ec_var);
+	bt_ctf_object_put_ref(cfg->clock);
+	bt_ctf_object_put_ref(cfg->trace);
+	bt_ctf_object_put_ref(cfg->writer);
+}
+
+static
+void add_int_field(struct bt_ctf_event_class *ec, const char *name,
+		unsigned int size, bt_ctf_bool is_signed, unsigned int alignment,
+		enum bt_ctf_byte_order byte_order)
+{
+	struct bt_ctf_field_type *ft;
+	int ret;
+
+	ft = bt_ctf_field_type_integer_create(size);
+	BT_ASSERT(ft);
+	ret = bt_ctf_field_type_integer_set_is_signed(ft, is_signed);
+	BT_ASSERT(ret == 0);
+	ret = bt_ctf_field_type_set_alignment(ft, alignment);
+	BT_ASSERT(ret == 0);
+	ret = bt_ctf_field_type_set_byte_order(ft, byte_order);
+	BT_ASSERT(ret == 0);
+	ret = bt_ctf_event_class_add_field(ec, ft, name);
+	BT_ASSERT(ret == 0);
+	bt_ctf_object_put_ref(ft);
+}
+
+static
+void configure_writer(struct config *cfg, const char *path)
+{
+	struct bt_ctf_field_type *ft;
+	int ret;
+
+	cfg->writer = bt_ctf_writer_create(path);
+	BT_ASSERT(cfg->writer);
+	cfg->trace = bt_ctf_writer_get_trace(cfg->writer);
+	BT_ASSERT(cfg->trace);
+	cfg->clock = bt_ctf_clock_create("default");
+	BT_ASSERT(cfg->clock);
+	ret = bt_ctf_writer_add_clock(cfg->writer, cfg->clock);
+	BT_ASSERT(ret == 0);
+	ret = bt_ctf_writer_set_byte_order(cfg->writer,
+		BT_CTF_BYTE_ORDER_BIG_ENDIAN);
+	BT_ASSERT(ret == 0);
+	cfg->sc = bt_ctf_stream_class_create("hello");
+	BT_ASSERT(cfg->sc);
+	ret = bt_ctf_stream_class_set_clock(cfg->sc, cfg->clock);
+	BT_ASSERT(ret == 0);
+
+	/* Fixed layout */
+	cfg->ec_fixed = bt_ctf_event_class_create("fixed");
+	BT_ASSERT(cfg->ec_fixed);
+	add_int_field(cfg->ec_fixed, "a", 8, BT_CTF_FALSE, 8,
+		BT_CTF_BYTE_ORDER_BIG_ENDIAN);
+	add_int_field(cfg->ec_fixed, "b", 16, BT_CTF_TRUE, 8,
+		BT_CTF_BYTE_ORDER_BIG_ENDIAN);
+	add_int_field(cfg->ec_fixed, "c", 32, BT_CTF_FALSE, 8,
+		BT_CTF_BYTE_ORDER_LITTLE_ENDIAN);
+	add_int_field(cfg->ec_fixed, "d", 64, BT_CTF_TRUE, 8,
+		BT_CTF_BYTE_ORDER_BIG_ENDIAN);
+	ret = bt_ctf_stream_class_add_event_class(cfg->sc, cfg->ec_fixed);
+	BT_ASSERT(ret == 0);
+
+	/* Not byte-aligned by class */
+	cfg->ec_packed = bt_ctf_event_class_create("packed");
+	BT_ASSERT(cfg->ec_packed);
+	add_int_field(cfg->ec_packed, "a", 8, BT_CTF_FALSE, 1,
+		BT_CTF_BYTE_ORDER_BIG_ENDIAN);
+	add_int_field(cfg->ec_packed, "b", 16, BT_CTF_TRUE, 1,
+		BT_CTF_BYTE_ORDER_BIG_ENDIAN);
+	ret = bt_ctf_stream_class_add_event_class(cfg->sc, cfg->ec_packed);
+	BT_ASSERT(ret == 0);
+
+	/* Variable length */
+	cfg->ec_var = bt_ctf_event_class_create("var");
+	BT_ASSERT(cfg->ec_var);
+	add_int_field(cfg->ec_var, "a", 32, BT_CTF_FALSE, 8,
+		BT_CTF_BYTE_ORDER_BIG_ENDIAN);
+	ft = bt_ctf_field_type_string_create();
+	BT_ASSERT(ft);
+	ret = bt_ctf_event_class_add_field(cfg->ec_var, ft, "b");
+	BT_ASSERT(ret == 0);
+	bt_ctf_object_put_ref(ft);
+	ret = bt_ctf_stream_class_add_event_class(cfg->sc, cfg->ec_var);
+	BT_ASSERT(ret == 0);
+
+	cfg->stream = bt_ctf_writer_create_stream(cfg->writer, cfg->sc);
+	BT_ASSERT(cfg->stream);
+}
+
+static
+void set_uint_payload_field(struct bt_ctf_event *ev, const char *name,
+		uint64_t value)
+{
+	struct bt_ctf_field *field;
+	int ret;
+
+	field = bt_ctf_event_get_payload(ev, name);
+	BT_ASSERT(field);
+	ret = bt_ctf_field_integer_unsigned_set_value(field, value);
+	BT_ASSERT(ret == 0);
+	bt_ctf_object_put_ref(field);
+}
+
+static
+void set_int_payload_field(struct bt_ctf_event *ev, const char *name,
+		int64_t value)
+{
+	struct bt_ctf_field *field;
+	int ret;
+
+	field = bt_ctf_event_get_payload(ev, name);
+	BT_ASSERT(field);
+	ret = bt_ctf_field_integer_signed_set_value(field, value);
+	BT_ASSERT(ret == 0);
+	bt_ctf_object_put_ref(field);
+}
+
+static
+void append_event(struct config *cfg, struct bt_ctf_event *ev, uint64_t time)
+{
+	int ret;
+
+	ret = bt_ctf_clock_set_time(cfg->clock, time);
+	BT_ASSERT(ret == 0);
+	ret = bt_ctf_stream_append_event(cfg->stream, ev);
+	BT_ASSERT(ret == 0);
+	bt_ctf_object_put_ref(ev);
+}
+
+static
+void write_stream(struct config *cfg)
+{
+	struct bt_ctf_event *ev;
+	struct bt_ctf_field *field;
+	uint64_t i;
+	int ret;
+
+	for (i = 0; i < 4; i++) {
+		char str[16];
+
+		ev = bt_ctf_event_create(cfg->ec_fixed);
+		BT_ASSERT(ev);
+		set_uint_payload_field(ev, "a", 200 + i);
+		set_int_payload_field(ev, "b", -30000 + (int64_t) i);
+		set_uint_payload_field(ev, "c", UINT64_C(3000000000) + i);
+		set_int_payload_field(ev, "d",
+			INT64_C(-1234567890123) - (int64_t) i);
+		append_event(cfg, ev, 1000 + i * 3000);
+
+		ev = bt_ctf_event_create(cfg->ec_packed);
+		BT_ASSERT(ev);
+		set_uint_payload_field(ev, "a", i);
+		set_int_payload_field(ev, "b", -20000 + (int64_t) i);
+		append_event(cfg, ev, 2000 + i * 3000);
+
+		ev = bt_ctf_event_create(cfg->ec_var);
+		BT_ASSERT(ev);
+		set_uint_payload_field(ev, "a", 70000 + i);
+		field = bt_ctf_event_get_payload(ev, "b");
+		BT_ASSERT(field);
+		snprintf(str, sizeof(str), "str-%u", (unsigned int) i);
+		ret = bt_ctf_field_string_set_value(field, str);
+		BT_ASSERT(ret == 0);
+		bt_ctf_object_put_ref(field);
+		append_event(cfg, ev, 3000 + i * 3000);
+	}
+
+	ret = bt_ctf_stream_flush(cfg->stream);
+	BT_ASSERT(ret == 0);
+}
+
+int main(int argc, char **argv)
+{
+	struct config cfg = {0};
+
+	BT_ASSERT(argc >= 2);
+	configure_writer(&cfg, argv[1]);
+	write_stream(&cfg);
+	fini_config(&cfg);
+	return 0;
+}
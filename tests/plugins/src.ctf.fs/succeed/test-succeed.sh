@@ -179,10 +179,88 @@ test_force_origin_unix_epoch() {
 	done
 }
 
-plan_tests 44
+# Prints the `sink.text.details` output read from the standard input
+# without the event record field blocks (common context, specific
+# context, and payload).
+strip_event_record_fields() {
+	awk '
+		/^  (Common context|Specific context|Payload):/ { in_fields = 1; next }
+		in_fields && /^    / { next }
+		{ in_fields = 0; print }
+	'
+}
+
+# Prints the `sink.text.details` output read from the standard input
+# without the event messages of which the event class name isn't `$1`
+# (without any event message if `$1` is empty).
+keep_event_record_class() {
+	awk -v kept="$1" '
+		function flush() {
+			if (msg !~ /\nEvent `/ || (kept != "" && index(msg, "\nEvent `" kept "` (") != 0)) {
+				printf "%s", msg
+			}
+
+			msg = ""
+		}
+
+		{ msg = msg $0 "\n" }
+		/^$/ { flush() }
+		END { flush() }
+	'
+}
+
+# Runs a `src.ctf.fs` component on the trace named `$1` of each CTF
+# version, without and then with the parameters `$2`, and validates
+# that both runs give the same `sink.text.details` output, once the
+# first one goes through the command `$4...`, if any, and that the
+# second one doesn't write to the standard error.
+#
+# `$3` describes the parameters within the test names.
+test_params_same_output() {
+	local name="$1"
+	local params="$2"
+	local label="$3"
+	local filter=("${@:4}")
+	local details_comp=("-c" "sink.text.details")
+	local details_args=("-p" "with-trace-name=no,with-stream-name=no,with-metadata=no")
+	local expected_stdout_file
+	local temp_stdout_output_file
+	local temp_stderr_output_file
+
+	if [[ ${#filter[@]} -eq 0 ]]; then
+		filter=(cat)
+	fi
+
+	expected_stdout_file="$(mktemp -t expected-stdout.XXXXXX)"
+	temp_stdout_output_file="$(mktemp -t actual-stdout.XXXXXX)"
+	temp_stderr_output_file="$(mktemp -t actual-stderr.XXXXXX)"
+
+	for ctf_version in 1 2; do
+		local trace_path="$BT_CTF_TRACES_PATH/$ctf_version/succeed/$name"
+
+		bt_cli "$temp_stdout_output_file" /dev/null \
+			"$trace_path" "${details_comp[@]}" "${details_args[@]}"
+		"${filter[@]}" < "$temp_stdout_output_file" > "$expected_stdout_file"
+
+		bt_cli "$temp_stdout_output_file" "$temp_stderr_output_file" \
+			"$trace_path" -p "$params" \
+			"${details_comp[@]}" "${details_args[@]}"
+
+		bt_diff "$expected_stdout_file" "$temp_stdout_output_file"
+		ok $? "CTF $ctf_version: Trace '$name' $label gives the expected stdout"
+
+		bt_diff /dev/null "$temp_stderr_output_file"
+		ok $? "CTF $ctf_version: Trace '$name' $label gives the expected stderr"
+	done
+
+	rm -f "$expected_stdout_file" "$temp_stdout_output_file" "$temp_stderr_output_file"
+}
+
+plan_tests 77
 
 test_force_origin_unix_epoch 2packets barectf-event-before-packet
 test_ctf_gen_single simple
+test_ctf_gen_single fixed-layout
 test_ctf_single smalltrace
 test_ctf_single 2packets
 test_ctf_single barectf-event-before-packet
@@ -194,3 +272,19 @@ test_ctf_single meta-ctx-sequence
 test_ctf_single_version meta-clk-cls-before-trace-cls 2
 test_packet_end lttng-event-after-packet
 test_packet_end lttng-crash
+test_params_same_output smalltrace skip-event-record-fields=true \
+	"without event record fields" strip_event_record_fields
+test_params_same_output lttng-tracefile-rotation decoding-thread-count=3 \
+	"with decoding threads"
+test_params_same_output ev-disc-no-ts-begin-end decoding-thread-count=3 \
+	"with decoding threads"
+test_params_same_output lttng-tracefile-rotation map-whole-files=yes,populate-mappings=yes \
+	"with whole file mappings"
+test_params_same_output 2packets map-whole-files=yes,populate-mappings=yes \
+	"with whole file mappings"
+test_params_same_output session-rotation map-whole-files=yes,populate-mappings=yes \
+	"with whole file mappings"
+test_params_same_output lttng-tracefile-rotation 'event-record-class-names=["sched_switch"]' \
+	"with \`event-record-class-names\`" keep_event_record_class sched_switch
+test_params_same_output smalltrace 'event-record-class-ids=[1]' \
+	"with \`event-record-class-ids\`" keep_event_record_class ''
@@ -0,0 +1,197 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ *
+ * Copyright (C) 2024 EfficiOS Inc.
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <glib.h>
+#include <glib/gstdio.h>
+
+#include <babeltrace2/babeltrace.h>
+
+#include "common/assert.h"
+#include "compat/mman.h" /* IWYU pragma: keep */
+#include "cpp-common/bt2/exc.hpp"
+
+#include "plugins/ctf/fs-src/file-cache.hpp"
+
+#include "tap/tap.h"
+
+namespace {
+
+using ctf::src::fs::FileCache;
+using ctf::src::fs::FileCacheCfg;
+using ctf::src::fs::FileMapping;
+
+constexpr int NR_TESTS = 12;
+
+const bt2c::Logger logger {"TEST/FILE-CACHE", "TEST", bt2c::Logger::Level::None};
+
+/*
+ * Temporary data stream files, each one having a single page of bytes
+ * which are all `'a'` for the first file, `'b'` for the second one, and
+ * so on.
+ */
+class TestFiles final
+{
+public:
+    explicit TestFiles(const std::size_t count, const std::size_t len)
+    {
+        const auto dirPath = g_dir_make_tmp("test-file-cache-XXXXXX", nullptr);
+
+        BT_ASSERT(dirPath);
+        _mDirPath = dirPath;
+        g_free(dirPath);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::string data(len, static_cast<char>('a' + i));
+            auto path = _mDirPath + G_DIR_SEPARATOR_S + "file" + std::to_string(i);
+
+            BT_ASSERT(g_file_set_contents(path.c_str(), data.data(),
+                                          static_cast<gssize>(data.size()), nullptr));
+            _mPaths.emplace_back(std::move(path));
+        }
+    }
+
+    ~TestFiles()
+    {
+        for (const auto& path : _mPaths) {
+            (void) g_remove(path.c_str());
+        }
+
+        (void) g_rmdir(_mDirPath.c_str());
+    }
+
+    const std::string& operator[](const std::size_t index) const noexcept
+    {
+        return _mPaths[index];
+    }
+
+private:
+    std::string _mDirPath;
+    std::vector<std::string> _mPaths;
+};
+
+std::size_t pageLen() noexcept
+{
+    return bt_mmap_get_offset_align_size(BT_LOG_NONE);
+}
+
+/*
+ * The cache evicts the least recently used mapping to stay under its
+ * maximum mapped length.
+ */
+void testMappingLru()
+{
+    const auto len = pageLen();
+    const TestFiles files {3, len};
+    FileCacheCfg cfg;
+
+    cfg.maxMappedLen = len * 2;
+
+    FileCache cache {cfg, logger};
+    const auto mapping0 = cache.mapping(files[0], 0);
+    auto mapping1 = cache.mapping(files[1], 0);
+
+    ok(mapping0->len() == len && mapping0->addr()[0] == 'a' && mapping1->addr()[len - 1] == 'b',
+       "Mappings have the contents of their file");
+    ok(cache.mapping(files[0], 0) == mapping0, "Mapping again returns the cached mapping");
+
+    const std::weak_ptr<const FileMapping> weakMapping1 {mapping1};
+
+    mapping1.reset();
+
+    const auto mapping2 = cache.mapping(files[2], 0);
+
+    ok(weakMapping1.expired(), "Cache evicts the least recently used mapping");
+    ok(cache.mapping(files[0], 0) == mapping0, "Cache keeps the most recently used mapping");
+    ok(cache.mappedLen() == len * 2, "Mapped length is the maximum one");
+}
+
+/*
+ * The cache counts the evicted mappings which some other owner keeps
+ * alive.
+ */
+void testEvictedMappingLen()
+{
+    const auto len = pageLen();
+    const TestFiles files {3, len};
+    FileCacheCfg cfg;
+
+    cfg.maxMappedLen = len;
+
+    FileCache cache {cfg, logger};
+    auto mapping0 = cache.mapping(files[0], 0);
+    auto mapping1 = cache.mapping(files[1], 0);
+
+    ok(cache.mappedLen() == len * 2, "Mapped length includes an evicted mapping kept alive");
+
+    const std::weak_ptr<const FileMapping> weakMapping1 {mapping1};
+
+    mapping1.reset();
+
+    const auto mapping2 = cache.mapping(files[2], 0);
+
+    ok(weakMapping1.expired(), "Cache evicts all its mappings when evicted ones exceed the maximum");
+    ok(cache.mappedLen() == len * 2, "Mapped length includes the new mapping");
+    mapping0.reset();
+    ok(cache.mappedLen() == len, "Mapped length excludes an evicted mapping once released");
+}
+
+/*
+ * The cache closes the least recently used file to stay under its
+ * maximum open file count.
+ */
+void testFileLru()
+{
+#ifdef __MINGW32__
+    skip(3, "Can't remove an open file on this platform");
+#else
+    const auto len = pageLen();
+    const TestFiles files {3, len};
+    FileCacheCfg cfg;
+
+    /* Each new mapping evicts all the others */
+    cfg.maxOpenFileCount = 2;
+    cfg.maxMappedLen = 0;
+
+    FileCache cache {cfg, logger};
+
+    cache.mapping(files[0], 0);
+    cache.mapping(files[1], 0);
+    cache.mapping(files[2], 0);
+    ok(cache.openFileCount() == 2, "Cache keeps at most the maximum number of open files");
+
+    /* Only the open files remain readable once removed */
+    for (std::size_t i = 0; i < 3; ++i) {
+        (void) g_remove(files[i].c_str());
+    }
+
+    ok(cache.mapping(files[1], 0)->addr()[0] == 'b', "Cache keeps the most recently used files");
+
+    try {
+        cache.mapping(files[0], 0);
+        fail("Cache closes the least recently used file");
+    } catch (const bt2::Error&) {
+        bt_current_thread_clear_error();
+        pass("Cache closes the least recently used file");
+    }
+#endif
+}
+
+} /* namespace */
+
+int main()
+{
+    plan_tests(NR_TESTS);
+    testMappingLru();
+    testEvictedMappingLen();
+    testFileLru();
+    return exit_status();
+}
@@ -346,6 +346,21 @@ test_rate_limited() {
 		"$expected_stderr" "$trace_dir_native" "${server_args[@]}"
 }
 
+test_retry() {
+	# Attach and consume data from a multi packets ust session of which
+	# some data streams have no index entry at first (`RETRY` status),
+	# while the other ones have some. Ensure that the output is the same
+	# as without any retry.
+	local test_text="CLI attach and fetch with some data streams to retry"
+	local cli_args_template="-i lttng-live net://localhost:@PORT@/host/hostname/trace-with-index -c sink.text.details"
+	local server_args=("$test_data_dir/retry.json")
+	local expected_stdout="${test_data_dir}/cli-base.expect"
+	local expected_stderr="/dev/null"
+
+	run_test "$test_text" "$cli_args_template" "$expected_stdout" \
+		"$expected_stderr" "$trace_dir_native" "${server_args[@]}"
+}
+
 test_compare_to_ctf_fs() {
 	# Compare the details text sink or ctf.fs and ctf.lttng-live to ensure
 	# that the trace is parsed the same way.
@@ -493,12 +508,13 @@ test_invalid_metadata() {
 		"$trace_dir_native" "${server_args[@]}"
 }
 
-plan_tests 22
+plan_tests 24
 
 test_list_sessions
 test_base
 test_multi_domains
 test_rate_limited
+test_retry
 test_compare_to_ctf_fs
 test_inactivity_discarded_packet
 test_split_metadata
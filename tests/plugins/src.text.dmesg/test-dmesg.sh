@@ -0,0 +1,68 @@
+#!/bin/bash
+#
+# SPDX-License-Identifier: GPL-2.0-only
+#
+# Copyright (C) 2024 EfficiOS Inc.
+#
+
+SH_TAP=1
+
+if [[ -n "${BT_TESTS_SRCDIR:-}" ]]; then
+	UTILSSH="$BT_TESTS_SRCDIR/utils/utils.sh"
+else
+	UTILSSH="$(dirname "$0")/../../utils/utils.sh"
+fi
+
+# shellcheck source=../../utils/utils.sh
+source "$UTILSSH"
+
+data_dir="$BT_TESTS_DATADIR/plugins/src.text.dmesg"
+details_args=("-c" "sink.text.details" "-p" "with-metadata=no,with-trace-name=no,with-stream-name=no")
+
+# Checks that reading the input file `$1` with a `src.text.dmesg`
+# component prints the contents of the expected file `$2`.
+#
+# `$3` is the test description.
+test_dmesg() {
+	local -r input_path=$1
+	local -r expect_path=$2
+	local -r desc=$3
+
+	bt_diff_cli "$expect_path" /dev/null \
+		-c src.text.dmesg -p "path=\"$input_path\"" "${details_args[@]}"
+	ok $? "$desc"
+}
+
+# Checks that `src.text.dmesg` reads a line which is longer than its
+# initial input buffer (1 MiB), following a short line so that it also
+# spans a read boundary.
+test_dmesg_long_line() {
+	local -r input_path=$(mktemp -t test-dmesg-input.XXXXXX)
+	local -r expect_path=$(mktemp -t test-dmesg-expect.XXXXXX)
+	local -r tag="{Trace 0, Stream class ID 0, Stream ID 0}"
+	local long_str
+
+	long_str=$(head -c $((3 * 512 * 1024)) /dev/zero | tr '\0' x)
+	printf 'short line\n%s\nafter long line' "$long_str" > "$input_path"
+
+	{
+		printf '%s\nStream beginning:\n  Trace:\n    Stream (ID 0, Class ID 0)\n\n' "$tag"
+
+		for str in "short line" "$long_str" "after long line"; do
+			printf '%s\nEvent `string` (Class ID 0):\n  Payload:\n    str: %s\n\n' "$tag" "$str"
+		done
+
+		printf '%s\nStream end\n' "$tag"
+	} > "$expect_path"
+
+	test_dmesg "$input_path" "$expect_path" "Line longer than the input buffer"
+	rm -f "$input_path" "$expect_path"
+}
+
+plan_tests 3
+
+test_dmesg "$data_dir/timestamps.txt" "$data_dir/timestamps.expect" \
+	"Both timestamp forms, with whitespace, and a last line without a newline"
+test_dmesg "$data_dir/no-closing-bracket.txt" "$data_dir/no-closing-bracket.expect" \
+	"Timestamp without a closing bracket"
+test_dmesg_long_line